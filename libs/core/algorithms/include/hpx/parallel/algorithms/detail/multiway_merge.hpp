@@ -0,0 +1,293 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A tournament tree of losers over K sorted input sequences. The root
+    // (tree_[0]) always refers to the sequence holding the smallest current
+    // element, every inner node stores the loser of the match played at that
+    // node. Replacing the winner requires a single walk from the winner's leaf
+    // to the root (log K comparisons). Ties are resolved in favor of the
+    // sequence with the smaller index which makes the merge stable.
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Compare>
+    class loser_tree
+    {
+    public:
+        using sequence_type = std::pair<Iter, Iter>;
+
+        loser_tree(std::vector<sequence_type>& seqs, Compare& comp)
+          : seqs_(seqs)
+          , comp_(comp)
+          , k_(static_cast<std::uint32_t>(seqs.size()))
+          , nleaves_(1)
+        {
+            while (nleaves_ < k_)
+            {
+                nleaves_ <<= 1;
+            }
+            tree_.resize(nleaves_);
+            tree_[0] = play(1);
+        }
+
+        // index of the sequence holding the smallest current element
+        [[nodiscard]] std::uint32_t top() const noexcept
+        {
+            return tree_[0];
+        }
+
+        // advance the current winner and replay its path up to the root
+        void pop()
+        {
+            std::uint32_t winner = tree_[0];
+            ++seqs_[winner].first;
+
+            for (std::uint32_t node = (winner + nleaves_) >> 1; node != 0;
+                node >>= 1)
+            {
+                if (beats(tree_[node], winner))
+                {
+                    std::swap(tree_[node], winner);
+                }
+            }
+            tree_[0] = winner;
+        }
+
+    private:
+        [[nodiscard]] bool exhausted(std::uint32_t i) const noexcept
+        {
+            return i >= k_ || seqs_[i].first == seqs_[i].second;
+        }
+
+        // returns whether the current element of sequence a has to be
+        // emitted before the current element of sequence b
+        [[nodiscard]] bool beats(std::uint32_t a, std::uint32_t b) const
+        {
+            if (exhausted(a))
+                return false;
+            if (exhausted(b))
+                return true;
+            if (comp_(*seqs_[a].first, *seqs_[b].first))
+                return true;
+            if (comp_(*seqs_[b].first, *seqs_[a].first))
+                return false;
+            return a < b;
+        }
+
+        // build the subtree rooted at node, returns the winner
+        std::uint32_t play(std::uint32_t node)
+        {
+            if (node >= nleaves_)
+            {
+                return node - nleaves_;
+            }
+
+            std::uint32_t const left = play(2 * node);
+            std::uint32_t const right = play(2 * node + 1);
+            if (beats(right, left))
+            {
+                tree_[node] = left;
+                return right;
+            }
+            tree_[node] = right;
+            return left;
+        }
+
+        std::vector<sequence_type>& seqs_;
+        Compare& comp_;
+        std::uint32_t k_;
+        std::uint32_t nleaves_;
+        std::vector<std::uint32_t> tree_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Merge the given sorted sequences, invoking f for each input iterator in
+    // the (stable) merged order. The sequences are consumed, i.e. on return
+    // each seqs[i].first == seqs[i].second.
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Compare, typename F>
+    void loser_tree_merge(
+        std::vector<std::pair<Iter, Iter>>& seqs, Compare& comp, F&& f)
+    {
+        // drop empty sequences, this keeps the tree small
+        seqs.erase(std::remove_if(seqs.begin(), seqs.end(),
+                       [](auto const& seq) { return seq.first == seq.second; }),
+            seqs.end());
+
+        if (seqs.empty())
+        {
+            return;
+        }
+
+        if (seqs.size() == 1)
+        {
+            for (Iter it = seqs[0].first; it != seqs[0].second; ++it)
+            {
+                f(it);
+            }
+            seqs[0].first = seqs[0].second;
+            return;
+        }
+
+        std::size_t count = 0;
+        for (auto const& seq : seqs)
+        {
+            count += static_cast<std::size_t>(
+                std::distance(seq.first, seq.second));
+        }
+
+        loser_tree<Iter, Compare> tree(seqs, comp);
+        while (count-- != 0)
+        {
+            f(seqs[tree.top()].first);
+            tree.pop();
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Multi-sequence selection (co-ranking): compute for each of the sorted
+    // sequences the number of its elements that precede the element of rank
+    // 'rank' in the stable merge of all sequences. The sum of the resulting
+    // splitters is equal to rank (or to the overall number of elements, if
+    // rank is larger). Elements that compare equal are ordered by the index
+    // of the sequence they belong to, consistent with loser_tree_merge.
+    //
+    // Every probe cuts the largest remaining candidate window in half, which
+    // needs O(K log N) probes each costing K binary searches.
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Compare>
+    void multiseq_partition(std::vector<std::pair<Iter, Iter>> const& seqs,
+        std::size_t rank, Compare& comp, std::vector<std::size_t>& splitters)
+    {
+        std::size_t const k = seqs.size();
+        splitters.resize(k);
+
+        std::vector<std::size_t> lo(k, 0);
+        std::vector<std::size_t> hi(k);
+
+        std::size_t total = 0;
+        for (std::size_t i = 0; i != k; ++i)
+        {
+            hi[i] = static_cast<std::size_t>(
+                std::distance(seqs[i].first, seqs[i].second));
+            total += hi[i];
+        }
+
+        if (rank >= total)
+        {
+            splitters = HPX_MOVE(hi);
+            return;
+        }
+
+        if (rank == 0)
+        {
+            std::fill(splitters.begin(), splitters.end(), 0);
+            return;
+        }
+
+        while (true)
+        {
+            // probe the middle of the widest remaining window
+            std::size_t j = 0;
+            std::size_t width = 0;
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                if (hi[i] - lo[i] > width)
+                {
+                    width = hi[i] - lo[i];
+                    j = i;
+                }
+            }
+            HPX_ASSERT(width != 0);
+
+            std::size_t const pos = lo[j] + width / 2;
+            auto const& pivot = *std::next(seqs[j].first, pos);
+
+            std::size_t r = 0;
+            for (std::size_t i = 0; i != k; ++i)
+            {
+                if (i < j)
+                {
+                    splitters[i] = static_cast<std::size_t>(
+                        std::distance(seqs[i].first,
+                            std::upper_bound(
+                                seqs[i].first, seqs[i].second, pivot, comp)));
+                }
+                else if (i > j)
+                {
+                    splitters[i] = static_cast<std::size_t>(
+                        std::distance(seqs[i].first,
+                            std::lower_bound(
+                                seqs[i].first, seqs[i].second, pivot, comp)));
+                }
+                else
+                {
+                    splitters[i] = pos;
+                }
+                r += splitters[i];
+            }
+
+            if (r == rank)
+            {
+                return;
+            }
+
+            if (r < rank)
+            {
+                // the element we look for is stably greater than the pivot
+                for (std::size_t i = 0; i != k; ++i)
+                {
+                    lo[i] = (std::max) (lo[i], splitters[i]);
+                }
+                lo[j] = pos + 1;
+            }
+            else
+            {
+                // the element we look for is stably less than the pivot
+                for (std::size_t i = 0; i != k; ++i)
+                {
+                    hi[i] = (std::min) (hi[i], splitters[i]);
+                }
+            }
+        }
+    }
+
+    // Extract the sub-sequences that contribute to the output positions
+    // [begin_rank, end_rank) of the merged sequence.
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Compare>
+    std::vector<std::pair<Iter, Iter>> multiseq_slice(
+        std::vector<std::pair<Iter, Iter>> const& seqs, std::size_t begin_rank,
+        std::size_t end_rank, Compare& comp)
+    {
+        std::vector<std::size_t> begin_splitters;
+        std::vector<std::size_t> end_splitters;
+
+        multiseq_partition(seqs, begin_rank, comp, begin_splitters);
+        multiseq_partition(seqs, end_rank, comp, end_splitters);
+
+        std::vector<std::pair<Iter, Iter>> result;
+        result.reserve(seqs.size());
+        for (std::size_t i = 0; i != seqs.size(); ++i)
+        {
+            result.emplace_back(std::next(seqs[i].first, begin_splitters[i]),
+                std::next(seqs[i].first, end_splitters[i]));
+        }
+        return result;
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
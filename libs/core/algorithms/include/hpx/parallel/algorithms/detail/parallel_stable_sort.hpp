@@ -8,9 +8,16 @@
 #pragma once
 
 #include <hpx/assert.hpp>
+#include <hpx/modules/async_combinators.hpp>
 #include <hpx/modules/executors.hpp>
-#include <hpx/parallel/algorithms/detail/sample_sort.hpp>
-
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/parallel/algorithms/detail/is_sorted.hpp>
+#include <hpx/parallel/algorithms/detail/multiway_merge.hpp>
+#include <hpx/parallel/algorithms/detail/spin_sort.hpp>
+#include <hpx/parallel/util/low_level.hpp>
+#include <hpx/parallel/util/range.hpp>
+
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -18,6 +25,7 @@
 #include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx::parallel::detail {
 
@@ -80,47 +88,127 @@ namespace hpx::parallel::detail {
     {
         try
         {
-            std::size_t nptr = (nelem + 1) >> 1;
-            Iter last = range_initial.begin() + nelem;
+            Iter first = range_initial.begin();
+            Iter last = first + nelem;
 
             if (nelem < chunk_size || nthreads < 2)
             {
-                spin_sort(range_initial.begin(), range_initial.end(), comp);
+                spin_sort(first, range_initial.end(), comp);
                 return last;
             }
 
-            if (detail::is_sorted_sequential(
-                    range_initial.begin(), range_initial.end(), comp))
+            if (detail::is_sorted_sequential(first, range_initial.end(), comp))
             {
                 return last;
             }
 
-            // leave memory uninitialized, sample_sort will manage construction
-            // etc.
+            // leave memory uninitialized, the merge phase will construct the
+            // elements
             ptr = static_cast<value_type*>(
-                std::malloc(sizeof(value_type) * nptr));
+                std::malloc(sizeof(value_type) * nelem));
             if (ptr == nullptr)
             {
                 throw std::bad_alloc();
             }
 
-            // Parallel Process
-            util::range<Iter, Sent> range_first(
-                range_initial.begin(), range_initial.begin() + nptr);
-            util::range<Iter, Sent> range_second(
-                range_initial.begin() + nptr, range_initial.end());
-            util::range<value_type*> range_buffer(ptr, ptr + nptr);
+            // Sort one run per thread (in place, using the corresponding
+            // part of the buffer as auxiliary memory), merge all runs in a
+            // single pass into the buffer, and move the result back. This
+            // touches the data twice after sorting the runs instead of the
+            // log(nthreads) passes needed by a cascade of pairwise merges.
+            std::size_t const nruns = (std::clamp) (nelem / chunk_size,
+                static_cast<std::size_t>(2), static_cast<std::size_t>(nthreads));
+
+            std::vector<std::pair<Iter, Iter>> runs;
+            runs.reserve(nruns);
+            for (std::size_t i = 0; i != nruns; ++i)
+            {
+                runs.emplace_back(first + i * nelem / nruns,
+                    first + (i + 1) * nelem / nruns);
+            }
 
-            sample_sort(exec, range_initial.begin(),
-                range_initial.begin() + nptr, comp, nthreads, range_buffer,
-                chunk_size);
+            auto runs_shape = hpx::util::iterator_range(
+                hpx::util::counting_iterator(static_cast<std::size_t>(0)),
+                hpx::util::counting_iterator(nruns));
+
+            hpx::wait_all(execution::bulk_async_execute(
+                exec,
+                [&, this](std::size_t i) {
+                    std::size_t const offset =
+                        static_cast<std::size_t>(runs[i].first - first);
+                    std::size_t const size =
+                        static_cast<std::size_t>(runs[i].second - runs[i].first);
+
+                    spin_sort(runs[i].first, runs[i].second, comp,
+                        util::range<value_type*>(
+                            ptr + offset, ptr + offset + size));
+                },
+                runs_shape));
+
+            // merge into the uninitialized buffer, each task is responsible
+            // for an equally sized part of the output
+            std::size_t const nparts = nthreads;
+            std::vector<std::uint8_t> merged(nparts, 0);
+
+            auto bounds = [&](std::size_t part) {
+                return std::make_pair(
+                    part * nelem / nparts, (part + 1) * nelem / nparts);
+            };
+
+            auto parts_shape = hpx::util::iterator_range(
+                hpx::util::counting_iterator(static_cast<std::size_t>(0)),
+                hpx::util::counting_iterator(nparts));
+
+            try
+            {
+                hpx::wait_all(execution::bulk_async_execute(
+                    exec,
+                    [&, this](std::size_t part) {
+                        auto [k0, k1] = bounds(part);
+
+                        auto slice = multiseq_slice(runs, k0, k1, comp);
+
+                        value_type* out = ptr + k0;
+                        try
+                        {
+                            loser_tree_merge(slice, comp, [&out](Iter it) {
+                                util::construct_object(
+                                    out, std::ranges::iter_move(it));
+                                ++out;
+                            });
+                        }
+                        catch (...)
+                        {
+                            util::destroy(ptr + k0, out);
+                            throw;
+                        }
+                        merged[part] = 1;
+                    },
+                    parts_shape));
+            }
+            catch (...)
+            {
+                for (std::size_t part = 0; part != nparts; ++part)
+                {
+                    if (merged[part])
+                    {
+                        auto [k0, k1] = bounds(part);
+                        util::destroy(ptr + k0, ptr + k1);
+                    }
+                }
+                throw;
+            }
 
-            sample_sort(exec, range_initial.begin() + nptr, range_initial.end(),
-                comp, nthreads, range_buffer, chunk_size);
+            // move the merged sequence back and destroy the buffer elements
+            hpx::wait_all(execution::bulk_async_execute(
+                exec,
+                [&](std::size_t part) {
+                    auto [k0, k1] = bounds(part);
 
-            range_buffer = parallel::util::init_move(range_buffer, range_first);
-            range_initial = parallel::util::half_merge(
-                range_initial, range_buffer, range_second, comp);
+                    util::init_move(first + k0, ptr + k0, ptr + k1);
+                    util::destroy(ptr + k0, ptr + k1);
+                },
+                parts_shape));
 
             return last;
         }
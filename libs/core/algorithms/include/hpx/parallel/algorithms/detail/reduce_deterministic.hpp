@@ -13,6 +13,8 @@
 #include <hpx/parallel/algorithms/detail/rfa.hpp>
 #include <hpx/parallel/util/loop.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstring>
 #include <limits>
@@ -130,6 +132,68 @@ namespace hpx::parallel::detail {
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////
+    // The reference bins used by the reproducible accumulators have to be
+    // initialized before any accumulation takes place.
+    HPX_CXX_CORE_EXPORT template <typename T>
+    void initialize_rfa_bins()
+    {
+        hpx::parallel::detail::rfa::RFA_bins<T> bins;
+        bins.initialize_bins();
+        std::memcpy(hpx::parallel::detail::rfa::hpx_rfa_bin_host_buffer,
+            &bins, sizeof(bins));
+    }
+
+    // Add count values produced by the given iterator and conversion
+    // function to the reproducible accumulator. The converted values are
+    // staged in small blocks, the maximum absolute value of each block is
+    // determined by a separate, vectorizable pass. This allows rebinning the
+    // accumulator once per block instead of once per element.
+    HPX_CXX_CORE_EXPORT template <typename T, typename Iter, typename Conv>
+    Iter accumulate_deterministic(
+        hpx::parallel::detail::rfa::reproducible_floating_accumulator<T>& rfa,
+        Iter first, std::size_t count, Conv&& conv)
+    {
+        constexpr std::size_t block_size = 256;
+        static_assert(std::is_floating_point_v<T>,
+            "reproducible accumulation requires a floating point type");
+
+        T buffer[block_size];
+        while (count != 0)
+        {
+            // clang-format off
+            std::size_t const n = (std::min) (count, block_size);
+            // clang-format on
+
+            for (std::size_t i = 0; i != n; (void) ++i, ++first)
+            {
+                buffer[i] = static_cast<T>(HPX_INVOKE(conv, first));
+            }
+
+            T max_abs_val = static_cast<T>(0.0);
+            for (std::size_t i = 0; i != n; ++i)
+            {
+                // clang-format off
+                max_abs_val = (std::max) (max_abs_val, std::abs(buffer[i]));
+                // clang-format on
+            }
+
+            // a block of zeros does not contribute to the sum
+            if (max_abs_val != static_cast<T>(0.0))
+            {
+                rfa.set_max_abs_val(max_abs_val);
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    rfa.unsafe_add(buffer[i]);
+                }
+                rfa.renorm();
+            }
+
+            count -= n;
+        }
+        return first;
+    }
+
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
     HPX_CXX_CORE_EXPORT template <typename ExPolicy>
     inline constexpr sequential_reduce_deterministic_t<ExPolicy>
@@ -0,0 +1,185 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // Ranges not larger than this are finished by a sequential selection.
+    HPX_CXX_CORE_EXPORT inline constexpr std::size_t sampled_select_limit =
+        1 << 16;
+
+    // Upper bound for the number of elements drawn as a sample.
+    HPX_CXX_CORE_EXPORT inline constexpr std::size_t sampled_select_max_sample =
+        1 << 14;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parallel selection using sampled pivots (Floyd-Rivest).
+    //
+    // A sorted random sample of the range is used to pick two pivots that
+    // bracket the requested rank with high probability. Two parallel
+    // partitioning passes then move the elements less than the lower pivot to
+    // the front and the elements greater than the upper pivot to the back,
+    // leaving a small band of candidates around nth. This usually converges
+    // after one or two rounds instead of the O(log N) rounds needed when
+    // partitioning around a single pivot per round. The remaining band is
+    // handled sequentially.
+    //
+    // On return, *nth is the element that would be at this position if the
+    // range was sorted, all elements in [first, nth) are not greater and all
+    // elements in [nth, last) are not less than *nth.
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename RandomIt,
+        typename Pred, typename Proj>
+    void parallel_sampled_select(ExPolicy&& policy, RandomIt first,
+        RandomIt nth, RandomIt last, Pred& pred, Proj& proj)
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+        util::compare_projected<Pred&, Proj&> comp(pred, proj);
+
+        std::minstd_rand gen(static_cast<unsigned>(last - first));
+        std::vector<value_type> sample;
+
+        while (static_cast<std::size_t>(last - first) > sampled_select_limit)
+        {
+            auto const n = static_cast<std::size_t>(last - first);
+            auto const k = static_cast<std::size_t>(nth - first);
+
+            // draw a sample of size ~N^(2/3), one element from each stride
+            std::size_t const s = (std::min) (
+                static_cast<std::size_t>(
+                    std::cbrt(static_cast<double>(n) * static_cast<double>(n))),
+                sampled_select_max_sample);
+            std::size_t const stride = n / s;
+
+            std::uniform_int_distribution<std::size_t> dist(0, stride - 1);
+
+            sample.clear();
+            sample.reserve(s);
+            for (std::size_t i = 0; i != s; ++i)
+            {
+                sample.push_back(*std::next(first, i * stride + dist(gen)));
+            }
+            std::sort(sample.begin(), sample.end(), comp);
+
+            // the bracket around the expected position of nth inside the
+            // sample
+            double const spread = 0.5 *
+                std::sqrt(std::log(static_cast<double>(n)) *
+                    static_cast<double>(s));
+            std::size_t const gap = static_cast<std::size_t>(spread) + 1;
+            std::size_t const r = k * s / n;
+
+            bool const has_lo = r > gap;
+            bool const has_hi = r + gap < s;
+
+            auto partition_range = [&](RandomIt f, RandomIt l, auto&& p) {
+                return detail::partition<RandomIt>().call(
+                    policy(hpx::execution::non_task), f, l, HPX_MOVE(p), proj);
+            };
+
+            RandomIt mid1 = first;
+            if (has_lo)
+            {
+                mid1 = partition_range(first, last,
+                    [lo = HPX_INVOKE(proj, sample[r - gap]), &pred](
+                        auto const& elem) {
+                        return HPX_INVOKE(pred, elem, lo);
+                    });
+
+                if (nth < mid1)
+                {
+                    last = mid1;
+                    continue;
+                }
+            }
+
+            RandomIt mid2 = last;
+            if (has_hi)
+            {
+                mid2 = partition_range(mid1, last,
+                    [hi = HPX_INVOKE(proj, sample[r + gap]), &pred](
+                        auto const& elem) {
+                        return !HPX_INVOKE(pred, hi, elem);
+                    });
+
+                if (nth >= mid2)
+                {
+                    first = mid2;
+                    continue;
+                }
+            }
+
+            if (mid1 != first || mid2 != last)
+            {
+                first = mid1;
+                last = mid2;
+                continue;
+            }
+
+            // No progress, all elements are in the band between the pivots,
+            // which means that the pivots are the minimum and the maximum of
+            // the range. Split off all elements equivalent to one of those,
+            // both pivots are part of the range, so this always makes
+            // progress.
+            if (has_lo)
+            {
+                RandomIt const mid = partition_range(first, last,
+                    [lo = HPX_INVOKE(proj, sample[r - gap]), &pred](
+                        auto const& elem) {
+                        return !HPX_INVOKE(pred, lo, elem);
+                    });
+
+                // [first, mid) holds elements equivalent to the minimum
+                if (nth < mid || mid == last)
+                {
+                    return;
+                }
+                first = mid;
+            }
+            else if (has_hi)
+            {
+                RandomIt const mid = partition_range(first, last,
+                    [hi = HPX_INVOKE(proj, sample[r + gap]), &pred](
+                        auto const& elem) {
+                        return HPX_INVOKE(pred, elem, hi);
+                    });
+
+                // [mid, last) holds elements equivalent to the maximum
+                if (nth >= mid || mid == first)
+                {
+                    return;
+                }
+                last = mid;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if (nth != last)
+        {
+            std::nth_element(first, nth, last, comp);
+        }
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -14,3 +14,4 @@
 #include <hpx/parallel/algorithms/for_loop_reduction_min.hpp>
 #include <hpx/parallel/algorithms/for_loop_reduction_multiplies.hpp>
 #include <hpx/parallel/algorithms/for_loop_reduction_plus.hpp>
+#include <hpx/parallel/algorithms/for_loop_reduction_plus_deterministic.hpp>
@@ -0,0 +1,129 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/for_loop_reduction_plus_deterministic.hpp
+/// \page hpx::experimental::reduction_plus_deterministic
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/parallel/algorithms/detail/reduce_deterministic.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct deterministic_reduction_helper
+    {
+        static_assert(std::is_floating_point_v<T>,
+            "deterministic reductions require a floating point type");
+
+        using needs_current_thread_num = void;
+        using accumulator_type =
+            hpx::parallel::detail::rfa::reproducible_floating_accumulator<T>;
+
+        explicit deterministic_reduction_helper(T& var)
+          : var_(var)
+        {
+            detail::initialize_rfa_bins<T>();
+
+            std::size_t const cores =
+                hpx::parallel::execution::detail::get_os_thread_count();
+            data_.reset(new hpx::util::cache_line_data<accumulator_type>[cores]);
+            for (std::size_t i = 0; i != cores; ++i)
+            {
+                data_[i].data_.zero();
+            }
+        }
+
+        HPX_HOST_DEVICE static constexpr void init_iteration(
+            std::size_t /*index*/,
+            [[maybe_unused]] std::size_t current_thread) noexcept
+        {
+            HPX_ASSERT(current_thread <
+                hpx::parallel::execution::detail::get_os_thread_count());
+        }
+
+        HPX_HOST_DEVICE HPX_FORCEINLINE accumulator_type& iteration_value(
+            std::size_t current_thread) noexcept
+        {
+            return data_[current_thread].data_;
+        }
+
+        HPX_HOST_DEVICE HPX_FORCEINLINE static constexpr void next_iteration(
+            std::size_t /*current_thread*/) noexcept
+        {
+        }
+
+        // the accumulators are exactly associative, the order in which the
+        // views are combined does not influence the result
+        HPX_HOST_DEVICE void exit_iteration(std::size_t /*index*/)
+        {
+            accumulator_type result;
+            result.zero();
+            result += var_;
+
+            std::size_t const cores =
+                hpx::parallel::execution::detail::get_os_thread_count();
+            for (std::size_t i = 0; i != cores; ++i)
+            {
+                result += data_[i].data_;
+            }
+            var_ = result.conv();
+        }
+
+    private:
+        T& var_;
+        std::shared_ptr<hpx::util::cache_line_data<accumulator_type>[]> data_;
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    /// The function template \a reduction_plus_deterministic returns a
+    /// reduction object computing the sum of floating point values such that
+    /// the result does not depend on the number of threads executing the
+    /// algorithm or on the way the iterations are distributed over them.
+    ///
+    /// Each view of the reduction is a reproducible floating point
+    /// accumulator (initially zero) to which the element-access function adds
+    /// values using operator+=. At some point before the algorithm returns,
+    /// the accumulators are combined with the initial value of the live-out
+    /// object and the rounded sum is assigned back to it.
+    ///
+    /// \tparam T       The value type to be used by the reduction object,
+    ///                 this has to be float or double.
+    ///
+    /// \param var      [in,out] The life-out value to use for the reduction
+    ///                 object. This will hold the reduced value after the
+    ///                 algorithm is finished executing.
+    ///
+    /// \note Adding single values to a reproducible accumulator is
+    ///       considerably more expensive than a plain floating point
+    ///       addition. \a hpx::experimental::transform_reduce_deterministic
+    ///       should be preferred where applicable as it processes the values
+    ///       in blocks.
+    ///
+    /// \returns This returns a reduction object of unspecified type. When the
+    ///          return value is used by an algorithm, the reference to \a var
+    ///          is used as the live-out object.
+    ///
+    HPX_CXX_CORE_EXPORT template <typename T>
+    HPX_FORCEINLINE hpx::parallel::detail::deterministic_reduction_helper<T>
+    reduction_plus_deterministic(T& var)
+    {
+        return hpx::parallel::detail::deterministic_reduction_helper<T>(var);
+    }
+}    // namespace hpx::experimental
@@ -0,0 +1,283 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \page hpx::experimental::indirect_for_each
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx::experimental {
+
+    // clang-format off
+
+    /// Applies \a f to the elements data[*it] for each iterator it in the
+    /// range [first, last) (gather/scatter access). The elements referred to
+    /// by the index sequence are prefetched \a params.distance iterations
+    /// ahead of their use, and the index sequence is processed in blocks of
+    /// \a params.block_bytes bytes. The elements themselves are accessed in
+    /// the order given by the index sequence. Executed according to the
+    /// policy.
+    ///
+    /// \note   Complexity: Applies \a f exactly \a last - \a first times.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam IdxIter     The type of the iterators used for the index
+    ///                     sequence (deduced). This iterator type must meet
+    ///                     the requirements of a random access iterator, its
+    ///                     value type must be an integral type.
+    /// \tparam DataIter    The type of the iterator referring to the gathered
+    ///                     or scattered elements (deduced). This iterator type
+    ///                     must meet the requirements of a random access
+    ///                     iterator.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the index sequence.
+    /// \param last         Refers to the end of the index sequence.
+    /// \param data         Refers to the beginning of the sequence of
+    ///                     elements the indices refer to.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements data[i].
+    ///                     The signature of this function should be
+    ///                     equivalent to the following:
+    ///                     \code
+    ///                     <ignored> pred(Type& a);
+    ///                     \endcode \n
+    ///                     Modifying the elements constitutes a scatter, the
+    ///                     caller has to make sure that no index occurs more
+    ///                     than once in this case.
+    /// \param params       The prefetching and blocking parameters, see
+    ///                     \a indirect_prefetch_parameters.
+    ///                     Setting params.for_write prefetches the elements
+    ///                     for modification.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a indirect_for_each algorithm returns a
+    ///           \a hpx::future<IdxIter> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a IdxIter otherwise. It returns \a last.
+    ///
+    template <typename ExPolicy, typename IdxIter, typename DataIter,
+        typename F>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, IdxIter>
+    indirect_for_each(ExPolicy&& policy, IdxIter first, IdxIter last,
+        DataIter data, F&& f,
+        hpx::parallel::util::indirect_prefetch_parameters const& params = {});
+
+    /// Applies \a f to the elements data[*it] for each iterator it in the
+    /// range [first, last) (gather/scatter access). The elements referred to
+    /// by the index sequence are prefetched \a params.distance iterations
+    /// ahead of their use.
+    ///
+    /// \note   Complexity: Applies \a f exactly \a last - \a first times.
+    ///
+    /// \tparam IdxIter     The type of the iterators used for the index
+    ///                     sequence (deduced). This iterator type must meet
+    ///                     the requirements of a random access iterator, its
+    ///                     value type must be an integral type.
+    /// \tparam DataIter    The type of the iterator referring to the gathered
+    ///                     or scattered elements (deduced). This iterator type
+    ///                     must meet the requirements of a random access
+    ///                     iterator.
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced).
+    ///
+    /// \param first        Refers to the beginning of the index sequence.
+    /// \param last         Refers to the end of the index sequence.
+    /// \param data         Refers to the beginning of the sequence of
+    ///                     elements the indices refer to.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements data[i].
+    /// \param params       The prefetching and blocking parameters, see
+    ///                     \a indirect_prefetch_parameters.
+    ///
+    /// \returns  The \a indirect_for_each algorithm returns \a last.
+    ///
+    template <typename IdxIter, typename DataIter, typename F>
+    IdxIter indirect_for_each(IdxIter first, IdxIter last, DataIter data,
+        F&& f,
+        hpx::parallel::util::indirect_prefetch_parameters const& params = {});
+
+    // clang-format on
+}    // namespace hpx::experimental
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/indirect_prefetching.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+    HPX_CXX_CORE_EXPORT template <typename Iter>
+    struct indirect_for_each
+      : public algorithm<indirect_for_each<Iter>, Iter>
+    {
+        constexpr indirect_for_each() noexcept
+          : algorithm<indirect_for_each, Iter>("indirect_for_each")
+        {
+        }
+
+        template <typename ExPolicy, typename IdxIter, typename DataIter,
+            typename F>
+        static IdxIter sequential(ExPolicy&&, IdxIter first, IdxIter last,
+            DataIter data, F&& f,
+            util::indirect_prefetch_parameters const& params)
+        {
+            auto const count =
+                static_cast<std::size_t>(detail::distance(first, last));
+
+            process(params.for_write, first, data, f, params, 0, count);
+            return last;
+        }
+
+        template <typename ExPolicy, typename IdxIter, typename DataIter,
+            typename F>
+        static decltype(auto) parallel(ExPolicy&& policy, IdxIter first,
+            IdxIter last, DataIter data, F&& f,
+            util::indirect_prefetch_parameters const& params)
+        {
+            constexpr bool has_scheduler_executor =
+                hpx::execution_policy_has_scheduler_executor_v<ExPolicy>;
+
+            auto const count =
+                static_cast<std::size_t>(detail::distance(first, last));
+
+            if constexpr (!has_scheduler_executor)
+            {
+                if (count == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        IdxIter>::get(HPX_MOVE(last));
+                }
+            }
+
+            using index_type = std::iter_value_t<IdxIter>;
+            std::size_t const block_size =
+                params.block_size(sizeof(index_type));
+
+            return util::blocked_partitioner<ExPolicy>::call(
+                HPX_FORWARD(ExPolicy, policy), count, block_size,
+                [first, data, f = HPX_FORWARD(F, f), params](
+                    std::size_t part_first, std::size_t part_last) mutable {
+                    process(params.for_write, first, data, f, params,
+                        part_first, part_last);
+                },
+                [last](std::size_t) { return last; });
+        }
+
+    private:
+        // the prefetch hint is selected once per block, not per element
+        template <typename IdxIter, typename DataIter, typename F>
+        static void process(bool for_write, IdxIter first, DataIter data,
+            F& f, util::indirect_prefetch_parameters const& params,
+            std::size_t part_first, std::size_t part_last)
+        {
+            auto const body = [&](std::size_t k) {
+                HPX_INVOKE(f, data[first[k]]);
+            };
+
+            if (for_write)
+            {
+                util::make_indirect_prefetcher<true>(first, params, data)
+                    .loop(part_first, part_last, body);
+            }
+            else
+            {
+                util::make_indirect_prefetcher<false>(first, params, data)
+                    .loop(part_first, part_last, body);
+            }
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::indirect_for_each
+    HPX_CXX_CORE_EXPORT inline constexpr struct indirect_for_each_t final
+      : hpx::detail::tag_parallel_algorithm<indirect_for_each_t>
+    {
+        template <typename IdxIter, typename DataIter, typename F>
+        // clang-format off
+            requires (
+                hpx::traits::is_iterator_v<IdxIter> &&
+                hpx::traits::is_iterator_v<DataIter> &&
+                std::is_integral_v<std::iter_value_t<IdxIter>>
+            )
+        // clang-format on
+        friend IdxIter tag_fallback_invoke(
+            hpx::experimental::indirect_for_each_t, IdxIter first,
+            IdxIter last, DataIter data, F f,
+            hpx::parallel::util::indirect_prefetch_parameters const& params =
+                {})
+        {
+            static_assert(std::random_access_iterator<IdxIter> &&
+                    std::random_access_iterator<DataIter>,
+                "Requires at least random access iterators.");
+
+            return hpx::parallel::detail::indirect_for_each<IdxIter>().call(
+                hpx::execution::seq, first, last, data, HPX_MOVE(f), params);
+        }
+
+        template <typename ExPolicy, typename IdxIter, typename DataIter,
+            typename F>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<IdxIter> &&
+                hpx::traits::is_iterator_v<DataIter> &&
+                std::is_integral_v<std::iter_value_t<IdxIter>>
+            )
+        // clang-format on
+        friend parallel::util::detail::algorithm_result_t<ExPolicy, IdxIter>
+        tag_fallback_invoke(hpx::experimental::indirect_for_each_t,
+            ExPolicy&& policy, IdxIter first, IdxIter last, DataIter data, F f,
+            hpx::parallel::util::indirect_prefetch_parameters const& params =
+                {})
+        {
+            static_assert(std::random_access_iterator<IdxIter> &&
+                    std::random_access_iterator<DataIter>,
+                "Requires at least random access iterators.");
+
+            return hpx::parallel::detail::indirect_for_each<IdxIter>().call(
+                HPX_FORWARD(ExPolicy, policy), first, last, data, HPX_MOVE(f),
+                params);
+        }
+    } indirect_for_each{};
+}    // namespace hpx::experimental
+
+#endif
@@ -0,0 +1,374 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/multiway_merge.hpp
+/// \page hpx::experimental::multiway_merge
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx::experimental {
+    // clang-format off
+
+    /// Merges the K sorted ranges described by [first_seq, last_seq) into one
+    /// sorted range beginning at \a dest. Each element of [first_seq,
+    /// last_seq) is a pair of iterators (first, last) describing one sorted
+    /// input sequence. The order of equivalent elements in each of the input
+    /// sequences is preserved. For equivalent elements in different
+    /// sequences, the elements from the sequence appearing earlier in
+    /// [first_seq, last_seq) precede the elements from later sequences. The
+    /// destination range cannot overlap with any of the input ranges.
+    ///
+    /// The merge is performed in a single pass over memory: the output is
+    /// divided into equally sized pieces, the splitting positions inside each
+    /// of the input sequences are determined by multi-sequence selection
+    /// (co-ranking), and each piece is then merged independently using a
+    /// tournament tree of losers.
+    ///
+    /// \note   Complexity: Performs O(N log(K)) comparisons, where N is the
+    ///         overall number of elements and K is the number of sequences.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the iterators used to describe the
+    ///                     sequence of input ranges (deduced). Its value type
+    ///                     must be a std::pair of random access iterators.
+    /// \tparam RandIter2   The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a multiway_merge requires \a Comp to
+    ///                     meet the requirements of \a CopyConstructible. This
+    ///                     defaults to std::less<>
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first_seq    Refers to the beginning of the sequence of input
+    ///                     ranges the algorithm will be applied to.
+    /// \param last_seq     Refers to the end of the sequence of input ranges
+    ///                     the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise. The signature of this
+    ///                     comparison should be equivalent to:
+    ///                     \code
+    ///                     bool comp(const Type1 &a, const Type2 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&, but
+    ///                     the function must not modify the objects passed to
+    ///                     it.
+    ///
+    /// The assignments in the parallel \a multiway_merge algorithm invoked with
+    /// an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a multiway_merge algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a multiway_merge algorithm returns a
+    /// \a hpx::future<RandIter2> if the execution policy is of type
+    /// \a sequenced_task_policy or \a parallel_task_policy and returns
+    /// \a RandIter2 otherwise.
+    /// The \a multiway_merge algorithm returns the destination iterator to
+    /// the end of the \a dest range.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename Comp = hpx::parallel::detail::less>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, RandIter2>
+    multiway_merge(ExPolicy&& policy, RandIter1 first_seq, RandIter1 last_seq,
+        RandIter2 dest, Comp&& comp = Comp());
+
+    /// Merges the K sorted ranges described by [first_seq, last_seq) into one
+    /// sorted range beginning at \a dest. Each element of [first_seq,
+    /// last_seq) is a pair of iterators (first, last) describing one sorted
+    /// input sequence. The order of equivalent elements in each of the input
+    /// sequences is preserved. For equivalent elements in different
+    /// sequences, the elements from the sequence appearing earlier in
+    /// [first_seq, last_seq) precede the elements from later sequences. The
+    /// destination range cannot overlap with any of the input ranges.
+    ///
+    /// \note   Complexity: Performs O(N log(K)) comparisons, where N is the
+    ///         overall number of elements and K is the number of sequences.
+    ///
+    /// \tparam RandIter1   The type of the iterators used to describe the
+    ///                     sequence of input ranges (deduced). Its value type
+    ///                     must be a std::pair of random access iterators.
+    /// \tparam RandIter2   The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced). This defaults to std::less<>
+    ///
+    /// \param first_seq    Refers to the beginning of the sequence of input
+    ///                     ranges the algorithm will be applied to.
+    /// \param last_seq     Refers to the end of the sequence of input ranges
+    ///                     the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param comp         \a comp is a callable object which returns true if
+    ///                     the first argument is less than the second,
+    ///                     and false otherwise.
+    ///
+    /// \returns  The \a multiway_merge algorithm returns a \a RandIter2.
+    /// The \a multiway_merge algorithm returns the destination iterator to
+    /// the end of the \a dest range.
+    ///
+    template <typename RandIter1, typename RandIter2,
+        typename Comp = hpx::parallel::detail::less>
+    RandIter2 multiway_merge(RandIter1 first_seq, RandIter1 last_seq,
+        RandIter2 dest, Comp&& comp = Comp());
+
+    // clang-format on
+}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/multiway_merge.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/foreach_partitioner.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    /////////////////////////////////////////////////////////////////////////////
+    // multiway_merge
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        HPX_CXX_CORE_EXPORT template <typename SeqIter>
+        using multiway_merge_sequence_t = std::decay_t<
+            decltype(std::declval<
+                typename std::iterator_traits<SeqIter>::value_type>()
+                    .first)>;
+
+        HPX_CXX_CORE_EXPORT template <typename SeqIter>
+        auto make_multiway_merge_sequences(SeqIter first_seq, SeqIter last_seq)
+        {
+            using iterator = multiway_merge_sequence_t<SeqIter>;
+
+            std::vector<std::pair<iterator, iterator>> seqs;
+            seqs.reserve(std::distance(first_seq, last_seq));
+            for (/**/; first_seq != last_seq; ++first_seq)
+            {
+                seqs.emplace_back(first_seq->first, first_seq->second);
+            }
+            return seqs;
+        }
+
+        HPX_CXX_CORE_EXPORT template <typename Iter>
+        std::size_t multiway_merge_size(
+            std::vector<std::pair<Iter, Iter>> const& seqs) noexcept
+        {
+            std::size_t count = 0;
+            for (auto const& seq : seqs)
+            {
+                count += static_cast<std::size_t>(
+                    std::distance(seq.first, seq.second));
+            }
+            return count;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename Iter,
+            typename OutIter, typename Comp, typename Proj>
+        decltype(auto) parallel_multiway_merge(ExPolicy&& policy,
+            std::vector<std::pair<Iter, Iter>>&& seqs, OutIter dest,
+            Comp&& comp, Proj&& proj)
+        {
+            std::size_t const count = multiway_merge_size(seqs);
+
+            auto f1 = [seqs = HPX_MOVE(seqs), dest, count,
+                          comp = HPX_FORWARD(Comp, comp),
+                          proj = HPX_FORWARD(Proj, proj)](
+                          std::size_t idx, std::size_t chunk) {
+                std::size_t const k0 = (std::min) (idx * chunk, count);
+                std::size_t const k1 = (std::min) (k0 + chunk, count);
+                if (k0 == k1)
+                {
+                    return;
+                }
+
+                util::compare_projected<std::decay_t<Comp> const&,
+                    std::decay_t<Proj> const&>
+                    cmp(comp, proj);
+
+                auto slice = multiseq_slice(seqs, k0, k1, cmp);
+
+                OutIter out = std::next(dest, k0);
+                loser_tree_merge(slice, cmp, [&out](Iter it) {
+                    *out = *it;
+                    ++out;
+                });
+            };
+
+            auto f2 = [](OutIter last) { return last; };
+
+            return util::foreach_partitioner<std::decay_t<ExPolicy>>::call(
+                HPX_FORWARD(ExPolicy, policy), dest, count, HPX_MOVE(f1),
+                HPX_MOVE(f2), get_diagonal_index(count));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        HPX_CXX_CORE_EXPORT template <typename OutIter>
+        struct multiway_merge
+          : public algorithm<multiway_merge<OutIter>, OutIter>
+        {
+            constexpr multiway_merge() noexcept
+              : algorithm<multiway_merge, OutIter>("multiway_merge")
+            {
+            }
+
+            template <typename ExPolicy, typename SeqIter, typename Comp,
+                typename Proj>
+            static OutIter sequential(ExPolicy, SeqIter first_seq,
+                SeqIter last_seq, OutIter dest, Comp&& comp, Proj&& proj)
+            {
+                using iterator = multiway_merge_sequence_t<SeqIter>;
+
+                auto seqs = make_multiway_merge_sequences(first_seq, last_seq);
+
+                util::compare_projected<Comp&, Proj&> cmp(comp, proj);
+                loser_tree_merge(seqs, cmp, [&dest](iterator it) {
+                    *dest = *it;
+                    ++dest;
+                });
+                return dest;
+            }
+
+            template <typename ExPolicy, typename SeqIter, typename Comp,
+                typename Proj>
+            static util::detail::algorithm_result_t<ExPolicy, OutIter>
+            parallel(ExPolicy&& policy, SeqIter first_seq, SeqIter last_seq,
+                OutIter dest, Comp&& comp, Proj&& proj)
+            {
+                using algorithm_result =
+                    util::detail::algorithm_result<ExPolicy, OutIter>;
+
+                try
+                {
+                    auto seqs =
+                        make_multiway_merge_sequences(first_seq, last_seq);
+                    if (multiway_merge_size(seqs) == 0)
+                    {
+                        return algorithm_result::get(HPX_MOVE(dest));
+                    }
+
+                    return algorithm_result::get(
+                        parallel_multiway_merge(HPX_FORWARD(ExPolicy, policy),
+                            HPX_MOVE(seqs), dest, HPX_FORWARD(Comp, comp),
+                            HPX_FORWARD(Proj, proj)));
+                }
+                catch (...)
+                {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, OutIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::multiway_merge
+    HPX_CXX_CORE_EXPORT inline constexpr struct multiway_merge_t final
+      : hpx::detail::tag_parallel_algorithm<multiway_merge_t>
+    {
+    private:
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename Comp = hpx::parallel::detail::less>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2> &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<hpx::parallel::detail::
+                        multiway_merge_sequence_t<RandIter1>>::value_type,
+                    typename std::iterator_traits<hpx::parallel::detail::
+                        multiway_merge_sequence_t<RandIter1>>::value_type
+                >
+            )
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+            RandIter2>
+        tag_fallback_invoke(multiway_merge_t, ExPolicy&& policy,
+            RandIter1 first_seq, RandIter1 last_seq, RandIter2 dest,
+            Comp comp = Comp())
+        {
+            static_assert(std::random_access_iterator<
+                              hpx::parallel::detail::
+                                  multiway_merge_sequence_t<RandIter1>>,
+                "Requires at least random access iterator.");
+            static_assert(std::random_access_iterator<RandIter2>,
+                "Requires at least random access iterator.");
+
+            return hpx::parallel::detail::multiway_merge<RandIter2>().call(
+                HPX_FORWARD(ExPolicy, policy), first_seq, last_seq, dest,
+                HPX_MOVE(comp), hpx::identity_v);
+        }
+
+        template <typename RandIter1, typename RandIter2,
+            typename Comp = hpx::parallel::detail::less>
+        // clang-format off
+            requires (
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2> &&
+                hpx::is_invocable_v<Comp,
+                    typename std::iterator_traits<hpx::parallel::detail::
+                        multiway_merge_sequence_t<RandIter1>>::value_type,
+                    typename std::iterator_traits<hpx::parallel::detail::
+                        multiway_merge_sequence_t<RandIter1>>::value_type
+                >
+            )
+        // clang-format on
+        friend RandIter2 tag_fallback_invoke(multiway_merge_t,
+            RandIter1 first_seq, RandIter1 last_seq, RandIter2 dest,
+            Comp comp = Comp())
+        {
+            static_assert(std::random_access_iterator<
+                              hpx::parallel::detail::
+                                  multiway_merge_sequence_t<RandIter1>>,
+                "Requires at least random access iterator.");
+            static_assert(std::random_access_iterator<RandIter2>,
+                "Requires at least random access iterator.");
+
+            return hpx::parallel::detail::multiway_merge<RandIter2>().call(
+                hpx::execution::seq, first_seq, last_seq, dest, HPX_MOVE(comp),
+                hpx::identity_v);
+        }
+    } multiway_merge{};
+}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
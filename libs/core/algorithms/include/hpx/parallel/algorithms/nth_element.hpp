@@ -8,7 +8,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 /// \file parallel/algorithms/nth_element.hpp
-/// \page hpx::nth_element
+/// \page hpx::nth_element, hpx::experimental::select_k
 /// \headerfile hpx/algorithm.hpp
 
 #pragma once
@@ -130,6 +130,111 @@ namespace hpx {
     // clang-format on
 }    // namespace hpx
 
+namespace hpx::experimental {
+    // clang-format off
+
+    /// Rearranges the elements in [first, last) such that the \a k smallest
+    /// elements (according to \a pred) end up in [first, first + k) in
+    /// unspecified order, while all remaining elements are placed in
+    /// [first + k, last). None of the elements in [first + k, last) is less
+    /// than any of the elements in [first, first + k).
+    ///
+    /// \note   Complexity: Linear in std::distance(first, last) on average.
+    ///
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Size        The integral type of the number of elements to
+    ///                     select (deduced).
+    /// \tparam Pred        Comparison function object which returns true if
+    ///                     the first argument is less than the second. This
+    ///                     defaults to std::less<>.
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param k            The number of elements to select.
+    /// \param pred         Specifies the comparison function object which
+    ///                     returns true if the first argument is less than
+    ///                     (i.e. is ordered before) the second.
+    ///
+    /// The comparison operations in the \a select_k algorithm invoked
+    /// without an execution policy object execute in sequential order in the
+    /// calling thread.
+    ///
+    /// \returns  The \a select_k algorithm returns \a first + k, or \a last
+    ///           if \a k is not less than the number of elements.
+    ///
+    template <typename RandomIt, typename Size,
+        typename Pred = hpx::parallel::detail::less>
+    RandomIt select_k(RandomIt first, RandomIt last, Size k,
+        Pred&& pred = Pred());
+
+    /// Rearranges the elements in [first, last) such that the \a k smallest
+    /// elements (according to \a pred) end up in [first, first + k) in
+    /// unspecified order, while all remaining elements are placed in
+    /// [first + k, last). None of the elements in [first + k, last) is less
+    /// than any of the elements in [first, first + k). Executed according to
+    /// the policy.
+    ///
+    /// The parallel version selects two pivots from a random sample that
+    /// bracket the requested rank, which usually narrows down the range
+    /// to a small band of candidates after only one or two parallel
+    /// partitioning passes.
+    ///
+    /// \note   Complexity: Linear in std::distance(first, last) on average.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Size        The integral type of the number of elements to
+    ///                     select (deduced).
+    /// \tparam Pred        Comparison function object which returns true if
+    ///                     the first argument is less than the second. This
+    ///                     defaults to std::less<>.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param k            The number of elements to select.
+    /// \param pred         Specifies the comparison function object which
+    ///                     returns true if the first argument is less than
+    ///                     (i.e. is ordered before) the second.
+    ///
+    /// The comparison operations in the parallel \a select_k invoked with
+    /// an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a select_k algorithm invoked with
+    /// an execution policy object of type \a parallel_policy or
+    /// \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a select_k algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a RandomIt otherwise. The iterator refers to
+    ///           \a first + k, or to \a last if \a k is not less than the
+    ///           number of elements.
+    ///
+    template <typename ExPolicy, typename RandomIt, typename Size,
+        typename Pred = hpx::parallel::detail::less>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, RandomIt>
+    select_k(ExPolicy&& policy, RandomIt first, RandomIt last, Size k,
+        Pred&& pred = Pred());
+
+    // clang-format on
+}    // namespace hpx::experimental
+
 #else    // DOXYGEN
 
 #include <hpx/config.hpp>
@@ -141,6 +246,7 @@ namespace hpx {
 #include <hpx/modules/iterator_support.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/pivot.hpp>
+#include <hpx/parallel/algorithms/detail/select.hpp>
 #include <hpx/parallel/algorithms/minmax.hpp>
 #include <hpx/parallel/algorithms/partial_sort.hpp>
 #include <hpx/parallel/algorithms/partition.hpp>
@@ -263,10 +369,7 @@ namespace hpx::parallel {
             parallel(ExPolicy&& policy, RandomIt first, RandomIt nth, Sent last,
                 Pred&& pred, Proj&& proj)
             {
-                using value_type =
-                    typename std::iterator_traits<RandomIt>::value_type;
-
-                RandomIt partition_iter, return_last;
+                RandomIt return_last;
 
                 if (first == last)
                 {
@@ -286,43 +389,8 @@ namespace hpx::parallel {
                         detail::advance_to_sentinel(first, last);
                     return_last = last_iter;
 
-                    while (first != last_iter)
-                    {
-                        detail::pivot9(first, last_iter, pred);
-
-                        partition_iter =
-                            hpx::parallel::detail::partition<RandomIt>().call(
-                                policy(hpx::execution::non_task), first + 1,
-                                last_iter,
-                                [val = HPX_INVOKE(proj, *first), &pred](
-                                    value_type const& elem) {
-                                    return HPX_INVOKE(pred, elem, val);
-                                },
-                                proj);
-
-                        --partition_iter;
-
-                        // swap first element and partitionIter
-                        // (ending element of first group)
-                        std::ranges::iter_swap(first, partition_iter);
-
-                        // if nth element < partitioned index,
-                        // it lies in [first, partitionIter)
-                        if (partition_iter < nth)
-                        {
-                            first = partition_iter + 1;
-                        }
-                        // else it lies in [partitionIter + 1, last)
-                        else if (partition_iter > nth)
-                        {
-                            last_iter = partition_iter;
-                        }
-                        // partitionIter == nth
-                        else
-                        {
-                            break;
-                        }
-                    }
+                    detail::parallel_sampled_select(
+                        policy, first, nth, last_iter, pred, proj);
                 }
                 catch (...)
                 {
@@ -335,6 +403,73 @@ namespace hpx::parallel {
                     HPX_MOVE(return_last));
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // select_k
+        HPX_CXX_CORE_EXPORT template <typename Iter>
+        struct select_k : public algorithm<select_k<Iter>, Iter>
+        {
+            constexpr select_k() noexcept
+              : algorithm<select_k, Iter>("select_k")
+            {
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Size,
+                typename Pred, typename Proj>
+            static constexpr RandomIt sequential(ExPolicy, RandomIt first,
+                RandomIt last, Size k, Pred&& pred, Proj&& proj)
+            {
+                auto const nelem = last - first;
+                if (k <= 0)
+                    return first;
+                if (static_cast<std::size_t>(k) >=
+                    static_cast<std::size_t>(nelem))
+                    return last;
+
+                RandomIt nth = first + k;
+                std::uint32_t level = detail::nbits64(nelem) * 2;
+                detail::nth_element_seq(first, nth, last, level,
+                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Proj, proj));
+
+                return nth;
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Size,
+                typename Pred, typename Proj>
+            static util::detail::algorithm_result_t<ExPolicy, RandomIt>
+            parallel(ExPolicy&& policy, RandomIt first, RandomIt last, Size k,
+                Pred&& pred, Proj&& proj)
+            {
+                auto const nelem = last - first;
+                if (k <= 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        RandomIt>::get(HPX_MOVE(first));
+                }
+                if (static_cast<std::size_t>(k) >=
+                    static_cast<std::size_t>(nelem))
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        RandomIt>::get(HPX_MOVE(last));
+                }
+
+                RandomIt nth = first + k;
+                try
+                {
+                    detail::parallel_sampled_select(
+                        policy, first, nth, last, pred, proj);
+                }
+                catch (...)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        RandomIt>::get(detail::handle_exception<ExPolicy,
+                        RandomIt>::call(std::current_exception()));
+                }
+
+                return util::detail::algorithm_result<ExPolicy, RandomIt>::get(
+                    HPX_MOVE(nth));
+            }
+        };
         /// \endcond
     }    // namespace detail
 }    // namespace hpx::parallel
@@ -398,4 +533,61 @@ namespace hpx {
     } nth_element{};
 }    // namespace hpx
 
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::select_k
+    HPX_CXX_CORE_EXPORT inline constexpr struct select_k_t final
+      : hpx::detail::tag_parallel_algorithm<select_k_t>
+    {
+        template <typename RandomIt, typename Size,
+            typename Pred = hpx::parallel::detail::less>
+        // clang-format off
+            requires (
+                hpx::traits::is_iterator_v<RandomIt> &&
+                std::is_integral_v<Size> &&
+                hpx::is_invocable_v<Pred,
+                    typename std::iterator_traits<RandomIt>::value_type,
+                    typename std::iterator_traits<RandomIt>::value_type
+                >
+            )
+        // clang-format on
+        friend RandomIt tag_fallback_invoke(hpx::experimental::select_k_t,
+            RandomIt first, RandomIt last, Size k, Pred pred = Pred())
+        {
+            static_assert(std::random_access_iterator<RandomIt>,
+                "Requires at least random iterator.");
+
+            return hpx::parallel::detail::select_k<RandomIt>().call(
+                hpx::execution::seq, first, last, k, HPX_MOVE(pred),
+                hpx::identity_v);
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Size,
+            typename Pred = hpx::parallel::detail::less>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandomIt> &&
+                std::is_integral_v<Size> &&
+                hpx::is_invocable_v<Pred,
+                    typename std::iterator_traits<RandomIt>::value_type,
+                    typename std::iterator_traits<RandomIt>::value_type
+                >
+            )
+        // clang-format on
+        friend parallel::util::detail::algorithm_result_t<ExPolicy, RandomIt>
+        tag_fallback_invoke(hpx::experimental::select_k_t, ExPolicy&& policy,
+            RandomIt first, RandomIt last, Size k, Pred pred = Pred())
+        {
+            static_assert(std::random_access_iterator<RandomIt>,
+                "Requires at least random iterator.");
+
+            return hpx::parallel::detail::select_k<RandomIt>().call(
+                HPX_FORWARD(ExPolicy, policy), first, last, k, HPX_MOVE(pred),
+                hpx::identity_v);
+        }
+    } select_k{};
+}    // namespace hpx::experimental
+
 #endif
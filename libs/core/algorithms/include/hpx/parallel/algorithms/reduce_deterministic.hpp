@@ -397,11 +397,7 @@ namespace hpx::parallel {
             static constexpr T sequential(ExPolicy&& policy, InIterB first,
                 InIterE last, T_&& init, Reduce&& r)
             {
-                // TODO: abstract initializing memory
-                hpx::parallel::detail::rfa::RFA_bins<T_> bins;
-                bins.initialize_bins();
-                std::memcpy(hpx::parallel::detail::rfa::hpx_rfa_bin_host_buffer,
-                    &bins, sizeof(bins));
+                hpx::parallel::detail::initialize_rfa_bins<T_>();
                 return hpx::parallel::detail::sequential_reduce_deterministic<
                     ExPolicy>(HPX_FORWARD(ExPolicy, policy), first, last,
                     HPX_FORWARD(T_, init), HPX_FORWARD(Reduce, r));
@@ -419,11 +415,7 @@ namespace hpx::parallel {
                         HPX_FORWARD(T_, init));
                 }
 
-                // TODO: abstract initializing memory
-                hpx::parallel::detail::rfa::RFA_bins<T_> bins;
-                bins.initialize_bins();
-                std::memcpy(hpx::parallel::detail::rfa::hpx_rfa_bin_host_buffer,
-                    &bins, sizeof(bins));
+                hpx::parallel::detail::initialize_rfa_bins<T_>();
 
                 auto f1 = [policy](FwdIterB part_begin, std::size_t part_size)
                     -> hpx::parallel::detail::rfa::
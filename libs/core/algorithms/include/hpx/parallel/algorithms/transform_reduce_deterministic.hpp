@@ -0,0 +1,492 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/transform_reduce_deterministic.hpp
+/// \page hpx::experimental::transform_reduce_deterministic
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+namespace hpx::experimental {
+    // clang-format off
+
+    /// Returns the sum of \a init and conv(*it) for each iterator it in the
+    /// range [first, last). The sum is computed using reproducible
+    /// floating-point accumulators: the result is bitwise identical
+    /// independently of the execution policy, the number of threads and the
+    /// chunking of the input range. Executed according to the policy.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of \a conv.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced). This has to be a
+    ///                     floating point type.
+    /// \tparam Convert     The type of the unary function object used to
+    ///                     transform the elements of the input sequence
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param init         The initial value for the generalized sum.
+    /// \param conv         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last). The result of
+    ///                     this function is converted to \a T before it is
+    ///                     accumulated.
+    ///
+    /// \returns  The \a transform_reduce_deterministic algorithm returns a
+    ///           \a hpx::future<T> if the execution policy is of type
+    ///           \a parallel_task_policy and returns \a T otherwise.
+    ///
+    template <typename ExPolicy, typename FwdIter, typename T,
+        typename Convert>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, T>
+    transform_reduce_deterministic(ExPolicy&& policy, FwdIter first,
+        FwdIter last, T init, Convert&& conv);
+
+    /// Returns the sum of \a init and conv(*it) for each iterator it in the
+    /// range [first, last). The sum is computed using reproducible
+    /// floating-point accumulators.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of \a conv.
+    ///
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced). This has to be a
+    ///                     floating point type.
+    /// \tparam Convert     The type of the unary function object used to
+    ///                     transform the elements of the input sequence
+    ///                     (deduced).
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param init         The initial value for the generalized sum.
+    /// \param conv         Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence specified by [first, last).
+    ///
+    /// \returns  The \a transform_reduce_deterministic algorithm returns \a T.
+    ///
+    template <typename FwdIter, typename T, typename Convert>
+    T transform_reduce_deterministic(
+        FwdIter first, FwdIter last, T init, Convert&& conv);
+
+    /// Returns the sum of \a init and conv(*it1, *it2) for each pair of
+    /// iterators (it1, it2) in the ranges [first1, last1) and
+    /// [first2, first2 + (last1 - first1)). If \a conv is not given, the
+    /// products of the elements are summed (inner product). The sum is
+    /// computed using reproducible floating-point accumulators: the result
+    /// is bitwise identical independently of the execution policy, the
+    /// number of threads and the chunking of the input range. Executed
+    /// according to the policy.
+    ///
+    /// \note   Complexity: O(\a last1 - \a first1) applications of \a conv.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam FwdIter1    The type of the first source iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a forward iterator.
+    /// \tparam FwdIter2    The type of the second source iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a forward iterator.
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced). This has to be a
+    ///                     floating point type.
+    /// \tparam Convert     The type of the binary function object used to
+    ///                     combine the elements of the two input sequences
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first1       Refers to the beginning of the first sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param last1        Refers to the end of the first sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param first2       Refers to the beginning of the second sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param init         The initial value for the generalized sum.
+    /// \param conv         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements of the
+    ///                     two input sequences, defaults to std::multiplies.
+    ///
+    /// \returns  The \a transform_reduce_deterministic algorithm returns a
+    ///           \a hpx::future<T> if the execution policy is of type
+    ///           \a parallel_task_policy and returns \a T otherwise.
+    ///
+    template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+        typename T, typename Convert = std::multiplies<>>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, T>
+    transform_reduce_deterministic(ExPolicy&& policy, FwdIter1 first1,
+        FwdIter1 last1, FwdIter2 first2, T init, Convert&& conv = Convert());
+
+    /// Returns the sum of \a init and conv(*it1, *it2) for each pair of
+    /// iterators (it1, it2) in the ranges [first1, last1) and
+    /// [first2, first2 + (last1 - first1)). If \a conv is not given, the
+    /// products of the elements are summed (inner product). The sum is
+    /// computed using reproducible floating-point accumulators.
+    ///
+    /// \note   Complexity: O(\a last1 - \a first1) applications of \a conv.
+    ///
+    /// \tparam FwdIter1    The type of the first source iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a forward iterator.
+    /// \tparam FwdIter2    The type of the second source iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a forward iterator.
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced). This has to be a
+    ///                     floating point type.
+    /// \tparam Convert     The type of the binary function object used to
+    ///                     combine the elements of the two input sequences
+    ///                     (deduced).
+    ///
+    /// \param first1       Refers to the beginning of the first sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param last1        Refers to the end of the first sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param first2       Refers to the beginning of the second sequence of
+    ///                     elements the algorithm will be applied to.
+    /// \param init         The initial value for the generalized sum.
+    /// \param conv         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements of the
+    ///                     two input sequences, defaults to std::multiplies.
+    ///
+    /// \returns  The \a transform_reduce_deterministic algorithm returns \a T.
+    ///
+    template <typename FwdIter1, typename FwdIter2, typename T,
+        typename Convert = std::multiplies<>>
+    T transform_reduce_deterministic(FwdIter1 first1, FwdIter1 last1,
+        FwdIter2 first2, T init, Convert&& conv = Convert());
+
+    // clang-format on
+}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/modules/pack_traversal.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/reduce_deterministic.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/zip_iterator.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+    HPX_CXX_CORE_EXPORT template <typename T>
+    using rfa_accumulator_t =
+        hpx::parallel::detail::rfa::reproducible_floating_accumulator<T>;
+
+    // combine the partial results of all chunks, the order in which the
+    // accumulators are added does not influence the result
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct combine_deterministic_results
+    {
+        T init;
+
+        template <typename Results>
+        T operator()(Results&& results) const
+        {
+            rfa_accumulator_t<T> rfa;
+            rfa.zero();
+            rfa += init;
+            for (auto&& result : results)
+            {
+                rfa += hpx::unwrap(result);
+            }
+            return rfa.conv();
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct transform_reduce_deterministic
+      : public algorithm<transform_reduce_deterministic<T>, T>
+    {
+        constexpr transform_reduce_deterministic() noexcept
+          : algorithm<transform_reduce_deterministic, T>(
+                "transform_reduce_deterministic")
+        {
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent,
+            typename Convert>
+        static T sequential(
+            ExPolicy&&, Iter first, Sent last, T init, Convert&& conv)
+        {
+            detail::initialize_rfa_bins<T>();
+
+            rfa_accumulator_t<T> rfa;
+            rfa.zero();
+            rfa += init;
+
+            detail::accumulate_deterministic(rfa, first,
+                detail::distance(first, last),
+                [&](Iter it) { return HPX_INVOKE(conv, *it); });
+
+            return rfa.conv();
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent,
+            typename Convert>
+        static decltype(auto) parallel(ExPolicy&& policy, Iter first,
+            Sent last, T init, Convert&& conv)
+        {
+            constexpr bool has_scheduler_executor =
+                hpx::execution_policy_has_scheduler_executor_v<ExPolicy>;
+
+            if constexpr (!has_scheduler_executor)
+            {
+                if (first == last)
+                {
+                    return util::detail::algorithm_result<ExPolicy, T>::get(
+                        HPX_MOVE(init));
+                }
+            }
+
+            detail::initialize_rfa_bins<T>();
+
+            auto f1 = [conv = HPX_FORWARD(Convert, conv)](Iter part_begin,
+                          std::size_t part_size) -> rfa_accumulator_t<T> {
+                rfa_accumulator_t<T> rfa;
+                rfa.zero();
+                detail::accumulate_deterministic(rfa, part_begin, part_size,
+                    [&](Iter it) { return HPX_INVOKE(conv, *it); });
+                return rfa;
+            };
+
+            return util::partitioner<ExPolicy, T, rfa_accumulator_t<T>>::call(
+                HPX_FORWARD(ExPolicy, policy), first,
+                detail::distance(first, last), HPX_MOVE(f1),
+                combine_deterministic_results<T>{init});
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct transform_reduce_binary_deterministic
+      : public algorithm<transform_reduce_binary_deterministic<T>, T>
+    {
+        constexpr transform_reduce_binary_deterministic() noexcept
+          : algorithm<transform_reduce_binary_deterministic, T>(
+                "transform_reduce_binary_deterministic")
+        {
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent,
+            typename Iter2, typename Convert>
+        static T sequential(ExPolicy&&, Iter first1, Sent last1, Iter2 first2,
+            T init, Convert&& conv)
+        {
+            using zip_iterator = hpx::util::zip_iterator<Iter, Iter2>;
+
+            detail::initialize_rfa_bins<T>();
+
+            rfa_accumulator_t<T> rfa;
+            rfa.zero();
+            rfa += init;
+
+            detail::accumulate_deterministic(rfa,
+                zip_iterator(first1, first2), detail::distance(first1, last1),
+                [&](zip_iterator it) {
+                    auto iters = it.get_iterator_tuple();
+                    return HPX_INVOKE(
+                        conv, *hpx::get<0>(iters), *hpx::get<1>(iters));
+                });
+
+            return rfa.conv();
+        }
+
+        template <typename ExPolicy, typename Iter, typename Sent,
+            typename Iter2, typename Convert>
+        static decltype(auto) parallel(ExPolicy&& policy, Iter first1,
+            Sent last1, Iter2 first2, T init, Convert&& conv)
+        {
+            using zip_iterator = hpx::util::zip_iterator<Iter, Iter2>;
+            constexpr bool has_scheduler_executor =
+                hpx::execution_policy_has_scheduler_executor_v<ExPolicy>;
+
+            if constexpr (!has_scheduler_executor)
+            {
+                if (first1 == last1)
+                {
+                    return util::detail::algorithm_result<ExPolicy, T>::get(
+                        HPX_MOVE(init));
+                }
+            }
+
+            detail::initialize_rfa_bins<T>();
+
+            auto f1 = [conv = HPX_FORWARD(Convert, conv)](
+                          zip_iterator part_begin,
+                          std::size_t part_size) -> rfa_accumulator_t<T> {
+                rfa_accumulator_t<T> rfa;
+                rfa.zero();
+                detail::accumulate_deterministic(rfa, part_begin, part_size,
+                    [&](zip_iterator it) {
+                        auto iters = it.get_iterator_tuple();
+                        return HPX_INVOKE(
+                            conv, *hpx::get<0>(iters), *hpx::get<1>(iters));
+                    });
+                return rfa;
+            };
+
+            return util::partitioner<ExPolicy, T, rfa_accumulator_t<T>>::call(
+                HPX_FORWARD(ExPolicy, policy), zip_iterator(first1, first2),
+                detail::distance(first1, last1), HPX_MOVE(f1),
+                combine_deterministic_results<T>{init});
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::transform_reduce_deterministic
+    HPX_CXX_CORE_EXPORT inline constexpr struct transform_reduce_deterministic_t
+        final
+      : hpx::detail::tag_parallel_algorithm<transform_reduce_deterministic_t>
+    {
+    private:
+        template <typename ExPolicy, typename FwdIter, typename T,
+            typename Convert>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<FwdIter> &&
+                std::is_floating_point_v<T> &&
+                hpx::is_invocable_v<Convert,
+                    typename std::iterator_traits<FwdIter>::value_type
+                >
+            )
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy, T>
+        tag_fallback_invoke(hpx::experimental::transform_reduce_deterministic_t,
+            ExPolicy&& policy, FwdIter first, FwdIter last, T init,
+            Convert conv)
+        {
+            static_assert(std::forward_iterator<FwdIter>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::detail::transform_reduce_deterministic<T>()
+                .call(HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_MOVE(init), HPX_MOVE(conv));
+        }
+
+        template <typename FwdIter, typename T, typename Convert>
+        // clang-format off
+            requires (
+                hpx::traits::is_iterator_v<FwdIter> &&
+                std::is_floating_point_v<T> &&
+                hpx::is_invocable_v<Convert,
+                    typename std::iterator_traits<FwdIter>::value_type
+                >
+            )
+        // clang-format on
+        friend T tag_fallback_invoke(
+            hpx::experimental::transform_reduce_deterministic_t, FwdIter first,
+            FwdIter last, T init, Convert conv)
+        {
+            static_assert(std::forward_iterator<FwdIter>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::detail::transform_reduce_deterministic<T>()
+                .call(hpx::execution::seq, first, last, HPX_MOVE(init),
+                    HPX_MOVE(conv));
+        }
+
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename T, typename Convert = std::multiplies<>>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<FwdIter1> &&
+                hpx::traits::is_iterator_v<FwdIter2> &&
+                std::is_floating_point_v<T> &&
+                hpx::is_invocable_v<Convert,
+                    typename std::iterator_traits<FwdIter1>::value_type,
+                    typename std::iterator_traits<FwdIter2>::value_type
+                >
+            )
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy, T>
+        tag_fallback_invoke(hpx::experimental::transform_reduce_deterministic_t,
+            ExPolicy&& policy, FwdIter1 first1, FwdIter1 last1,
+            FwdIter2 first2, T init, Convert conv = Convert())
+        {
+            static_assert(std::forward_iterator<FwdIter1> &&
+                    std::forward_iterator<FwdIter2>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::detail::
+                transform_reduce_binary_deterministic<T>()
+                    .call(HPX_FORWARD(ExPolicy, policy), first1, last1, first2,
+                        HPX_MOVE(init), HPX_MOVE(conv));
+        }
+
+        template <typename FwdIter1, typename FwdIter2, typename T,
+            typename Convert = std::multiplies<>>
+        // clang-format off
+            requires (
+                hpx::traits::is_iterator_v<FwdIter1> &&
+                hpx::traits::is_iterator_v<FwdIter2> &&
+                std::is_floating_point_v<T> &&
+                hpx::is_invocable_v<Convert,
+                    typename std::iterator_traits<FwdIter1>::value_type,
+                    typename std::iterator_traits<FwdIter2>::value_type
+                >
+            )
+        // clang-format on
+        friend T tag_fallback_invoke(
+            hpx::experimental::transform_reduce_deterministic_t,
+            FwdIter1 first1, FwdIter1 last1, FwdIter2 first2, T init,
+            Convert conv = Convert())
+        {
+            static_assert(std::forward_iterator<FwdIter1> &&
+                    std::forward_iterator<FwdIter2>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::detail::
+                transform_reduce_binary_deterministic<T>()
+                    .call(hpx::execution::seq, first1, last1, first2,
+                        HPX_MOVE(init), HPX_MOVE(conv));
+        }
+    } transform_reduce_deterministic{};
+}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
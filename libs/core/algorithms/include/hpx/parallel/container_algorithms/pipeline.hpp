@@ -0,0 +1,875 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/pipeline.hpp
+/// \page hpx::experimental::views::transform, hpx::experimental::views::filter, hpx::experimental::views::zip, hpx::experimental::fused_for_each, hpx::experimental::fused_copy, hpx::experimental::fused_reduce
+/// \headerfile hpx/algorithm.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx::experimental {
+    // clang-format off
+
+    namespace views {
+
+        /// Creates a lazy pipeline stage which replaces every element by the
+        /// result of invoking \a f on it. A stage is attached to a range (or
+        /// to another pipeline) using operator|, e.g.
+        /// \code
+        /// auto view = v | views::transform(f) | views::filter(pred);
+        /// \endcode
+        /// Nothing is evaluated until the pipeline is passed to one of the
+        /// fused algorithms (\a fused_for_each, \a fused_copy,
+        /// \a fused_reduce), which execute all stages in a single pass over
+        /// the source range. The pipeline refers to the source range, which
+        /// has to outlive it.
+        ///
+        /// \tparam F   The type of the function object (deduced). It has to be
+        ///             invocable through a const reference and must not have
+        ///             side effects, as the elements may be processed
+        ///             concurrently and in any order.
+        ///
+        /// \param f    The function to apply to each element.
+        ///
+        /// \returns    A pipeline stage object.
+        ///
+        template <typename F>
+        unspecified transform(F&& f);
+
+        /// Creates a lazy pipeline stage which drops every element for which
+        /// \a pred returns false. See \a views::transform for how stages are
+        /// composed and evaluated.
+        ///
+        /// \tparam Pred    The type of the predicate (deduced). It has to be
+        ///                 invocable through a const reference and must not
+        ///                 have side effects.
+        ///
+        /// \param pred     The predicate deciding which elements to keep.
+        ///
+        /// \returns    A pipeline stage object.
+        ///
+        template <typename Pred>
+        unspecified filter(Pred&& pred);
+
+        /// Creates a range of tuples of references to the corresponding
+        /// elements of the given ranges, based on \a hpx::util::zip_iterator.
+        /// The length of the resulting range is the length of the shortest
+        /// of the given ranges. The result can be used as the source of a
+        /// pipeline.
+        ///
+        /// \tparam Rngs    The types of the source ranges (deduced). Each of
+        ///                 them has to be a sized range which is not a
+        ///                 temporary container.
+        ///
+        /// \param rngs     The ranges to zip.
+        ///
+        /// \returns    A \a hpx::util::iterator_range of
+        ///             \a hpx::util::zip_iterator.
+        ///
+        template <typename... Rngs>
+        hpx::util::iterator_range<hpx::util::zip_iterator<
+            std::ranges::iterator_t<Rngs>...>>
+        zip(Rngs&&... rngs);
+    }    // namespace views
+
+    /// Invokes \a f for every element produced by the given pipeline. All
+    /// pipeline stages are evaluated in a single pass over the source range,
+    /// executed according to the policy.
+    ///
+    /// \note   Complexity: Evaluates each stage at most once per element of
+    ///         the source range.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam View        The type of the pipeline (deduced).
+    /// \tparam F           The type of the function to invoke (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param view         The pipeline created by attaching stages to a
+    ///                     source range.
+    /// \param f            The function to invoke for every element produced
+    ///                     by the pipeline.
+    ///
+    /// \returns  The \a fused_for_each algorithm returns a \a hpx::future<void>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a void otherwise.
+    ///
+    template <typename ExPolicy, typename View, typename F>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+    fused_for_each(ExPolicy&& policy, View const& view, F&& f);
+
+    /// Copies every element produced by the given pipeline to the range
+    /// starting at \a dest, preserving their order. All pipeline stages are
+    /// evaluated during one partitioned execution. If the pipeline contains a
+    /// \a views::filter stage, every chunk first evaluates the stages for its
+    /// elements and counts the produced ones, the counts are scanned to
+    /// obtain the output position of each chunk, and the chunks then write
+    /// their elements in parallel (stream compaction). The produced elements
+    /// are kept in a temporary buffer between these steps.
+    ///
+    /// \note   Complexity: Evaluates each stage at most once per element of
+    ///         the source range.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam View        The type of the pipeline (deduced).
+    /// \tparam FwdIter     The type of the destination iterator (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param view         The pipeline created by attaching stages to a
+    ///                     source range.
+    /// \param dest         Refers to the beginning of the destination range.
+    ///
+    /// \returns  The \a fused_copy algorithm returns a \a hpx::future<FwdIter>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a FwdIter otherwise.
+    ///           The iterator refers to the element past the last element
+    ///           written.
+    ///
+    template <typename ExPolicy, typename View, typename FwdIter>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, FwdIter>
+    fused_copy(ExPolicy&& policy, View const& view, FwdIter dest);
+
+    /// Returns GENERALIZED_SUM(op, init, e...), where e... are the elements
+    /// produced by the given pipeline. All pipeline stages and the reduction
+    /// are evaluated in a single pass over the source range, executed
+    /// according to the policy.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    /// \tparam View        The type of the pipeline (deduced).
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced).
+    /// \tparam Op          The type of the binary reduction operation
+    ///                     (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param view         The pipeline created by attaching stages to a
+    ///                     source range.
+    /// \param init         The initial value for the generalized sum.
+    /// \param op           Specifies the associative and commutative binary
+    ///                     operation used to combine the elements.
+    ///
+    /// \returns  The \a fused_reduce algorithm returns a \a hpx::future<T> if
+    ///           the execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a T otherwise.
+    ///
+    template <typename ExPolicy, typename View, typename T,
+        typename Op = std::plus<>>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, T>
+    fused_reduce(ExPolicy&& policy, View const& view, T init, Op&& op = Op());
+
+    // clang-format on
+}    // namespace hpx::experimental
+
+#else
+
+#include <hpx/config.hpp>
+#include <hpx/modules/datastructures.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/modules/pack_traversal.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/clear_container.hpp>
+#include <hpx/parallel/util/foreach_partitioner.hpp>
+#include <hpx/parallel/util/loop.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+#include <hpx/parallel/util/scan_partitioner.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The type of the element leaving the given stages if an element of type T
+    // is pushed through them.
+    HPX_CXX_CORE_EXPORT template <typename T, typename... Stages>
+    struct pipeline_result
+    {
+        using type = T;
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename T, typename Stage,
+        typename... Stages>
+    struct pipeline_result<T, Stage, Stages...>
+      : pipeline_result<typename Stage::template result_type<T>, Stages...>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A lazily composed pipeline: a source range [first, last) and a list of
+    // stages. Every element of the source range is pushed through all stages
+    // in order, each stage invokes the next one for every element it
+    // produces (transform produces exactly one element, filter zero or one).
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Sent,
+        typename... Stages>
+    class fused_view
+    {
+    public:
+        using iterator = Iter;
+        using sentinel = Sent;
+
+        // the type of the elements produced by the pipeline
+        using value_type = std::decay_t<typename pipeline_result<
+            std::iter_reference_t<Iter>, Stages...>::type>;
+
+        // whether the number of produced elements can differ from the size
+        // of the source range
+        static constexpr bool is_filtering = (Stages::is_filtering || ...);
+
+        constexpr fused_view(
+            Iter first, Sent last, hpx::tuple<Stages...> stages)
+          : first_(HPX_MOVE(first))
+          , last_(HPX_MOVE(last))
+          , stages_(HPX_MOVE(stages))
+        {
+        }
+
+        [[nodiscard]] constexpr Iter begin() const
+        {
+            return first_;
+        }
+
+        [[nodiscard]] constexpr Sent end() const
+        {
+            return last_;
+        }
+
+        [[nodiscard]] constexpr hpx::tuple<Stages...> const& stages()
+            const noexcept
+        {
+            return stages_;
+        }
+
+        // push the given source element through all stages, sink is invoked
+        // for every element leaving the last stage
+        template <typename T, typename Sink>
+        HPX_FORCEINLINE constexpr void push(T&& value, Sink&& sink) const
+        {
+            push_stage<0>(HPX_FORWARD(T, value), sink);
+        }
+
+    private:
+        template <std::size_t I, typename T, typename Sink>
+        HPX_FORCEINLINE constexpr void push_stage(T&& value, Sink& sink) const
+        {
+            if constexpr (I == sizeof...(Stages))
+            {
+                HPX_INVOKE(sink, HPX_FORWARD(T, value));
+            }
+            else
+            {
+                hpx::get<I>(stages_).apply(
+                    HPX_FORWARD(T, value), [this, &sink](auto&& next) {
+                        this->template push_stage<I + 1>(
+                            HPX_FORWARD(decltype(next), next), sink);
+                    });
+            }
+        }
+
+        Iter first_;
+        Sent last_;
+        hpx::tuple<Stages...> stages_;
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct is_fused_view : std::false_type
+    {
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Sent,
+        typename... Stages>
+    struct is_fused_view<fused_view<Iter, Sent, Stages...>> : std::true_type
+    {
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename T>
+    inline constexpr bool is_fused_view_v =
+        is_fused_view<std::decay_t<T>>::value;
+
+    // A pipeline refers to its source range, which therefore must not be a
+    // temporary container.
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct is_pipeline_source : std::bool_constant<std::ranges::range<T> &&
+                                    std::ranges::borrowed_range<T>>
+    {
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename Iter, typename Sent>
+    struct is_pipeline_source<hpx::util::iterator_range<Iter, Sent>>
+      : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Common base of all stages, provides the composition operators.
+    HPX_CXX_CORE_EXPORT template <typename Derived>
+    struct pipeline_stage
+    {
+        // range | stage
+        template <typename Rng>
+        // clang-format off
+            requires (
+                !is_fused_view_v<Rng> &&
+                is_pipeline_source<std::remove_cv_t<Rng>>::value
+            )
+        // clang-format on
+        friend constexpr auto operator|(Rng&& rng, Derived stage)
+        {
+            using iterator = std::ranges::iterator_t<Rng>;
+            using sentinel = std::ranges::sentinel_t<Rng>;
+
+            return fused_view<iterator, sentinel, Derived>(hpx::util::begin(rng),
+                hpx::util::end(rng), hpx::tuple<Derived>(HPX_MOVE(stage)));
+        }
+
+        // pipeline | stage
+        template <typename Iter, typename Sent, typename... Stages>
+        friend constexpr auto operator|(
+            fused_view<Iter, Sent, Stages...> const& view, Derived stage)
+        {
+            return fused_view<Iter, Sent, Stages..., Derived>(view.begin(),
+                view.end(),
+                hpx::tuple_cat(
+                    view.stages(), hpx::tuple<Derived>(HPX_MOVE(stage))));
+        }
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename F>
+    struct pipeline_transform_stage
+      : pipeline_stage<pipeline_transform_stage<F>>
+    {
+        static constexpr bool is_filtering = false;
+
+        template <typename T>
+        using result_type = hpx::util::invoke_result_t<F const&, T>;
+
+        template <typename F_>
+        explicit constexpr pipeline_transform_stage(F_&& f)
+          : f_(HPX_FORWARD(F_, f))
+        {
+        }
+
+        template <typename T, typename Next>
+        HPX_FORCEINLINE constexpr void apply(T&& value, Next&& next) const
+        {
+            next(HPX_INVOKE(f_, HPX_FORWARD(T, value)));
+        }
+
+        F f_;
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename Pred>
+    struct pipeline_filter_stage
+      : pipeline_stage<pipeline_filter_stage<Pred>>
+    {
+        static constexpr bool is_filtering = true;
+
+        template <typename T>
+        using result_type = T;
+
+        template <typename Pred_>
+        explicit constexpr pipeline_filter_stage(Pred_&& pred)
+          : pred_(HPX_FORWARD(Pred_, pred))
+        {
+        }
+
+        template <typename T, typename Next>
+        HPX_FORCEINLINE constexpr void apply(T&& value, Next&& next) const
+        {
+            if (HPX_INVOKE(pred_, std::as_const(value)))
+            {
+                next(HPX_FORWARD(T, value));
+            }
+        }
+
+        Pred pred_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // fused_for_each
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename View,
+        typename F>
+    struct fused_for_each_iteration
+    {
+        View view_;
+        F f_;
+
+        template <typename Iter>
+        HPX_FORCEINLINE constexpr void operator()(
+            Iter part_begin, std::size_t part_size, std::size_t)
+        {
+            util::loop_n<std::decay_t<ExPolicy>>(part_begin, part_size,
+                [this](Iter it) { view_.push(*it, f_); });
+        }
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename Iter>
+    struct fused_for_each : public algorithm<fused_for_each<Iter>, Iter>
+    {
+        constexpr fused_for_each() noexcept
+          : algorithm<fused_for_each, Iter>("fused_for_each")
+        {
+        }
+
+        template <typename ExPolicy, typename View, typename F>
+        static constexpr Iter sequential(ExPolicy, View const& view, F&& f)
+        {
+            auto const last = view.end();
+            Iter it = view.begin();
+            for (/**/; it != last; ++it)
+            {
+                view.push(*it, f);
+            }
+            return it;
+        }
+
+        template <typename ExPolicy, typename View, typename F>
+        static decltype(auto) parallel(
+            ExPolicy&& policy, View const& view, F&& f)
+        {
+            Iter first = view.begin();
+            std::size_t const count = detail::distance(first, view.end());
+
+            if constexpr (!hpx::execution_policy_has_scheduler_executor_v<
+                              ExPolicy>)
+            {
+                if (count == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy,
+                        Iter>::get(HPX_MOVE(first));
+                }
+            }
+
+            return util::foreach_partitioner<ExPolicy>::call(
+                HPX_FORWARD(ExPolicy, policy), first, count,
+                fused_for_each_iteration<ExPolicy, View, std::decay_t<F>>{
+                    view, HPX_FORWARD(F, f)},
+                hpx::identity_v);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // fused_copy
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy, typename View,
+        typename OutIter>
+    struct fused_copy_iteration
+    {
+        View view_;
+        OutIter dest_;
+
+        template <typename Iter>
+        HPX_FORCEINLINE constexpr void operator()(
+            Iter part_begin, std::size_t part_size, std::size_t base_idx)
+        {
+            OutIter out = std::next(dest_, base_idx);
+            util::loop_n<std::decay_t<ExPolicy>>(
+                part_begin, part_size, [&](Iter it) {
+                    view_.push(*it, [&out](auto&& value) {
+                        *out = HPX_FORWARD(decltype(value), value);
+                        ++out;
+                    });
+                });
+        }
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename OutIter>
+    struct fused_copy : public algorithm<fused_copy<OutIter>, OutIter>
+    {
+        constexpr fused_copy() noexcept
+          : algorithm<fused_copy, OutIter>("fused_copy")
+        {
+        }
+
+        template <typename ExPolicy, typename View>
+        static constexpr OutIter sequential(
+            ExPolicy, View const& view, OutIter dest)
+        {
+            auto const last = view.end();
+            for (auto it = view.begin(); it != last; ++it)
+            {
+                view.push(*it, [&dest](auto&& value) {
+                    *dest = HPX_FORWARD(decltype(value), value);
+                    ++dest;
+                });
+            }
+            return dest;
+        }
+
+        template <typename ExPolicy, typename View>
+        static decltype(auto) parallel(
+            ExPolicy&& policy, View const& view, OutIter dest)
+        {
+            using iterator = typename View::iterator;
+            using result = util::detail::algorithm_result<ExPolicy, OutIter>;
+
+            iterator first = view.begin();
+            std::size_t const count = detail::distance(first, view.end());
+
+            if constexpr (!hpx::execution_policy_has_scheduler_executor_v<
+                              ExPolicy>)
+            {
+                if (count == 0)
+                {
+                    return result::get(HPX_MOVE(dest));
+                }
+            }
+
+            if constexpr (!View::is_filtering)
+            {
+                // every source element produces exactly one element, each
+                // chunk knows its output position up front
+                return util::foreach_partitioner<ExPolicy>::call(
+                    HPX_FORWARD(ExPolicy, policy), first, count,
+                    fused_copy_iteration<ExPolicy, View, OutIter>{view, dest},
+                    [dest, count](iterator const&) {
+                        return std::next(dest, count);
+                    });
+            }
+            else
+            {
+                // stream compaction: every chunk evaluates the pipeline for
+                // its elements once, keeping the produced ones (at most one
+                // per source element) in a buffer and counting them. The
+                // counts are scanned, then every chunk moves its elements to
+                // the output starting at its offset.
+                using buffer_type = hpx::optional<typename View::value_type>;
+                using zip_iterator =
+                    hpx::util::zip_iterator<iterator, buffer_type*>;
+
+                std::shared_ptr<buffer_type[]> produced(new buffer_type[count]);
+
+                auto f1 = [view](zip_iterator part_begin,
+                              std::size_t part_size) -> std::size_t {
+                    std::size_t curr = 0;
+                    util::loop_n<std::decay_t<ExPolicy>>(
+                        part_begin, part_size, [&](zip_iterator it) {
+                            auto&& t = *it;
+                            view.push(hpx::get<0>(t), [&](auto&& value) {
+                                hpx::get<1>(t).emplace(
+                                    HPX_FORWARD(decltype(value), value));
+                                ++curr;
+                            });
+                        });
+                    return curr;
+                };
+
+                auto f3 = [dest, produced](zip_iterator part_begin,
+                              std::size_t part_size, std::size_t offset) {
+                    HPX_UNUSED(produced);
+                    OutIter out = std::next(dest, offset);
+                    util::loop_n<std::decay_t<ExPolicy>>(
+                        part_begin, part_size, [&](zip_iterator it) {
+                            if (auto& value = hpx::get<1>(*it))
+                            {
+                                *out = HPX_MOVE(*value);
+                                ++out;
+                            }
+                        });
+                };
+
+                auto f4 = [dest, produced](std::vector<std::size_t>&& items,
+                              std::vector<hpx::future<void>>&& data) mutable
+                    -> OutIter {
+                    HPX_UNUSED(produced);
+                    std::advance(dest, items.back());
+
+                    // make sure iterators embedded in function object that is
+                    // attached to futures are invalidated
+                    util::detail::clear_container(data);
+
+                    return dest;
+                };
+
+                return util::scan_partitioner<ExPolicy, OutIter,
+                    std::size_t>::call(HPX_FORWARD(ExPolicy, policy),
+                    zip_iterator(first, produced.get()), count,
+                    static_cast<std::size_t>(0), HPX_MOVE(f1),
+                    std::plus<std::size_t>(), HPX_MOVE(f3), HPX_MOVE(f4));
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // fused_reduce
+    HPX_CXX_CORE_EXPORT template <typename T>
+    struct fused_reduce : public algorithm<fused_reduce<T>, T>
+    {
+        constexpr fused_reduce() noexcept
+          : algorithm<fused_reduce, T>("fused_reduce")
+        {
+        }
+
+        template <typename ExPolicy, typename View, typename T_,
+            typename Reduce>
+        static constexpr T sequential(
+            ExPolicy, View const& view, T_&& init, Reduce&& r)
+        {
+            T result = HPX_FORWARD(T_, init);
+            auto const last = view.end();
+            for (auto it = view.begin(); it != last; ++it)
+            {
+                view.push(*it, [&](auto&& value) {
+                    result = HPX_INVOKE(r, HPX_MOVE(result),
+                        HPX_FORWARD(decltype(value), value));
+                });
+            }
+            return result;
+        }
+
+        template <typename ExPolicy, typename View, typename T_,
+            typename Reduce>
+        static decltype(auto) parallel(
+            ExPolicy&& policy, View const& view, T_&& init, Reduce&& r)
+        {
+            using iterator = typename View::iterator;
+
+            iterator first = view.begin();
+            std::size_t const count = detail::distance(first, view.end());
+
+            if constexpr (!hpx::execution_policy_has_scheduler_executor_v<
+                              ExPolicy>)
+            {
+                if (count == 0)
+                {
+                    return util::detail::algorithm_result<ExPolicy, T>::get(
+                        HPX_FORWARD(T_, init));
+                }
+            }
+
+            // a chunk may not produce any element if the pipeline filters
+            auto f1 = [view, r](iterator part_begin,
+                          std::size_t part_size) -> hpx::optional<T> {
+                hpx::optional<T> partial;
+                util::loop_n<std::decay_t<ExPolicy>>(
+                    part_begin, part_size, [&](iterator it) {
+                        view.push(*it, [&](auto&& value) {
+                            if (partial)
+                            {
+                                *partial = HPX_INVOKE(r, HPX_MOVE(*partial),
+                                    HPX_FORWARD(decltype(value), value));
+                            }
+                            else
+                            {
+                                partial.emplace(
+                                    HPX_FORWARD(decltype(value), value));
+                            }
+                        });
+                    });
+                return partial;
+            };
+
+            return util::partitioner<ExPolicy, T, hpx::optional<T>>::call(
+                HPX_FORWARD(ExPolicy, policy), first, count, HPX_MOVE(f1),
+                hpx::unwrapping(
+                    [init = HPX_FORWARD(T_, init),
+                        r = HPX_FORWARD(Reduce, r)](auto&& results) -> T {
+                        T result = init;
+                        for (auto& partial : results)
+                        {
+                            if (partial)
+                            {
+                                result = HPX_INVOKE(
+                                    r, HPX_MOVE(result), HPX_MOVE(*partial));
+                            }
+                        }
+                        return result;
+                    }));
+        }
+    };
+    /// \endcond
+}    // namespace hpx::parallel::detail
+
+namespace hpx::experimental {
+
+    namespace views {
+
+        HPX_CXX_CORE_EXPORT template <typename F>
+        constexpr auto transform(F&& f)
+        {
+            return hpx::parallel::detail::pipeline_transform_stage<
+                std::decay_t<F>>(HPX_FORWARD(F, f));
+        }
+
+        HPX_CXX_CORE_EXPORT template <typename Pred>
+        constexpr auto filter(Pred&& pred)
+        {
+            return hpx::parallel::detail::pipeline_filter_stage<
+                std::decay_t<Pred>>(HPX_FORWARD(Pred, pred));
+        }
+
+        HPX_CXX_CORE_EXPORT template <typename... Rngs>
+        // clang-format off
+            requires (
+                sizeof...(Rngs) != 0 &&
+                (std::ranges::sized_range<Rngs> && ...) &&
+                (std::ranges::borrowed_range<Rngs> && ...)
+            )
+        // clang-format on
+        auto zip(Rngs&&... rngs)
+        {
+            using zip_iterator =
+                hpx::util::zip_iterator<std::ranges::iterator_t<Rngs>...>;
+
+            auto const size = (std::min) ({static_cast<std::ptrdiff_t>(
+                std::ranges::distance(rngs))...});
+
+            return hpx::util::iterator_range<zip_iterator>(
+                zip_iterator(hpx::util::begin(rngs)...),
+                zip_iterator(std::next(hpx::util::begin(rngs), size)...));
+        }
+    }    // namespace views
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::fused_for_each
+    HPX_CXX_CORE_EXPORT inline constexpr struct fused_for_each_t final
+      : hpx::detail::tag_parallel_algorithm<fused_for_each_t>
+    {
+    private:
+        template <typename View, typename F>
+        // clang-format off
+            requires (
+                hpx::parallel::detail::is_fused_view_v<View>
+            )
+        // clang-format on
+        friend void tag_fallback_invoke(
+            hpx::experimental::fused_for_each_t, View const& view, F f)
+        {
+            using iterator = typename View::iterator;
+
+            hpx::parallel::detail::fused_for_each<iterator>().call(
+                hpx::execution::seq, view, HPX_MOVE(f));
+        }
+
+        template <typename ExPolicy, typename View, typename F>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::parallel::detail::is_fused_view_v<View>
+            )
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+        tag_fallback_invoke(hpx::experimental::fused_for_each_t,
+            ExPolicy&& policy, View const& view, F f)
+        {
+            using iterator = typename View::iterator;
+            static_assert(std::forward_iterator<iterator>,
+                "Requires at least forward iterator.");
+
+            using result_type =
+                hpx::parallel::util::detail::algorithm_result_t<ExPolicy>;
+
+            return hpx::util::void_guard<result_type>(),
+                   hpx::parallel::detail::fused_for_each<iterator>().call(
+                       HPX_FORWARD(ExPolicy, policy), view, HPX_MOVE(f));
+        }
+    } fused_for_each{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::fused_copy
+    HPX_CXX_CORE_EXPORT inline constexpr struct fused_copy_t final
+      : hpx::detail::tag_parallel_algorithm<fused_copy_t>
+    {
+    private:
+        template <typename View, typename OutIter>
+        // clang-format off
+            requires (
+                hpx::parallel::detail::is_fused_view_v<View> &&
+                hpx::traits::is_iterator_v<OutIter>
+            )
+        // clang-format on
+        friend OutIter tag_fallback_invoke(
+            hpx::experimental::fused_copy_t, View const& view, OutIter dest)
+        {
+            return hpx::parallel::detail::fused_copy<OutIter>().call(
+                hpx::execution::seq, view, dest);
+        }
+
+        template <typename ExPolicy, typename View, typename FwdIter>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::parallel::detail::is_fused_view_v<View> &&
+                hpx::traits::is_iterator_v<FwdIter>
+            )
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+            FwdIter>
+        tag_fallback_invoke(hpx::experimental::fused_copy_t, ExPolicy&& policy,
+            View const& view, FwdIter dest)
+        {
+            static_assert(std::forward_iterator<typename View::iterator>,
+                "Requires at least forward iterator.");
+            static_assert(std::forward_iterator<FwdIter> ||
+                    hpx::is_sequenced_execution_policy_v<ExPolicy>,
+                "Requires at least forward iterator or sequential execution.");
+
+            return hpx::parallel::detail::fused_copy<FwdIter>().call(
+                HPX_FORWARD(ExPolicy, policy), view, dest);
+        }
+    } fused_copy{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::fused_reduce
+    HPX_CXX_CORE_EXPORT inline constexpr struct fused_reduce_t final
+      : hpx::detail::tag_parallel_algorithm<fused_reduce_t>
+    {
+    private:
+        template <typename View, typename T, typename Op = std::plus<>>
+        // clang-format off
+            requires (
+                hpx::parallel::detail::is_fused_view_v<View>
+            )
+        // clang-format on
+        friend T tag_fallback_invoke(hpx::experimental::fused_reduce_t,
+            View const& view, T init, Op op = Op())
+        {
+            return hpx::parallel::detail::fused_reduce<T>().call(
+                hpx::execution::seq, view, HPX_MOVE(init), HPX_MOVE(op));
+        }
+
+        template <typename ExPolicy, typename View, typename T,
+            typename Op = std::plus<>>
+        // clang-format off
+            requires (
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::parallel::detail::is_fused_view_v<View>
+            )
+        // clang-format on
+        friend hpx::parallel::util::detail::algorithm_result_t<ExPolicy, T>
+        tag_fallback_invoke(hpx::experimental::fused_reduce_t,
+            ExPolicy&& policy, View const& view, T init, Op op = Op())
+        {
+            static_assert(std::forward_iterator<typename View::iterator>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::detail::fused_reduce<T>().call(
+                HPX_FORWARD(ExPolicy, policy), view, HPX_MOVE(init),
+                HPX_MOVE(op));
+        }
+    } fused_reduce{};
+}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -0,0 +1,266 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/datastructures.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/iterator_support.hpp>
+#include <hpx/modules/type_support.hpp>
+#include <hpx/parallel/util/foreach_partitioner.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(HPX_HAVE_MM_PREFETCH)
+#if defined(HPX_MSVC)
+#include <intrin.h>
+#endif
+#if defined(HPX_GCC_VERSION)
+#include <emmintrin.h>
+#endif
+#endif
+
+namespace hpx::parallel::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Tuning knobs for loops performing indirect accesses (a[idx[i]]).
+    //
+    // distance:    number of iterations the prefetches run ahead of the
+    //              element currently being processed, zero disables
+    //              prefetching
+    // block_bytes: the iteration space is split into blocks spanning this
+    //              many bytes of the index sequence. A block is the unit of
+    //              work scheduled by the partitioner, it is never split
+    //              between cores. This bounds the number of cache lines and
+    //              memory pages of the index sequence (and of any other
+    //              sequence accessed in the order of the indices) touched per
+    //              block. The gathered or scattered elements themselves are
+    //              accessed in the order given by the indices, they are
+    //              neither blocked nor reordered; only the prefetching hides
+    //              the latency of these accesses.
+    // for_write:   prefetch the gathered elements for modification. The
+    //              algorithms select the matching prefetcher once per block,
+    //              make_indirect_prefetcher takes the hint as a template
+    //              argument instead.
+    HPX_CXX_CORE_EXPORT struct indirect_prefetch_parameters
+    {
+        std::size_t distance = 16;
+        std::size_t block_bytes = 16384;
+        bool for_write = false;
+
+        // number of elements of the given size making up one block
+        [[nodiscard]] constexpr std::size_t block_size(
+            std::size_t element_size) const noexcept
+        {
+            std::size_t const size = block_bytes / element_size;
+
+            // a block should cover at least the prefetch distance, otherwise
+            // most of the prefetches would be dropped at the block boundary
+            return (std::max) ((std::max) (size, 2 * distance),
+                static_cast<std::size_t>(1));
+        }
+    };
+
+    namespace prefetching {
+
+        ///////////////////////////////////////////////////////////////////////
+        HPX_CXX_CORE_EXPORT template <bool ForWrite = false>
+        HPX_FORCEINLINE void prefetch_address(void const* p) noexcept
+        {
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            __builtin_prefetch(p, ForWrite ? 1 : 0, 3);
+#elif defined(HPX_HAVE_MM_PREFETCH)
+            // prefetch with intent to write, if supported
+#if defined(_MM_HINT_ET0)
+            constexpr int hint = ForWrite ? _MM_HINT_ET0 : _MM_HINT_T0;
+#else
+            constexpr int hint = _MM_HINT_T0;
+#endif
+            _mm_prefetch(const_cast<char*>(static_cast<char const*>(p)), hint);
+#else
+            (void) p;
+#endif
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Software pipelined prefetching for indirect accesses. For each
+        // position k of the index sequence the prefetcher touches the
+        // addresses &targets[idx[k + distance]]... ahead of time, so that
+        // the (otherwise unpredictable) gathered or scattered elements are
+        // in cache once position k + distance is processed. ForWrite selects
+        // the prefetch hint at compile time, keeping the loops branch free.
+        HPX_CXX_CORE_EXPORT template <bool ForWrite, typename IdxIter,
+            typename... Targets>
+        class indirect_prefetcher
+        {
+            static_assert(
+                std::random_access_iterator<IdxIter> &&
+                    (std::random_access_iterator<Targets> && ...),
+                "indirect prefetching requires random access iterators");
+
+            using index_pack_type =
+                typename hpx::util::make_index_pack<sizeof...(Targets)>::type;
+
+        public:
+            indirect_prefetcher(
+                IdxIter idx, std::size_t distance, Targets... targets)
+              : idx_(idx)
+              , targets_(targets...)
+              , distance_(distance)
+            {
+            }
+
+            [[nodiscard]] std::size_t distance() const noexcept
+            {
+                return distance_;
+            }
+
+            // prefetch the targets referred to by position k
+            HPX_FORCEINLINE void prefetch(std::size_t k) const
+            {
+                prefetch(k, index_pack_type());
+            }
+
+            // issue the prefetches for the first positions of [first, last),
+            // to be called before processing a contiguous sub-range
+            HPX_FORCEINLINE void prime(
+                std::size_t first, std::size_t last) const
+            {
+                // clang-format off
+                std::size_t const end = (std::min) (first + distance_, last);
+                // clang-format on
+                for (/**/; first < end; ++first)
+                {
+                    prefetch(first);
+                }
+            }
+
+            // to be called when processing position k of [first, last)
+            HPX_FORCEINLINE void prefetch_ahead(
+                std::size_t k, std::size_t last) const
+            {
+                if (distance_ != 0 && k + distance_ < last)
+                {
+                    prefetch(k + distance_);
+                }
+            }
+
+            // invoke f(k) for all positions in [first, last) while keeping
+            // the prefetches running ahead
+            template <typename F>
+            void loop(std::size_t first, std::size_t last, F&& f) const
+            {
+                if (distance_ == 0)
+                {
+                    for (/**/; first != last; ++first)
+                    {
+                        HPX_INVOKE(f, first);
+                    }
+                    return;
+                }
+
+                prime(first, last);
+
+                // the main loop does not need to check for the end of the
+                // range when prefetching
+                if (last - first > distance_)
+                {
+                    std::size_t const end = last - distance_;
+                    for (/**/; first != end; ++first)
+                    {
+                        prefetch(first + distance_);
+                        HPX_INVOKE(f, first);
+                    }
+                }
+
+                for (/**/; first != last; ++first)
+                {
+                    HPX_INVOKE(f, first);
+                }
+            }
+
+        private:
+            template <std::size_t... Is>
+            HPX_FORCEINLINE void prefetch(
+                std::size_t k, hpx::util::index_pack<Is...>) const
+            {
+                auto const i = idx_[k];
+                (prefetch_address<ForWrite>(
+                     std::addressof(*(hpx::get<Is>(targets_) + i))),
+                    ...);
+            }
+
+            IdxIter idx_;
+            hpx::tuple<Targets...> targets_;
+            std::size_t distance_;
+        };
+    }    // namespace prefetching
+
+    ///////////////////////////////////////////////////////////////////////////
+    // create an indirect_prefetcher for the targets indexed by idx, the
+    // targets are prefetched for modification if ForWrite is true
+    HPX_CXX_CORE_EXPORT template <bool ForWrite = false,
+        std::random_access_iterator IdxIter,
+        std::random_access_iterator... Targets>
+    prefetching::indirect_prefetcher<ForWrite, IdxIter, Targets...>
+    make_indirect_prefetcher(IdxIter idx,
+        indirect_prefetch_parameters const& params, Targets... targets)
+    {
+        return prefetching::indirect_prefetcher<ForWrite, IdxIter,
+            Targets...>(idx, params.distance, targets...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Partition the index space [0, count) into blocks of block_size
+    // consecutive positions and invoke f(first, last) for each of them. The
+    // blocks are distributed over the cores by the foreach_partitioner; a
+    // block is always processed as a whole by a single task. f2 is invoked
+    // with the number of positions once all blocks have been processed.
+    HPX_CXX_CORE_EXPORT template <typename ExPolicy>
+    struct blocked_partitioner
+    {
+        template <typename ExPolicy_, typename F1, typename F2>
+        static decltype(auto) call(ExPolicy_&& policy, std::size_t count,
+            std::size_t block_size, F1&& f1, F2&& f2)
+        {
+            HPX_ASSERT(block_size != 0);
+
+            std::size_t const num_blocks =
+                (count + block_size - 1) / block_size;
+
+            auto process_blocks = [count, block_size,
+                                      f1 = HPX_FORWARD(F1, f1)](
+                                      auto part_begin, std::size_t part_count,
+                                      std::size_t) mutable {
+                std::size_t block = *part_begin;
+                for (/**/; part_count != 0; (void) --part_count, ++block)
+                {
+                    std::size_t const first = block * block_size;
+                    // clang-format off
+                    std::size_t const last =
+                        (std::min) (first + block_size, count);
+                    // clang-format on
+                    HPX_INVOKE(f1, first, last);
+                }
+            };
+
+            return foreach_partitioner<std::decay_t<ExPolicy>>::call(
+                HPX_FORWARD(ExPolicy_, policy),
+                hpx::util::counting_iterator(static_cast<std::size_t>(0)),
+                num_blocks, HPX_MOVE(process_blocks),
+                [count, f2 = HPX_FORWARD(F2, f2)](auto&&) mutable {
+                    return HPX_INVOKE(f2, count);
+                });
+        }
+    };
+}    // namespace hpx::parallel::util
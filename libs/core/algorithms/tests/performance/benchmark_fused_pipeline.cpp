@@ -0,0 +1,153 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares a chain of separate algorithm invocations (transform, copy_if,
+// reduce), each making a full pass over memory and materializing its result,
+// with the equivalent fused pipeline executed in a single partitioned pass.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/numeric.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+namespace views = hpx::experimental::views;
+
+struct transform_op
+{
+    double operator()(double v) const
+    {
+        return v * v + 1.0;
+    }
+};
+
+struct filter_op
+{
+    bool operator()(double v) const
+    {
+        return v < 0.5 * 0.5 + 1.0;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double run_benchmark(int const test_count, F&& f)
+{
+    // warmup
+    f();
+
+    std::uint64_t time = hpx::chrono::high_resolution_clock::now();
+    for (int i = 0; i != test_count; ++i)
+    {
+        f();
+    }
+    time = hpx::chrono::high_resolution_clock::now() - time;
+
+    return (static_cast<double>(time) * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const vector_size = vm["vector_size"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    std::vector<double> data(vector_size);
+    std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+
+    std::vector<double> tmp1(vector_size);
+    std::vector<double> tmp2(vector_size);
+
+    auto const policy = hpx::execution::par;
+
+    double chained_sum = 0.0;
+    double const chained = run_benchmark(test_count, [&]() {
+        hpx::transform(
+            policy, data.begin(), data.end(), tmp1.begin(), transform_op());
+        auto last = hpx::copy_if(
+            policy, tmp1.begin(), tmp1.end(), tmp2.begin(), filter_op());
+        chained_sum = hpx::reduce(policy, tmp2.begin(), last, 0.0);
+    });
+
+    auto const view =
+        data | views::transform(transform_op()) | views::filter(filter_op());
+
+    double fused_sum = 0.0;
+    double const fused = run_benchmark(test_count, [&]() {
+        fused_sum = hpx::experimental::fused_reduce(policy, view, 0.0);
+    });
+
+    double const fused_copy = run_benchmark(test_count, [&]() {
+        hpx::experimental::fused_copy(policy, view, tmp2.begin());
+    });
+
+    std::cout << "-------------- Benchmark Config --------------\n";
+    std::cout << "seed         : " << seed << "\n";
+    std::cout << "vector_size  : " << vector_size << "\n";
+    std::cout << "test_count   : " << test_count << "\n";
+    std::cout << "os threads   : " << hpx::get_os_thread_count() << "\n";
+    std::cout << "----------------------------------------------\n\n";
+
+    std::cout << "transform|copy_if|reduce (chained) : " << chained << " s\n";
+    std::cout << "transform|filter|reduce (fused)    : " << fused
+              << " s, speedup: " << chained / fused << "\n";
+    std::cout << "transform|filter|copy (fused)      : " << fused_copy
+              << " s\n";
+
+    // the sums are computed in different order
+    HPX_TEST(std::abs(chained_sum - fused_sum) <= 1e-9 * std::abs(chained_sum));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size", value<std::size_t>()->default_value(10000000),
+         "number of elements (default: 10000000)")
+        ("test_count", value<int>()->default_value(10),
+         "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+    ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,170 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Scaling benchmark comparing the parallel selection algorithms
+// (hpx::nth_element, hpx::partial_sort and hpx::experimental::select_k) with
+// their sequential counterparts from the standard library for growing input
+// sizes.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+// Measure the average time needed by f to process a fresh copy of data.
+template <typename F>
+double run_benchmark(int const test_count,
+    std::vector<std::uint64_t> const& data, std::vector<std::uint64_t>& work,
+    F&& f)
+{
+    std::uint64_t time = 0;
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::copy(data.begin(), data.end(), work.begin());
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        f(work);
+        time += hpx::chrono::high_resolution_clock::now() - start;
+    }
+    return (static_cast<double>(time) * 1e-9) / test_count;
+}
+
+void print_result(char const* name, double time, double baseline)
+{
+    std::cout << std::left << std::setw(32) << name << std::right
+              << std::setw(12) << std::fixed << std::setprecision(6) << time
+              << " s   speedup: " << std::setprecision(2) << baseline / time
+              << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_size(std::size_t size, double k_ratio, int const test_count)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> dist;
+
+    std::vector<std::uint64_t> data(size);
+    std::generate(data.begin(), data.end(), [&]() { return dist(gen); });
+    std::vector<std::uint64_t> work(size);
+
+    auto const k = static_cast<std::ptrdiff_t>(
+        static_cast<double>(size) * k_ratio);
+
+    std::cout << "size: " << size << ", k: " << k << "\n";
+
+    // nth_element
+    double const nth_std =
+        run_benchmark(test_count, data, work, [k](auto& v) {
+            std::nth_element(v.begin(), v.begin() + k, v.end());
+        });
+    double const nth_hpx =
+        run_benchmark(test_count, data, work, [k](auto& v) {
+            hpx::nth_element(
+                hpx::execution::par, v.begin(), v.begin() + k, v.end());
+        });
+
+    print_result("std::nth_element", nth_std, nth_std);
+    print_result("hpx::nth_element(par)", nth_hpx, nth_std);
+
+    // select_k, the standard library has no direct equivalent
+    double const select_hpx =
+        run_benchmark(test_count, data, work, [k](auto& v) {
+            hpx::experimental::select_k(
+                hpx::execution::par, v.begin(), v.end(), k);
+        });
+
+    print_result("hpx::experimental::select_k(par)", select_hpx, nth_std);
+
+    // partial_sort
+    double const partial_std =
+        run_benchmark(test_count, data, work, [k](auto& v) {
+            std::partial_sort(v.begin(), v.begin() + k, v.end());
+        });
+    double const partial_hpx =
+        run_benchmark(test_count, data, work, [k](auto& v) {
+            hpx::partial_sort(
+                hpx::execution::par, v.begin(), v.begin() + k, v.end());
+        });
+
+    print_result("std::partial_sort", partial_std, partial_std);
+    print_result("hpx::partial_sort(par)", partial_hpx, partial_std);
+
+    std::cout << "\n";
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const min_size = vm["min_size"].as<std::size_t>();
+    std::size_t const max_size = vm["max_size"].as<std::size_t>();
+    double const k_ratio = vm["k_ratio"].as<double>();
+    int const test_count = vm["test_count"].as<int>();
+
+    std::cout << "-------------- Benchmark Config --------------\n";
+    std::cout << "seed         : " << seed << "\n";
+    std::cout << "k ratio      : " << k_ratio << "\n";
+    std::cout << "test_count   : " << test_count << "\n";
+    std::cout << "os threads   : " << hpx::get_os_thread_count() << "\n";
+    std::cout << "----------------------------------------------\n\n";
+
+    for (std::size_t size = min_size; size <= max_size; size *= 10)
+    {
+        run_size(size, k_ratio, test_count);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("min_size", value<std::size_t>()->default_value(100000),
+         "smallest number of elements (default: 100000)")
+        ("max_size", value<std::size_t>()->default_value(10000000),
+         "largest number of elements, sizes grow by 10x (default: 10000000)")
+        ("k_ratio", value<double>()->default_value(0.1),
+         "position of the selected element relative to the size "
+         "(default: 0.1)")
+        ("test_count", value<int>()->default_value(5),
+         "number of tests to be averaged (default: 5)")
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+    ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,203 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Sparse matrix-vector product (CSR format) with randomly distributed column
+// indices. The accesses to the input vector x[col[k]] are the indirect
+// (gather) accesses the hardware prefetchers cannot predict. The plain
+// parallel loop over the rows is compared with the blocked partitioner using
+// software prefetching of the gathered elements.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+
+struct csr_matrix
+{
+    std::vector<std::size_t> row_ptr;
+    std::vector<std::uint32_t> col;
+    std::vector<double> val;
+};
+
+csr_matrix make_matrix(std::size_t rows, std::size_t nnz_per_row)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::uint32_t> col_dist(
+        0, static_cast<std::uint32_t>(rows - 1));
+    std::uniform_int_distribution<std::size_t> nnz_dist(1, 2 * nnz_per_row);
+    std::uniform_real_distribution<double> val_dist(-1.0, 1.0);
+
+    csr_matrix m;
+    m.row_ptr.reserve(rows + 1);
+    m.row_ptr.push_back(0);
+    for (std::size_t r = 0; r != rows; ++r)
+    {
+        std::size_t const nnz = nnz_dist(gen);
+        for (std::size_t k = 0; k != nnz; ++k)
+        {
+            m.col.push_back(col_dist(gen));
+            m.val.push_back(val_dist(gen));
+        }
+        std::sort(m.col.end() - nnz, m.col.end());
+        m.row_ptr.push_back(m.col.size());
+    }
+    return m;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double run_benchmark(int const test_count, F&& f)
+{
+    // warmup
+    f();
+
+    std::uint64_t time = hpx::chrono::high_resolution_clock::now();
+    for (int i = 0; i != test_count; ++i)
+    {
+        f();
+    }
+    time = hpx::chrono::high_resolution_clock::now() - time;
+
+    return (static_cast<double>(time) * 1e-9) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const rows = vm["rows"].as<std::size_t>();
+    std::size_t const nnz_per_row = vm["nnz_per_row"].as<std::size_t>();
+    int const test_count = vm["test_count"].as<int>();
+
+    hpx::parallel::util::indirect_prefetch_parameters params;
+    params.distance = vm["distance"].as<std::size_t>();
+    params.block_bytes = vm["block_bytes"].as<std::size_t>();
+
+    csr_matrix const m = make_matrix(rows, nnz_per_row);
+    std::vector<double> const x(rows, 1.0);
+    std::vector<double> y1(rows), y2(rows);
+
+    auto const policy = hpx::execution::par;
+
+    // plain parallel loop over the rows
+    double const plain = run_benchmark(test_count, [&]() {
+        hpx::experimental::for_loop(policy, std::size_t(0), rows,
+            [&](std::size_t r) {
+                double sum = 0.0;
+                for (std::size_t k = m.row_ptr[r]; k != m.row_ptr[r + 1]; ++k)
+                {
+                    sum += m.val[k] * x[m.col[k]];
+                }
+                y1[r] = sum;
+            });
+    });
+
+    // blocks of rows spanning block_bytes of the column index array, the
+    // gathered elements of x are prefetched while the block is processed
+    std::size_t const block_rows = (std::max)(
+        params.block_size(sizeof(std::uint32_t)) / nnz_per_row,
+        std::size_t(1));
+
+    auto const prefetcher = hpx::parallel::util::make_indirect_prefetcher(
+        m.col.begin(), params, x.begin());
+
+    double const prefetched = run_benchmark(test_count, [&]() {
+        hpx::parallel::util::blocked_partitioner<decltype(policy)>::call(
+            policy, rows, block_rows,
+            [&](std::size_t first, std::size_t last) {
+                std::size_t const k_last = m.row_ptr[last];
+                prefetcher.prime(m.row_ptr[first], k_last);
+
+                for (std::size_t r = first; r != last; ++r)
+                {
+                    double sum = 0.0;
+                    for (std::size_t k = m.row_ptr[r]; k != m.row_ptr[r + 1];
+                        ++k)
+                    {
+                        prefetcher.prefetch_ahead(k, k_last);
+                        sum += m.val[k] * x[m.col[k]];
+                    }
+                    y2[r] = sum;
+                }
+            },
+            [](std::size_t count) { return count; });
+    });
+
+    std::size_t const nnz = m.col.size();
+
+    std::cout << "-------------- Benchmark Config --------------\n";
+    std::cout << "seed         : " << seed << "\n";
+    std::cout << "rows         : " << rows << "\n";
+    std::cout << "non-zeros    : " << nnz << "\n";
+    std::cout << "distance     : " << params.distance << "\n";
+    std::cout << "block_bytes  : " << params.block_bytes << "\n";
+    std::cout << "test_count   : " << test_count << "\n";
+    std::cout << "os threads   : " << hpx::get_os_thread_count() << "\n";
+    std::cout << "----------------------------------------------\n\n";
+
+    auto const gflops = [nnz](double t) { return 2.0 * nnz / t * 1e-9; };
+
+    std::cout << "spmv (for_loop)             : " << plain << " s, "
+              << gflops(plain) << " GFlop/s\n";
+    std::cout << "spmv (blocked, prefetching) : " << prefetched << " s, "
+              << gflops(prefetched) << " GFlop/s, speedup: "
+              << plain / prefetched << "\n";
+
+    HPX_TEST(std::equal(y1.begin(), y1.end(), y2.begin()));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("rows", value<std::size_t>()->default_value(1 << 22),
+         "number of rows and columns of the matrix (default: 4194304)")
+        ("nnz_per_row", value<std::size_t>()->default_value(8),
+         "average number of non-zeros per row (default: 8)")
+        ("distance", value<std::size_t>()->default_value(16),
+         "prefetch distance in non-zeros, 0 disables prefetching "
+         "(default: 16)")
+        ("block_bytes", value<std::size_t>()->default_value(16384),
+         "bytes of column indices making up one block (default: 16384)")
+        ("test_count", value<int>()->default_value(10),
+         "number of tests to be averaged (default: 10)")
+        ("seed,s", value<unsigned int>(),
+         "the random number generator seed to use for this run")
+    ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,165 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/modules/algorithms.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(0);
+
+using parameters_type = hpx::parallel::util::indirect_prefetch_parameters;
+
+// cover disabled prefetching, the defaults, and blocks smaller than the
+// prefetch distance
+parameters_type const parameters[] = {
+    {0, 16384, false}, {16, 16384, false}, {64, 64, true}};
+
+std::size_t const sizes[] = {0, 1, 1000, 100003};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... ExPolicy>
+void test_indirect_for_each_scatter(ExPolicy&&... policy)
+{
+    for (std::size_t size : sizes)
+    {
+        // a permutation refers to every element exactly once
+        std::vector<std::uint32_t> idx(size);
+        std::iota(idx.begin(), idx.end(), 0);
+        std::shuffle(idx.begin(), idx.end(), gen);
+
+        for (auto const& params : parameters)
+        {
+            std::vector<std::size_t> data(size, 0);
+
+            auto result = hpx::experimental::indirect_for_each(policy...,
+                idx.begin(), idx.end(), data.begin(),
+                [](std::size_t& v) { ++v; }, params);
+
+            HPX_TEST(result == idx.end());
+            HPX_TEST(std::all_of(
+                data.begin(), data.end(), [](std::size_t v) { return v == 1; }));
+        }
+    }
+}
+
+template <typename... ExPolicy>
+void test_indirect_for_each_gather(ExPolicy&&... policy)
+{
+    for (std::size_t size : sizes)
+    {
+        std::vector<std::int64_t> data(size + 1);
+        std::iota(data.begin(), data.end(), 0);
+
+        // indices may repeat for a gather
+        std::uniform_int_distribution<std::size_t> dist(0, size);
+        std::vector<std::size_t> idx(2 * size);
+        std::generate(idx.begin(), idx.end(), [&]() { return dist(gen); });
+
+        std::int64_t const expected =
+            std::accumulate(idx.begin(), idx.end(), std::int64_t(0),
+                [&](std::int64_t sum, std::size_t i) { return sum + data[i]; });
+
+        for (auto const& params : parameters)
+        {
+            std::atomic<std::int64_t> sum(0);
+
+            auto result = hpx::experimental::indirect_for_each(policy...,
+                idx.begin(), idx.end(), data.cbegin(),
+                [&](std::int64_t v) { sum += v; }, params);
+
+            HPX_TEST(result == idx.end());
+            HPX_TEST_EQ(sum.load(), expected);
+        }
+
+        // default parameters
+        std::atomic<std::int64_t> sum(0);
+        hpx::experimental::indirect_for_each(policy..., idx.begin(), idx.end(),
+            data.cbegin(), [&](std::int64_t v) { sum += v; });
+        HPX_TEST_EQ(sum.load(), expected);
+    }
+}
+
+template <typename ExPolicy>
+void test_indirect_for_each_async(ExPolicy&& policy)
+{
+    std::size_t const size = 100003;
+
+    std::vector<std::uint32_t> idx(size);
+    std::iota(idx.begin(), idx.end(), 0);
+    std::shuffle(idx.begin(), idx.end(), gen);
+
+    std::vector<std::size_t> data(size, 0);
+
+    auto f = hpx::experimental::indirect_for_each(policy, idx.begin(),
+        idx.end(), data.begin(), [](std::size_t& v) { ++v; });
+
+    HPX_TEST(f.get() == idx.end());
+    HPX_TEST(std::all_of(
+        data.begin(), data.end(), [](std::size_t v) { return v == 1; }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::execution;
+
+    test_indirect_for_each_scatter();
+    test_indirect_for_each_scatter(seq);
+    test_indirect_for_each_scatter(par);
+    test_indirect_for_each_scatter(par_unseq);
+
+    test_indirect_for_each_gather();
+    test_indirect_for_each_gather(seq);
+    test_indirect_for_each_gather(par);
+    test_indirect_for_each_gather(par_unseq);
+
+    test_indirect_for_each_async(seq(task));
+    test_indirect_for_each_async(par(task));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,173 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/modules/algorithms.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(0);
+
+// every element remembers the sequence and the position it came from, which
+// allows to verify the stability of the merge
+using element_type = std::pair<int, std::size_t>;
+
+struct compare_first
+{
+    bool operator()(element_type const& lhs, element_type const& rhs) const
+    {
+        return lhs.first < rhs.first;
+    }
+};
+
+std::vector<std::vector<element_type>> make_sequences(
+    std::size_t num_seqs, std::size_t max_size, int max_value)
+{
+    std::uniform_int_distribution<std::size_t> size_dist(0, max_size);
+    std::uniform_int_distribution<int> value_dist(0, max_value);
+
+    std::vector<std::vector<element_type>> seqs(num_seqs);
+    std::size_t tag = 0;
+    for (auto& seq : seqs)
+    {
+        seq.resize(size_dist(gen));
+        for (auto& e : seq)
+        {
+            e = element_type(value_dist(gen), tag++);
+        }
+        std::stable_sort(seq.begin(), seq.end(), compare_first());
+    }
+    return seqs;
+}
+
+std::vector<element_type> expected_result(
+    std::vector<std::vector<element_type>> const& seqs)
+{
+    std::vector<element_type> expected;
+    for (auto const& seq : seqs)
+    {
+        expected.insert(expected.end(), seq.begin(), seq.end());
+    }
+    std::stable_sort(expected.begin(), expected.end(), compare_first());
+    return expected;
+}
+
+template <typename... ExPolicy>
+void test_multiway_merge(ExPolicy&&... policy)
+{
+    using iterator = std::vector<element_type>::iterator;
+
+    std::size_t const num_seqs_values[] = {0, 1, 2, 3, 7, 16, 33};
+    for (std::size_t num_seqs : num_seqs_values)
+    {
+        // few distinct values create many equivalent elements
+        for (int max_value : {3, 1000000})
+        {
+            auto seqs = make_sequences(num_seqs, 10007, max_value);
+            auto expected = expected_result(seqs);
+
+            std::vector<std::pair<iterator, iterator>> ranges;
+            for (auto& seq : seqs)
+            {
+                ranges.emplace_back(seq.begin(), seq.end());
+            }
+
+            std::vector<element_type> dest(expected.size());
+            auto result = hpx::experimental::multiway_merge(policy...,
+                ranges.begin(), ranges.end(), dest.begin(), compare_first());
+
+            HPX_TEST(result == dest.end());
+            HPX_TEST(dest == expected);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_multiway_merge_async(ExPolicy&& policy)
+{
+    using iterator = std::vector<int>::iterator;
+
+    std::vector<std::vector<int>> seqs(5);
+    std::uniform_int_distribution<int> dist(0, 100000);
+    for (auto& seq : seqs)
+    {
+        seq.resize(5003);
+        std::generate(seq.begin(), seq.end(), [&]() { return dist(gen); });
+        std::sort(seq.begin(), seq.end());
+    }
+
+    std::vector<std::pair<iterator, iterator>> ranges;
+    std::vector<int> expected;
+    for (auto& seq : seqs)
+    {
+        ranges.emplace_back(seq.begin(), seq.end());
+        expected.insert(expected.end(), seq.begin(), seq.end());
+    }
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<int> dest(expected.size());
+    auto f = hpx::experimental::multiway_merge(
+        policy, ranges.begin(), ranges.end(), dest.begin());
+
+    HPX_TEST(f.get() == dest.end());
+    HPX_TEST(dest == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::execution;
+
+    test_multiway_merge();
+    test_multiway_merge(seq);
+    test_multiway_merge(par);
+    test_multiway_merge(par_unseq);
+
+    test_multiway_merge_async(seq(task));
+    test_multiway_merge_async(par(task));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
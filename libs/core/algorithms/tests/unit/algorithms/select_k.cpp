@@ -0,0 +1,176 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/modules/algorithms.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(0);
+
+// the sizes cover both the sequential fallback and the sampled parallel
+// selection
+std::size_t const sizes[] = {0, 1, 1000, 100003, 1000003};
+
+std::vector<int> make_data(std::size_t size, int max_value)
+{
+    std::uniform_int_distribution<int> dist(0, max_value);
+
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+    return c;
+}
+
+template <typename Comp>
+void verify_selection(std::vector<int> const& c, std::vector<int> const& orig,
+    std::size_t k, Comp comp)
+{
+    std::vector<int> sorted = orig;
+    std::sort(sorted.begin(), sorted.end(), comp);
+
+    // the first k elements have to be the k smallest ones
+    std::vector<int> head(c.begin(), c.begin() + k);
+    std::sort(head.begin(), head.end(), comp);
+    HPX_TEST(std::equal(head.begin(), head.end(), sorted.begin()));
+
+    std::vector<int> all = c;
+    std::sort(all.begin(), all.end(), comp);
+    HPX_TEST(all == sorted);
+}
+
+template <typename... ExPolicy>
+void test_select_k(ExPolicy&&... policy)
+{
+    for (std::size_t size : sizes)
+    {
+        // few distinct values create many equivalent elements
+        for (int max_value : {2, 1000000000})
+        {
+            std::vector<int> const orig = make_data(size, max_value);
+
+            std::size_t const ks[] = {0, size / 10, size / 2, size};
+            for (std::size_t k : ks)
+            {
+                std::vector<int> c = orig;
+                auto result = hpx::experimental::select_k(
+                    policy..., c.begin(), c.end(), k);
+                HPX_TEST(result == c.begin() + k);
+                verify_selection(c, orig, k, std::less<>());
+
+                c = orig;
+                result = hpx::experimental::select_k(
+                    policy..., c.begin(), c.end(), k, std::greater<>());
+                HPX_TEST(result == c.begin() + k);
+                verify_selection(c, orig, k, std::greater<>());
+            }
+
+            // k larger than the size selects everything
+            std::vector<int> c = orig;
+            auto result = hpx::experimental::select_k(
+                policy..., c.begin(), c.end(), size + 1);
+            HPX_TEST(result == c.end());
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_select_k_async(ExPolicy&& policy)
+{
+    std::vector<int> const orig = make_data(1000003, 1000000000);
+    std::size_t const k = 1234;
+
+    std::vector<int> c = orig;
+    auto f = hpx::experimental::select_k(policy, c.begin(), c.end(), k);
+
+    HPX_TEST(f.get() == c.begin() + k);
+    verify_selection(c, orig, k, std::less<>());
+}
+
+// nth_element and partial_sort are implemented using the same selection
+void test_nth_element_partial_sort()
+{
+    using namespace hpx::execution;
+
+    for (int max_value : {2, 1000000000})
+    {
+        std::vector<int> const orig = make_data(1000003, max_value);
+        std::vector<int> sorted = orig;
+        std::sort(sorted.begin(), sorted.end());
+
+        std::size_t const ks[] = {0, 1, 4097, 500000, 1000002};
+        for (std::size_t k : ks)
+        {
+            std::vector<int> c = orig;
+            hpx::nth_element(par, c.begin(), c.begin() + k, c.end());
+            HPX_TEST_EQ(c[k], sorted[k]);
+            HPX_TEST(std::all_of(c.begin(), c.begin() + k,
+                [&](int v) { return v <= c[k]; }));
+            HPX_TEST(std::all_of(
+                c.begin() + k, c.end(), [&](int v) { return v >= c[k]; }));
+
+            c = orig;
+            hpx::partial_sort(par, c.begin(), c.begin() + k, c.end());
+            HPX_TEST(std::equal(c.begin(), c.begin() + k, sorted.begin()));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::execution;
+
+    test_select_k();
+    test_select_k(seq);
+    test_select_k(par);
+    test_select_k(par_unseq);
+
+    test_select_k_async(seq(task));
+    test_select_k_async(par(task));
+
+    test_nth_element_partial_sort();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,189 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/init.hpp>
+#include <hpx/modules/algorithms.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::mt19937 gen(0);
+
+// values spanning many orders of magnitude make the result of a plain
+// floating point sum depend on the order of the additions
+template <typename T>
+std::vector<T> make_data(std::size_t size)
+{
+    std::uniform_real_distribution<T> dist(T(-1), T(1));
+    std::uniform_int_distribution<int> exp_dist(-10, 10);
+
+    std::vector<T> c(size);
+    for (auto& v : c)
+    {
+        v = std::ldexp(dist(gen), exp_dist(gen));
+    }
+    return c;
+}
+
+template <typename T>
+bool bitwise_equal(T lhs, T rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
+// run the given algorithm with different policies and chunkings, all results
+// have to be bitwise identical
+template <typename T, typename F>
+void test_reproducible(F&& f)
+{
+    using namespace hpx::execution;
+    using hpx::execution::experimental::static_chunk_size;
+
+    T const expected = f(seq);
+
+    HPX_TEST(bitwise_equal(f(par), expected));
+    HPX_TEST(bitwise_equal(f(par_unseq), expected));
+    HPX_TEST(bitwise_equal(f(par.with(static_chunk_size(17))), expected));
+    HPX_TEST(bitwise_equal(f(par.with(static_chunk_size(1000))), expected));
+    HPX_TEST(bitwise_equal(f(par(task)).get(), expected));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_transform_reduce_deterministic()
+{
+    std::vector<T> const c = make_data<T>(100007);
+    auto conv = [](T v) { return v * v - T(0.25); };
+
+    // the result has to be close to the exact sum
+    long double exact = 1.0L;
+    for (T v : c)
+    {
+        exact += static_cast<long double>(conv(v));
+    }
+
+    T const r = hpx::experimental::transform_reduce_deterministic(
+        c.begin(), c.end(), T(1), conv);
+    HPX_TEST(std::abs(static_cast<long double>(r) - exact) <=
+        std::abs(exact) * 1e-5);
+
+    test_reproducible<T>([&](auto&& policy) {
+        return hpx::experimental::transform_reduce_deterministic(
+            policy, c.begin(), c.end(), T(1), conv);
+    });
+
+    // empty range
+    T const r_empty = hpx::experimental::transform_reduce_deterministic(
+        hpx::execution::par, c.begin(), c.begin(), T(42), conv);
+    HPX_TEST_EQ(r_empty, T(42));
+}
+
+template <typename T>
+void test_transform_reduce_binary_deterministic()
+{
+    std::vector<T> const a = make_data<T>(100007);
+    std::vector<T> const b = make_data<T>(100007);
+
+    test_reproducible<T>([&](auto&& policy) {
+        return hpx::experimental::transform_reduce_deterministic(
+            policy, a.begin(), a.end(), b.begin(), T(0));
+    });
+
+    // the default operation computes the inner product
+    T const dot = hpx::experimental::transform_reduce_deterministic(
+        a.begin(), a.end(), b.begin(), T(0));
+    T const dot_explicit = hpx::experimental::transform_reduce_deterministic(
+        hpx::execution::par, a.begin(), a.end(), b.begin(), T(0),
+        std::multiplies<>());
+    HPX_TEST(bitwise_equal(dot, dot_explicit));
+
+    test_reproducible<T>([&](auto&& policy) {
+        return hpx::experimental::transform_reduce_deterministic(policy,
+            a.begin(), a.end(), b.begin(), T(0),
+            [](T x, T y) { return x - y; });
+    });
+}
+
+template <typename T>
+void test_for_loop_reduction_deterministic()
+{
+    using namespace hpx::execution;
+    using hpx::execution::experimental::static_chunk_size;
+
+    std::vector<T> const c = make_data<T>(100007);
+
+    auto run = [&](auto&& policy) {
+        T sum = T(1);
+        hpx::experimental::for_loop(policy, std::size_t(0), c.size(),
+            hpx::experimental::reduction_plus_deterministic(sum),
+            [&](std::size_t i, auto& acc) { acc += c[i]; });
+        return sum;
+    };
+
+    T const expected = run(seq);
+    HPX_TEST(bitwise_equal(run(par), expected));
+    HPX_TEST(bitwise_equal(run(par.with(static_chunk_size(17))), expected));
+    HPX_TEST(bitwise_equal(run(par.with(static_chunk_size(1000))), expected));
+
+    // all deterministic variants compute the same sum
+    T const r = hpx::experimental::transform_reduce_deterministic(
+        c.begin(), c.end(), T(1), [](T v) { return v; });
+    HPX_TEST(bitwise_equal(r, expected));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    test_transform_reduce_deterministic<float>();
+    test_transform_reduce_deterministic<double>();
+
+    test_transform_reduce_binary_deterministic<float>();
+    test_transform_reduce_binary_deterministic<double>();
+
+    test_for_loop_reduction_deterministic<float>();
+    test_for_loop_reduction_deterministic<double>();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,213 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/algorithm.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+namespace views = hpx::experimental::views;
+
+struct times_three
+{
+    int operator()(int v) const
+    {
+        return 3 * v;
+    }
+};
+
+struct is_even
+{
+    bool operator()(int v) const
+    {
+        return v % 2 == 0;
+    }
+};
+
+std::vector<int> make_data(std::size_t size)
+{
+    std::uniform_int_distribution<int> dist(-1000, 1000);
+
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dist(gen); });
+    return c;
+}
+
+// the result of the pipeline, computed step by step
+std::vector<int> expected_result(std::vector<int> const& c)
+{
+    std::vector<int> result;
+    for (int v : c)
+    {
+        int const t = times_three()(v);
+        if (is_even()(t))
+        {
+            result.push_back(t + 1);
+        }
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename... ExPolicy>
+void test_pipeline(ExPolicy&&... policy)
+{
+    for (std::size_t size : {0, 1, 10007, 1000003})
+    {
+        std::vector<int> const c = make_data(size);
+        std::vector<int> const expected = expected_result(c);
+
+        auto view = c | views::transform(times_three()) |
+            views::filter(is_even()) |
+            views::transform([](int v) { return v + 1; });
+
+        // stream compaction
+        std::vector<int> d(c.size());
+        auto result =
+            hpx::experimental::fused_copy(policy..., view, d.begin());
+        HPX_TEST(result == d.begin() + expected.size());
+        HPX_TEST(std::equal(expected.begin(), expected.end(), d.begin()));
+
+        // the stream compaction evaluates every stage once per element
+        std::atomic<std::size_t> calls(0);
+        auto counted = c | views::transform([&calls](int v) {
+            ++calls;
+            return times_three()(v);
+        }) | views::filter(is_even());
+        std::vector<int> g(c.size());
+        hpx::experimental::fused_copy(policy..., counted, g.begin());
+        HPX_TEST_EQ(calls.load(), c.size());
+
+        // reduction
+        std::int64_t const sum = hpx::experimental::fused_reduce(
+            policy..., view, std::int64_t(0), std::plus<>());
+        HPX_TEST_EQ(sum,
+            std::accumulate(expected.begin(), expected.end(), std::int64_t(0)));
+
+        // for_each
+        std::atomic<std::int64_t> count(0);
+        hpx::experimental::fused_for_each(
+            policy..., view, [&](int) { ++count; });
+        HPX_TEST_EQ(count.load(), static_cast<std::int64_t>(expected.size()));
+
+        // a pipeline without filter writes every element
+        auto transformed = c | views::transform(times_three());
+        std::vector<int> e(c.size());
+        auto result_e =
+            hpx::experimental::fused_copy(policy..., transformed, e.begin());
+        HPX_TEST(result_e == e.end());
+        for (std::size_t i = 0; i != c.size(); ++i)
+        {
+            HPX_TEST_EQ(e[i], 3 * c[i]);
+        }
+    }
+}
+
+template <typename... ExPolicy>
+void test_pipeline_zip(ExPolicy&&... policy)
+{
+    std::vector<int> const a = make_data(100003);
+    std::vector<int> const b = make_data(100007);
+
+    auto view = views::zip(a, b) | views::transform([](auto&& t) {
+        return hpx::get<0>(t) * hpx::get<1>(t);
+    }) | views::filter([](int v) { return v > 0; });
+
+    std::int64_t expected = 0;
+    for (std::size_t i = 0; i != a.size(); ++i)
+    {
+        int const v = a[i] * b[i];
+        if (v > 0)
+            expected += v;
+    }
+
+    std::int64_t const sum =
+        hpx::experimental::fused_reduce(policy..., view, std::int64_t(0));
+    HPX_TEST_EQ(sum, expected);
+}
+
+template <typename ExPolicy>
+void test_pipeline_async(ExPolicy&& policy)
+{
+    std::vector<int> const c = make_data(100003);
+    std::vector<int> const expected = expected_result(c);
+
+    auto view = c | views::transform(times_three()) |
+        views::filter(is_even()) |
+        views::transform([](int v) { return v + 1; });
+
+    std::vector<int> d(c.size());
+    auto f = hpx::experimental::fused_copy(policy, view, d.begin());
+    HPX_TEST(f.get() == d.begin() + expected.size());
+    HPX_TEST(std::equal(expected.begin(), expected.end(), d.begin()));
+
+    auto sum = hpx::experimental::fused_reduce(policy, view, std::int64_t(0));
+    HPX_TEST_EQ(sum.get(),
+        std::accumulate(expected.begin(), expected.end(), std::int64_t(0)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::execution;
+
+    test_pipeline();
+    test_pipeline(seq);
+    test_pipeline(par);
+    test_pipeline(par_unseq);
+
+    test_pipeline_zip();
+    test_pipeline_zip(par);
+
+    test_pipeline_async(seq(task));
+    test_pipeline_async(par(task));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,250 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/allocator_support/config/defines.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace hpx::util {
+
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_CACHING) &&                             \
+    !((defined(HPX_HAVE_CUDA) && defined(__CUDACC__)) ||                       \
+        defined(HPX_HAVE_HIP))
+
+    ///////////////////////////////////////////////////////////////////////////
+    // thread_local_recycling_allocator keeps a per-thread (i.e. per worker)
+    // free list of single objects of its value_type. Objects released on a
+    // thread are handed out again by the next allocation on the same thread
+    // without touching the underlying allocator.
+    //
+    // This is meant for objects that are allocated one at a time at a high
+    // rate, like the shared states of futures. As every rebound allocator
+    // type has its own free list all cached blocks are of the same size,
+    // allocation and deallocation are a couple of pointer operations. The
+    // free list is linked through the cached blocks themselves, no additional
+    // memory is needed. Blocks may be released on a thread different from the
+    // one that allocated them, they are then cached on the releasing thread.
+    //
+    // Recycling is enabled for stateless allocators only (all instances
+    // compare equal), allocators with state are forwarded to directly.
+    HPX_CXX_CORE_EXPORT template <typename Allocator = std::allocator<char>,
+        std::size_t Capacity = 128>
+    struct thread_local_recycling_allocator
+    {
+        HPX_NO_UNIQUE_ADDRESS Allocator alloc;
+
+        using traits = std::allocator_traits<Allocator>;
+
+        using value_type = traits::value_type;
+        using pointer = traits::pointer;
+        using const_pointer = traits::const_pointer;
+        using size_type = traits::size_type;
+        using difference_type = traits::difference_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = thread_local_recycling_allocator<
+                typename traits::template rebind_alloc<U>, Capacity>;
+        };
+
+        using is_always_equal = traits::is_always_equal;
+        using propagate_on_container_copy_assignment =
+            traits::propagate_on_container_copy_assignment;
+        using propagate_on_container_move_assignment =
+            traits::propagate_on_container_move_assignment;
+        using propagate_on_container_swap = traits::propagate_on_container_swap;
+
+    private:
+        static constexpr bool recycling_enabled =
+            traits::is_always_equal::value &&
+            std::is_pointer_v<pointer> &&
+            sizeof(value_type) >= sizeof(void*) &&
+            alignof(value_type) >= alignof(void*) && Capacity != 0;
+
+        struct free_node
+        {
+            free_node* next;
+        };
+
+        // The free list itself is trivially destructible and constant
+        // initialized, it stays accessible during thread shutdown even after
+        // the cleanup object below has been destroyed.
+        struct free_list
+        {
+            free_node* head;
+            std::size_t cached;
+            bool registered;
+            bool destroyed;
+        };
+
+        static free_list& cache() noexcept
+        {
+            static thread_local free_list list{nullptr, 0, false, false};
+            return list;
+        }
+
+        struct free_list_cleanup
+        {
+            free_list_cleanup() = default;
+            free_list_cleanup(free_list_cleanup const&) = delete;
+            free_list_cleanup(free_list_cleanup&&) = delete;
+            free_list_cleanup& operator=(free_list_cleanup const&) = delete;
+            free_list_cleanup& operator=(free_list_cleanup&&) = delete;
+
+            ~free_list_cleanup()
+            {
+                free_list& list = cache();
+
+                Allocator a{};
+                while (list.head != nullptr)
+                {
+                    free_node* node = list.head;
+                    list.head = node->next;
+                    traits::deallocate(a, reinterpret_cast<pointer>(node), 1);
+                }
+                list.cached = 0;
+                list.destroyed = true;
+            }
+        };
+
+        // the cleanup object is instantiated only once a block is about to
+        // be cached, threads never releasing objects don't pay for it
+        static bool register_cleanup(free_list& list)
+        {
+            if (list.destroyed)
+            {
+                return false;
+            }
+
+            static thread_local free_list_cleanup cleanup;
+            (void) cleanup;
+
+            list.registered = true;
+            return true;
+        }
+
+    public:
+        constexpr thread_local_recycling_allocator() = default;
+
+        // clang-format off
+        explicit constexpr thread_local_recycling_allocator(
+            Allocator const& alloc)
+            noexcept(std::is_nothrow_copy_constructible_v<Allocator>)
+          : alloc(alloc)
+        {
+        }
+
+        template <typename Alloc>
+        explicit constexpr thread_local_recycling_allocator(
+            thread_local_recycling_allocator<Alloc, Capacity> const& rhs)
+            noexcept(std::is_nothrow_copy_constructible_v<Alloc>)
+          : alloc(rhs.alloc)
+        {
+        }
+        // clang-format on
+
+        [[nodiscard]] static constexpr pointer address(value_type& x) noexcept
+        {
+            return std::addressof(x);
+        }
+
+        [[nodiscard]] static constexpr const_pointer address(
+            value_type const& x) noexcept
+        {
+            return std::addressof(x);
+        }
+
+        [[nodiscard]] pointer allocate(size_type n, void const* = nullptr)
+        {
+            if (max_size() < n)
+            {
+                throw std::bad_array_new_length();
+            }
+
+            if constexpr (recycling_enabled)
+            {
+                if (n == 1)
+                {
+                    free_list& list = cache();
+                    if (free_node* node = list.head; node != nullptr)
+                    {
+                        list.head = node->next;
+                        --list.cached;
+                        return reinterpret_cast<pointer>(node);
+                    }
+                }
+            }
+            return traits::allocate(alloc, n);
+        }
+
+        void deallocate(pointer p, size_type n) noexcept
+        {
+            if constexpr (recycling_enabled)
+            {
+                if (n == 1)
+                {
+                    free_list& list = cache();
+                    // blocks released after the cleanup object has been
+                    // destroyed (e.g. by other thread_local destructors)
+                    // would never be freed, don't cache them
+                    if (list.cached < Capacity && !list.destroyed &&
+                        (list.registered || register_cleanup(list)))
+                    {
+                        free_node* node = ::new (static_cast<void*>(p))
+                            free_node{list.head};
+                        list.head = node;
+                        ++list.cached;
+                        return;
+                    }
+                }
+            }
+            traits::deallocate(alloc, p, n);
+        }
+
+        [[nodiscard]] constexpr size_type max_size() const noexcept
+        {
+            return traits::max_size(alloc);
+        }
+
+        template <typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            traits::construct(alloc, p, HPX_FORWARD(Args, args)...);
+        }
+
+        template <typename U>
+        void destroy(U* p) noexcept
+        {
+            traits::destroy(alloc, p);
+        }
+
+        [[nodiscard]] friend constexpr bool operator==(
+            thread_local_recycling_allocator const& lhs,
+            thread_local_recycling_allocator const& rhs) noexcept
+        {
+            return lhs.alloc == rhs.alloc;
+        }
+
+        [[nodiscard]] friend constexpr bool operator!=(
+            thread_local_recycling_allocator const& lhs,
+            thread_local_recycling_allocator const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+#else
+    HPX_CXX_CORE_EXPORT template <typename Allocator = std::allocator<char>,
+        std::size_t Capacity = 128>
+    using thread_local_recycling_allocator = Allocator;
+#endif
+}    // namespace hpx::util
@@ -0,0 +1,89 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the cost of allocating and releasing objects of the size of a
+// typical future shared state through the thread_local_recycling_allocator
+// compared to std::allocator. The 'burst' measurements keep a number of
+// objects alive at the same time, bursts larger than the capacity of the
+// per-thread free list (128) fall back to the underlying allocator.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/allocator_support.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct shared_state
+{
+    alignas(16) char data[192];
+};
+
+#if defined(HPX_DEBUG)
+constexpr std::size_t num_iterations = 1000000;
+#else
+constexpr std::size_t num_iterations = 20000000;
+#endif
+
+// keep the compiler from removing the allocations
+shared_state* volatile sink = nullptr;
+
+void touch(shared_state* p) noexcept
+{
+    sink = p;
+}
+
+// average time (in nanoseconds) of one allocation and release
+template <typename Allocator>
+double measure(std::size_t burst)
+{
+    Allocator alloc;
+    std::vector<shared_state*> objects(burst);
+
+    std::size_t const rounds = num_iterations / burst;
+    auto const start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i != rounds; ++i)
+    {
+        for (auto& p : objects)
+        {
+            p = alloc.allocate(1);
+            touch(p);
+        }
+        for (auto* p : objects)
+        {
+            alloc.deallocate(p, 1);
+        }
+    }
+
+    std::chrono::duration<double, std::nano> const elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(rounds * burst);
+}
+
+int main()
+{
+    using std_allocator = std::allocator<shared_state>;
+    using recycling_allocator =
+        hpx::util::thread_local_recycling_allocator<std_allocator>;
+
+    std::cout << std::setw(8) << "burst" << std::setw(20) << "std [ns]"
+              << std::setw(20) << "recycling [ns]\n";
+
+    for (std::size_t const burst : {1, 100, 1000})
+    {
+        double const baseline = measure<std_allocator>(burst);
+        double const recycled = measure<recycling_allocator>(burst);
+
+        std::cout << std::setw(8) << burst << std::setw(20) << std::fixed
+                  << std::setprecision(2) << baseline << std::setw(20)
+                  << recycled << "\n";
+    }
+    return 0;
+}
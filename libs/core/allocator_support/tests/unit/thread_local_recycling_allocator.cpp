@@ -0,0 +1,143 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/allocator_support.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct block
+{
+    alignas(16) char data[64];
+};
+
+// number of blocks currently allocated from the underlying allocator
+std::atomic<std::ptrdiff_t> outstanding(0);
+
+template <typename T>
+struct counting_allocator
+{
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    counting_allocator() = default;
+
+    template <typename U>
+    explicit counting_allocator(counting_allocator<U> const&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        ++outstanding;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        --outstanding;
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool operator==(
+        counting_allocator const&, counting_allocator const&) noexcept
+    {
+        return true;
+    }
+
+    friend bool operator!=(
+        counting_allocator const&, counting_allocator const&) noexcept
+    {
+        return false;
+    }
+};
+
+using allocator_type =
+    hpx::util::thread_local_recycling_allocator<counting_allocator<block>, 4>;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_recycling()
+{
+    std::thread([] {
+        allocator_type alloc;
+
+        block* p = alloc.allocate(1);
+        alloc.deallocate(p, 1);
+
+        // the released block is handed out again
+        block* q = alloc.allocate(1);
+#if defined(HPX_ALLOCATOR_SUPPORT_HAVE_CACHING)
+        HPX_TEST_EQ(p, q);
+#endif
+        alloc.deallocate(q, 1);
+
+        // blocks beyond the capacity are released to the underlying allocator
+        std::vector<block*> blocks;
+        for (int i = 0; i != 8; ++i)
+        {
+            blocks.push_back(alloc.allocate(1));
+        }
+        for (block* b : blocks)
+        {
+            alloc.deallocate(b, 1);
+        }
+    }).join();
+
+    // the cached blocks are freed when the thread exits
+    HPX_TEST_EQ(outstanding.load(), static_cast<std::ptrdiff_t>(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Releases its blocks from its destructor. It is constructed before the
+// free list cleanup of the allocator and hence destroyed after it.
+struct late_release
+{
+    std::vector<block*> blocks;
+
+    ~late_release()
+    {
+        allocator_type alloc;
+        for (block* b : blocks)
+        {
+            alloc.deallocate(b, 1);
+        }
+    }
+};
+
+void test_release_after_cleanup()
+{
+    std::thread([] {
+        static thread_local late_release holder;
+
+        allocator_type alloc;
+        block* p = alloc.allocate(1);
+        for (int i = 0; i != 2; ++i)
+        {
+            holder.blocks.push_back(alloc.allocate(1));
+        }
+
+        // the first cached block creates the cleanup object
+        alloc.deallocate(p, 1);
+    }).join();
+
+    // the blocks released after the cleanup are not cached
+    HPX_TEST_EQ(outstanding.load(), static_cast<std::ptrdiff_t>(0));
+}
+
+int main()
+{
+    test_recycling();
+    test_release_after_cleanup();
+
+    return hpx::util::report_errors();
+}
@@ -29,11 +29,12 @@ namespace hpx {
         sync = 0x08,
         fork = 0x10,    // same as async, but forces continuation stealing
         apply = 0x20,
+        adaptive = 0x40,    // continuations only: run inline if possible
 
         sync_policies = 0x0a,     // sync | deferred
-        async_policies = 0x15,    // async | task | fork
-        all = 0x3f                // async | deferred | task | sync |
-                                  // fork | apply
+        async_policies = 0x55,    // async | task | fork | adaptive
+        all = 0x7f                // async | deferred | task | sync |
+                                  // fork | apply | adaptive
     };
 
     /// \cond NOINTERNAL
@@ -551,6 +552,71 @@ namespace hpx {
             }
         };
 
+        struct adaptive_policy : policy_holder<adaptive_policy>
+        {
+            constexpr explicit adaptive_policy(
+                threads::thread_priority const priority =
+                    threads::thread_priority::default_,
+                threads::thread_stacksize const stacksize =
+                    threads::thread_stacksize::default_,
+                threads::thread_schedule_hint const hint = {}) noexcept
+              : policy_holder<adaptive_policy>(
+                    launch_policy::adaptive, priority, stacksize, hint)
+            {
+            }
+
+            friend adaptive_policy tag_invoke(
+                hpx::execution::experimental::with_priority_t,
+                adaptive_policy const policy,
+                threads::thread_priority const priority) noexcept
+            {
+                auto policy_with_priority = policy;
+                policy_with_priority.set_priority(priority);
+                return policy_with_priority;
+            }
+
+            friend constexpr hpx::threads::thread_priority tag_invoke(
+                hpx::execution::experimental::get_priority_t,
+                adaptive_policy const policy) noexcept
+            {
+                return policy.priority();
+            }
+
+            friend adaptive_policy tag_invoke(
+                hpx::execution::experimental::with_stacksize_t,
+                adaptive_policy const policy,
+                threads::thread_stacksize const stacksize) noexcept
+            {
+                auto policy_with_stacksize = policy;
+                policy_with_stacksize.set_stacksize(stacksize);
+                return policy_with_stacksize;
+            }
+
+            friend constexpr hpx::threads::thread_stacksize tag_invoke(
+                hpx::execution::experimental::get_stacksize_t,
+                adaptive_policy const policy) noexcept
+            {
+                return policy.stacksize();
+            }
+
+            friend adaptive_policy tag_invoke(
+                hpx::execution::experimental::with_hint_t,
+                adaptive_policy const policy,
+                threads::thread_schedule_hint const hint) noexcept
+            {
+                auto policy_with_hint = policy;
+                policy_with_hint.set_hint(hint);
+                return policy_with_hint;
+            }
+
+            friend constexpr hpx::threads::thread_schedule_hint tag_invoke(
+                hpx::execution::experimental::get_hint_t,
+                adaptive_policy const policy) noexcept
+            {
+                return policy.hint();
+            }
+        };
+
         template <typename Pred>
         struct select_policy : policy_holder<select_policy<Pred>>
         {
@@ -804,6 +870,14 @@ namespace hpx {
         {
         }
 
+        /// Create a launch policy representing adaptive execution of
+        /// continuations
+        constexpr launch(detail::adaptive_policy const p) noexcept
+          : detail::policy_holder<>{launch_policy::adaptive, p.priority(),
+                p.stacksize(), p.hint()}
+        {
+        }
+
         /// Create a launch policy representing fire and forget execution
         template <typename F>
         constexpr launch(detail::select_policy<F> const& p) noexcept
@@ -878,6 +952,7 @@ namespace hpx {
         using sync_policy = detail::sync_policy;
         using deferred_policy = detail::deferred_policy;
         using apply_policy = detail::apply_policy;
+        using adaptive_policy = detail::adaptive_policy;
         template <typename F>
         using select_policy = detail::select_policy<F>;
         /// \endcond
@@ -899,6 +974,15 @@ namespace hpx {
         /// Predefined launch policy representing fire and forget execution
         HPX_CORE_EXPORT static detail::apply_policy const apply;
 
+        /// Predefined launch policy for continuations (future::then) that
+        /// runs the continuation inline on the thread that made the
+        /// antecedent future ready, as long as the number of nested inline
+        /// continuations stays below the configured limit
+        /// (hpx.continuation_inline_depth) and enough stack space is left.
+        /// Otherwise the continuation is run on a new thread. Used with
+        /// hpx::async and friends it behaves like launch::async.
+        HPX_CORE_EXPORT static detail::adaptive_policy const adaptive;
+
         /// Predefined launch policy representing delayed policy selection
         HPX_CORE_EXPORT static detail::select_policy_generator const select;
 
@@ -925,5 +1009,25 @@ namespace hpx {
         return static_cast<bool>(static_cast<int>(p.policy()) &
             static_cast<int>(launch_policy::async_policies));
     }
+
+    // A policy is adaptive only if adaptive is the sole asynchronous launch
+    // mode it allows. Policies combining several modes (like launch::all)
+    // spawn a new thread as before.
+    HPX_CXX_CORE_EXPORT HPX_FORCEINLINE constexpr bool has_adaptive_policy(
+        launch const p) noexcept
+    {
+        return (static_cast<int>(p.get_policy()) &
+                   static_cast<int>(launch_policy::async_policies)) ==
+            static_cast<int>(launch_policy::adaptive);
+    }
+
+    HPX_CXX_CORE_EXPORT template <typename F>
+    HPX_FORCEINLINE constexpr bool has_adaptive_policy(
+        detail::policy_holder<F> const& p) noexcept
+    {
+        return (static_cast<int>(p.policy()) &
+                   static_cast<int>(launch_policy::async_policies)) ==
+            static_cast<int>(launch_policy::adaptive);
+    }
     /// \endcond
 }    // namespace hpx
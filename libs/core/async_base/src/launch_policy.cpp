@@ -21,6 +21,8 @@ namespace hpx {
     detail::sync_policy const launch::sync = detail::sync_policy{};
     detail::deferred_policy const launch::deferred = detail::deferred_policy{};
     detail::apply_policy const launch::apply = detail::apply_policy{};
+    detail::adaptive_policy const launch::adaptive =
+        detail::adaptive_policy{};
 
     detail::select_policy_generator const launch::select =
         detail::select_policy_generator{};
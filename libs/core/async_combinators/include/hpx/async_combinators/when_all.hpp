@@ -133,9 +133,11 @@ namespace hpx {
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/datastructures.hpp>
 #include <hpx/modules/futures.hpp>
+#include <hpx/modules/memory.hpp>
 #include <hpx/modules/pack_traversal.hpp>
 #include <hpx/modules/tag_invoke.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <iterator>
 #include <type_traits>
@@ -211,17 +213,97 @@ namespace hpx::lcos::detail {
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // when_all for a single range of futures. Instead of traversing the range
+    // and re-checking the remaining elements whenever the awaited one becomes
+    // ready, a callback is attached to each of the futures that are not ready
+    // yet. The callbacks count down an atomic counter, the last one makes the
+    // aggregate state ready. Each callback holds a pointer to the aggregate
+    // state only, it is stored inline in the shared state of the input
+    // future, no allocation is needed per element.
+    template <typename Container>
+    class when_all_range_frame : public future_data<Container>
+    {
+    public:
+        using type = hpx::future<Container>;
+        using base_type = hpx::lcos::detail::future_data<Container>;
+        using init_no_addref = typename base_type::init_no_addref;
+
+        when_all_range_frame(init_no_addref no_addref, Container&& values)
+          : base_type(no_addref)
+          , values_(HPX_MOVE(values))
+          , pending_(1)
+        {
+        }
+
+        void attach()
+        {
+            // one reference to this frame is held on behalf of all pending
+            // callbacks, it is released once the last of them has run
+            intrusive_ptr_add_ref(this);
+
+            for (auto& value : values_)
+            {
+                auto const& state = traits::detail::get_shared_state(value);
+                if (!state || state->is_ready(std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                // execute_deferred might make the future ready
+                state->execute_deferred();
+                if (state->is_ready())
+                {
+                    continue;
+                }
+
+                pending_.fetch_add(1, std::memory_order_relaxed);
+                state->set_on_completed([this]() { on_completed(); });
+            }
+
+            // release the count held while attaching the callbacks
+            on_completed();
+        }
+
+    private:
+        void on_completed()
+        {
+            if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                // adopt the reference taken in attach()
+                hpx::intrusive_ptr<when_all_range_frame> this_(this, false);
+                this->set_value(HPX_MOVE(values_));
+            }
+        }
+
+        Container values_;
+        std::atomic<std::size_t> pending_;
+    };
+
+    template <typename Container>
+    hpx::future<Container> when_all_range_impl(Container&& values)
+    {
+        using frame_type = when_all_range_frame<Container>;
+        using no_addref = typename frame_type::init_no_addref;
+
+        hpx::intrusive_ptr<frame_type> frame(
+            new frame_type(no_addref{}, HPX_MOVE(values)), false);
+        frame->attach();
+
+        return hpx::traits::future_access<hpx::future<Container>>::create(
+            HPX_MOVE(frame));
+    }
+
     template <typename... T>
     typename async_when_all_frame<
         hpx::tuple<hpx::traits::acquire_future_t<T>...>>::type
-    when_all_impl(T&&... args)
+    when_all_traverse_impl(T&&... args)
     {
         using result_type = hpx::tuple<hpx::traits::acquire_future_t<T>...>;
         using frame_type = async_when_all_frame<result_type>;
         using no_addref = typename frame_type::base_type::init_no_addref;
 
-        using allocator_type = hpx::util::thread_local_caching_allocator<
-            hpx::lockfree::variable_size_stack,
+        using allocator_type = hpx::util::thread_local_recycling_allocator<
             hpx::util::internal_allocator<>>;
         auto frame = hpx::util::traverse_pack_async_allocator(allocator_type{},
             hpx::util::async_traverse_in_place_tag<frame_type>{}, no_addref{},
@@ -230,6 +312,29 @@ namespace hpx::lcos::detail {
         return hpx::traits::future_access<typename frame_type::type>::create(
             HPX_MOVE(frame));
     }
+
+    template <typename... T>
+    inline constexpr bool is_when_all_range_v = false;
+
+    template <typename T>
+    inline constexpr bool is_when_all_range_v<T> =
+        hpx::traits::is_future_range_v<hpx::traits::acquire_future_t<T>>;
+
+    template <typename... T>
+    typename async_when_all_frame<
+        hpx::tuple<hpx::traits::acquire_future_t<T>...>>::type
+    when_all_impl(T&&... args)
+    {
+        if constexpr (is_when_all_range_v<T...>)
+        {
+            return when_all_range_impl(
+                hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...);
+        }
+        else
+        {
+            return when_all_traverse_impl(HPX_FORWARD(T, args)...);
+        }
+    }
 }    // namespace hpx::lcos::detail
 
 namespace hpx {
@@ -125,9 +125,9 @@ namespace hpx {
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/when_any.hpp>
 #include <hpx/modules/datastructures.hpp>
-#include <hpx/modules/execution_base.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/futures.hpp>
+#include <hpx/modules/memory.hpp>
 #include <hpx/modules/tag_invoke.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/modules/util.hpp>
@@ -207,12 +207,13 @@ namespace hpx::lcos::detail {
 
     ///////////////////////////////////////////////////////////////////////
     template <typename Sequence>
-    struct when_any;
+    class when_any_frame;
 
     template <typename Sequence>
     struct set_when_any_callback_impl
     {
-        explicit set_when_any_callback_impl(when_any<Sequence>& when) noexcept
+        explicit set_when_any_callback_impl(
+            when_any_frame<Sequence>& when) noexcept
           : when_(when)
           , idx_(0)
         {
@@ -222,9 +223,9 @@ namespace hpx::lcos::detail {
         std::enable_if_t<hpx::traits::is_future_v<Future>> operator()(
             Future& future) const
         {
-            std::size_t index = when_.index_.load(std::memory_order_seq_cst);
-
-            if (index == when_any_result<Sequence>::index_error())
+            // do not touch any more futures once one is known to be ready
+            if (when_.index_.load(std::memory_order_relaxed) ==
+                when_any_result<Sequence>::index_error())
             {
                 using shared_state_ptr =
                     hpx::traits::detail::shared_state_ptr_for_t<Future>;
@@ -234,27 +235,25 @@ namespace hpx::lcos::detail {
                 if (shared_state &&
                     !shared_state->is_ready(std::memory_order_relaxed))
                 {
-                    // handle future only if not enough futures are ready
-                    // yet also, do not touch any futures which are already
-                    // ready
                     shared_state->execute_deferred();
 
                     // execute_deferred might have made the future ready
                     if (!shared_state->is_ready(std::memory_order_relaxed))
                     {
-                        shared_state->set_on_completed(util::deferred_call(
-                            &detail::when_any<Sequence>::on_future_ready,
-                            when_.shared_from_this(), idx_,
-                            hpx::execution_base::this_thread::agent()));
+                        // the callback consists of a pointer and an index
+                        // only, it does not require a separate allocation
+                        hpx::intrusive_ptr<when_any_frame<Sequence>> when(
+                            &when_);
+                        shared_state->set_on_completed(
+                            [when = HPX_MOVE(when), idx = idx_]() {
+                                when->on_future_ready(idx);
+                            });
                         ++idx_;
                         return;
                     }
                 }
 
-                if (when_.index_.compare_exchange_strong(index, idx_))
-                {
-                    when_.goal_reached_on_calling_thread_ = true;
-                }
+                when_.on_future_ready(idx_);
             }
             ++idx_;
         }
@@ -286,87 +285,85 @@ namespace hpx::lcos::detail {
             std::for_each(sequence.begin(), sequence.end(), *this);
         }
 
-        detail::when_any<Sequence>& when_;
+        when_any_frame<Sequence>& when_;
         mutable std::size_t idx_;
     };
 
+    // The shared state of the future returned from when_any. The first input
+    // future to become ready claims the index using a single CAS operation.
+    // The result is published once the index has been claimed and all
+    // callbacks have been attached, whichever happens last; no thread is
+    // spawned or suspended while waiting.
     template <typename Sequence>
-    HPX_FORCEINLINE void set_on_completed_callback(
-        detail::when_any<Sequence>& when)
+    class when_any_frame : public future_data<when_any_result<Sequence>>
     {
-        set_when_any_callback_impl<Sequence> callback(when);
-        callback.apply(when.lazy_values_.futures);
-    }
-
-    ///////////////////////////////////////////////////////////////////////
-    template <typename Sequence>
-    struct when_any
-      : std::enable_shared_from_this<when_any<Sequence>>    //-V690
-    {
-    public:
-        void on_future_ready(
-            std::size_t idx, hpx::execution_base::agent_ref ctx)
-        {
-            std::size_t index_not_initialized =
-                when_any_result<Sequence>::index_error();
-            if (index_.compare_exchange_strong(index_not_initialized, idx))
-            {
-                // reactivate waiting thread only if it's not the executing
-                if (ctx != hpx::execution_base::this_thread::agent())
-                {
-                    ctx.resume();
-                }
-                else
-                {
-                    goal_reached_on_calling_thread_ = true;
-                }
-            }
-        }
+        using base_type = future_data<when_any_result<Sequence>>;
 
-    private:
-        when_any(when_any const&) = delete;
-        when_any(when_any&) = delete;
-
-        when_any& operator=(when_any const&) = delete;
-        when_any& operator=(when_any&&) = delete;
+        friend struct set_when_any_callback_impl<Sequence>;
 
     public:
-        using argument_type = Sequence;
+        using init_no_addref = typename base_type::init_no_addref;
 
-        explicit when_any(argument_type&& lazy_values) noexcept
-          : lazy_values_(HPX_MOVE(lazy_values))
+        when_any_frame(init_no_addref no_addref, Sequence&& lazy_values)
+          : base_type(no_addref)
+          , lazy_values_(HPX_MOVE(lazy_values))
           , index_(when_any_result<Sequence>::index_error())
-          , goal_reached_on_calling_thread_(false)
+          , pending_(2)
         {
         }
 
-        when_any_result<Sequence> operator()()
+        void attach()
         {
-            // set callback functions to executed when future is ready
-            set_on_completed_callback(*this);
+            set_when_any_callback_impl<Sequence> callback(*this);
+            callback.apply(lazy_values_.futures);
 
-            // if one of the requested futures is already set, our
-            // callback above has already been called often enough, otherwise
-            // we suspend ourselves
-            if (!goal_reached_on_calling_thread_)
+            // an empty sequence is ready right away (with an invalid index)
+            if (callback.idx_ == 0)
             {
-                // wait for any of the futures to return to become ready
-                hpx::execution_base::this_thread::suspend(
-                    "hpx::lcos::detail::when_any::operator()");
+                release();
             }
+            release();
+        }
 
-            // that should not happen
-            HPX_ASSERT(
-                index_.load() != when_any_result<Sequence>::index_error());
+        void on_future_ready(std::size_t idx)
+        {
+            std::size_t index_not_initialized =
+                when_any_result<Sequence>::index_error();
+            if (index_.compare_exchange_strong(index_not_initialized, idx,
+                    std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                release();
+            }
+        }
 
-            lazy_values_.index = index_.load();
-            return HPX_MOVE(lazy_values_);
+    private:
+        void release()
+        {
+            if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                lazy_values_.index = index_.load(std::memory_order_relaxed);
+                this->set_value(HPX_MOVE(lazy_values_));
+            }
         }
 
         when_any_result<Sequence> lazy_values_;
         std::atomic<std::size_t> index_;
-        bool goal_reached_on_calling_thread_;
+        std::atomic<int> pending_;
     };
+
+    template <typename Sequence>
+    hpx::future<when_any_result<Sequence>> when_any_impl(Sequence&& values)
+    {
+        using frame_type = when_any_frame<Sequence>;
+        using init_no_addref = typename frame_type::init_no_addref;
+
+        hpx::intrusive_ptr<frame_type> frame(
+            new frame_type(init_no_addref{}, HPX_MOVE(values)), false);
+        frame->attach();
+
+        return hpx::traits::future_access<
+            hpx::future<when_any_result<Sequence>>>::create(HPX_MOVE(frame));
+    }
 }    // namespace hpx::lcos::detail
 
 namespace hpx {
@@ -384,18 +381,8 @@ namespace hpx {
         {
             using result_type = std::decay_t<Range>;
 
-            auto f = std::make_shared<lcos::detail::when_any<result_type>>(
+            return lcos::detail::when_any_impl(
                 hpx::traits::acquire_future<result_type>()(values));
-
-            lcos::local::futures_factory<hpx::when_any_result<result_type>()> p(
-                [f = HPX_MOVE(f)]() -> hpx::when_any_result<result_type> {
-                    return (*f)();
-                });
-
-            auto result = p.get_future();
-            p.post();
-
-            return result;
         }
 
         template <typename Iterator,
@@ -433,18 +420,7 @@ namespace hpx {
             result_type values(
                 func(HPX_FORWARD(T, t)), func(HPX_FORWARD(Ts, ts))...);
 
-            auto f = std::make_shared<lcos::detail::when_any<result_type>>(
-                HPX_MOVE(values));
-
-            lcos::local::futures_factory<hpx::when_any_result<result_type>()> p(
-                [f = HPX_MOVE(f)]() -> hpx::when_any_result<result_type> {
-                    return (*f)();
-                });
-
-            auto result = p.get_future();
-            p.post();
-
-            return result;
+            return lcos::detail::when_any_impl(HPX_MOVE(values));
         }
     } when_any{};
 
@@ -12,6 +12,7 @@
 #include <hpx/thread.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <list>
 #include <memory>
@@ -243,6 +244,50 @@ void test_when_all_deferred_futures()
     HPX_TEST(hpx::get<1>(result).is_ready());
 }
 
+void test_when_all_many_futures()
+{
+    std::size_t const count = 10000;
+
+    std::vector<hpx::promise<int>> promises(count);
+    std::vector<hpx::future<int>> futures;
+    futures.reserve(count);
+    for (auto& p : promises)
+        futures.push_back(p.get_future());
+
+    // make some of the futures ready before calling when_all
+    for (std::size_t j = 0; j < count; j += 2)
+        promises[j].set_value(static_cast<int>(j));
+
+    hpx::future<std::vector<hpx::future<int>>> r = hpx::when_all(futures);
+    HPX_TEST(!r.is_ready());
+
+    std::vector<hpx::future<void>> setters;
+    for (std::size_t j = 1; j < count; j += 2)
+    {
+        setters.push_back(hpx::async(
+            [&promises, j]() { promises[j].set_value(static_cast<int>(j)); }));
+    }
+
+    std::vector<hpx::future<int>> result = r.get();
+    hpx::wait_all(setters);
+
+    HPX_TEST_EQ(result.size(), count);
+    for (std::size_t j = 0; j != count; ++j)
+    {
+        HPX_TEST(result[j].is_ready());
+        HPX_TEST_EQ(result[j].get(), static_cast<int>(j));
+    }
+}
+
+void test_when_all_empty_range()
+{
+    std::vector<hpx::future<int>> futures;
+
+    hpx::future<std::vector<hpx::future<int>>> r = hpx::when_all(futures);
+    HPX_TEST(r.is_ready());
+    HPX_TEST(r.get().empty());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using hpx::program_options::options_description;
 using hpx::program_options::variables_map;
@@ -261,6 +306,8 @@ int hpx_main(variables_map&)
         test_when_all_five_futures();
         test_when_all_late_futures();
         test_when_all_deferred_futures();
+        test_when_all_many_futures();
+        test_when_all_empty_range();
     }
 
     hpx::local::finalize();
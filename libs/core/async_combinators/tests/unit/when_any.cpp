@@ -12,6 +12,7 @@
 #include <hpx/thread.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <list>
 #include <memory>
@@ -644,6 +645,52 @@ void test_wait_for_either_of_two_deferred_futures()
     HPX_TEST_EQ(hpx::get<0>(t).get(), 42);
 }
 
+void test_wait_for_either_of_many_futures()
+{
+    std::size_t const count = 10000;
+
+    std::vector<hpx::promise<int>> promises(count);
+    std::vector<hpx::future<int>> futures;
+    futures.reserve(count);
+    for (auto& p : promises)
+        futures.push_back(p.get_future());
+
+    hpx::future<hpx::when_any_result<std::vector<hpx::future<int>>>> r =
+        hpx::when_any(futures);
+    HPX_TEST(!r.is_ready());
+
+    std::size_t const ready = count / 3;
+    hpx::future<void> f = hpx::async(
+        [&promises, ready]() { promises[ready].set_value(42); });
+
+    hpx::when_any_result<std::vector<hpx::future<int>>> result = r.get();
+    f.get();
+
+    HPX_TEST_EQ(result.index, ready);
+    HPX_TEST_EQ(result.futures.size(), count);
+    HPX_TEST_EQ(result.futures[ready].get(), 42);
+
+    for (std::size_t j = 0; j != count; ++j)
+    {
+        if (j != ready)
+            promises[j].set_value(0);
+    }
+}
+
+void test_wait_for_any_from_empty_range()
+{
+    std::vector<hpx::future<int>> futures;
+
+    hpx::future<hpx::when_any_result<std::vector<hpx::future<int>>>> r =
+        hpx::when_any(futures);
+    HPX_TEST(r.is_ready());
+
+    hpx::when_any_result<std::vector<hpx::future<int>>> result = r.get();
+    HPX_TEST_EQ(result.index,
+        hpx::when_any_result<std::vector<hpx::future<int>>>::index_error());
+    HPX_TEST(result.futures.empty());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using hpx::program_options::options_description;
 using hpx::program_options::variables_map;
@@ -675,6 +722,8 @@ int hpx_main(variables_map&)
         //         test_wait_for_any_from_range();
         test_wait_for_either_of_two_late_futures();
         test_wait_for_either_of_two_deferred_futures();
+        test_wait_for_either_of_many_futures();
+        test_wait_for_any_from_empty_range();
     }
 
     hpx::local::finalize();
@@ -631,6 +631,25 @@ namespace hpx::local::detail {
         // handle high-priority threads
         handle_high_priority_threads(vm, ini_config);
 
+        // enable the sampling profiler
+        if (vm.count("hpx:sample-profile"))
+        {
+            ini_config.emplace_back("hpx.sampling_profiler.file!=" +
+                vm["hpx:sample-profile"].as<std::string>());
+        }
+        if (vm.count("hpx:sample-frequency"))
+        {
+            ini_config.emplace_back("hpx.sampling_profiler.frequency!=" +
+                std::to_string(vm["hpx:sample-frequency"].as<std::size_t>()));
+        }
+
+        // report the lock contention
+        if (vm.count("hpx:lock-contention-report"))
+        {
+            ini_config.emplace_back("hpx.lock_contention.report!=" +
+                vm["hpx:lock-contention-report"].as<std::string>());
+        }
+
 #if !defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
         if (debug_clp)
         {
@@ -616,6 +616,18 @@ namespace hpx::local::detail {
             ("hpx:debug-app-log", value<std::string>()->implicit_value("cout"),
                 "enable all messages on the application log channel and send all "
                 "application logs to the target destination")
+            ("hpx:sample-profile",
+                value<std::string>()->implicit_value("hpx.folded"),
+                "enable the built-in sampling profiler and write the folded "
+                "call stacks to the given file (default: hpx.folded)")
+            ("hpx:sample-frequency", value<std::size_t>(),
+                "number of samples the sampling profiler takes per second of "
+                "consumed CPU time (default: 100)")
+            ("hpx:lock-contention-report",
+                value<std::string>()->implicit_value("cout"),
+                "record the wait time and number of acquisitions of the HPX "
+                "locks per lock site and write a report to the given "
+                "destination at shutdown (default: cout)")
             // ("hpx:verbose_bench", "For logging benchmarks in detail")
         ;
 
@@ -220,6 +220,79 @@ namespace hpx::concurrency::detail {
             }
         }
 
+        /// \brief Attempt to steal half of the items from the given end of the
+        ///        queue.
+        ///
+        /// Attempt to remove half of the items left in the queue (at least
+        /// one) from the given end of the queue. The removed items are
+        /// returned as a tuple (first, last, step) describing the range
+        /// [first, last) in the same way as get_current_range. If no items
+        /// are left hpx::nullopt is returned.
+        template <queue_end Which>
+        hpx::optional<hpx::tuple<T, T, T>> steal_half() noexcept
+        {
+            range desired_range{0, 0};
+            range stolen_range{0, 0};
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (expected_range.empty())
+                {
+                    return hpx::optional<hpx::tuple<T, T, T>>(hpx::nullopt);
+                }
+
+                // reduce pipeline pressure
+                HPX_SMT_PAUSE;
+
+                T const count =
+                    (expected_range.last - expected_range.first) / step;
+                T const stolen = count > 1 ? count / 2 : 1;
+
+                if constexpr (Which == queue_end::left)
+                {
+                    T const split = expected_range.first + stolen * step;
+                    stolen_range = range{expected_range.first, split};
+                    desired_range = range{split, expected_range.last};
+                }
+                else
+                {
+                    T const split = expected_range.last - stolen * step;
+                    stolen_range = range{split, expected_range.last};
+                    desired_range = range{expected_range.first, split};
+                }
+
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            return hpx::optional<hpx::tuple<T, T, T>>(
+                hpx::tuple<T, T, T>(
+                    stolen_range.first, stolen_range.last, step));
+        }
+
+        /// \brief Refill an empty queue with the given range.
+        ///
+        /// Refill the queue with a range of items that has been stolen from
+        /// another queue using the same step. Only the thread that is
+        /// popping items from this queue may refill it, and only after it has
+        /// found the queue to be empty. Other threads may concurrently
+        /// attempt to pop or steal items from the queue.
+        ///
+        /// \param first Beginning of the new range.
+        /// \param last  End of the new range.
+        /// \param step_ Step size of the new range, has to be equal to the
+        ///              step size of this queue.
+        void refill(T first, T last, [[maybe_unused]] T step_) noexcept
+        {
+            HPX_ASSERT(empty());
+            HPX_ASSERT(step_ == step);
+            HPX_ASSERT(first <= last && (last - first) % step == 0);
+
+            current_range.data_.store(
+                range{first, last}, std::memory_order_release);
+        }
+
         constexpr bool empty() const noexcept
         {
             return current_range.data_.load(std::memory_order_relaxed).empty();
@@ -16,6 +16,7 @@
 #include <hpx/modules/tracy.hpp>
 #endif
 
+#include <cstdint>
 #include <string>
 #include <utility>
 
@@ -69,12 +70,24 @@ namespace hpx::util {
 #if defined(HPX_HAVE_MODULE_TRACY)
             bool const run_after = hpx::tracy::lock_prepare(context_);
 #endif
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            std::int64_t wait_start = 0;
+            if (!m.try_lock())
+            {
+                wait_start = util::lock_contention_start();
+                m.lock();
+            }
+#else
             m.lock();
+#endif
 
             HPX_ITT_SYNC_ACQUIRED(this);
 #if defined(HPX_HAVE_MODULE_TRACY)
             if (run_after)
                 hpx::tracy::lock_acquired(context_);
+#endif
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            util::record_lock_acquisition(wait_start);
 #endif
             util::register_lock(this);
         }
@@ -443,6 +443,17 @@
 #endif
 #endif
 
+// This is the default for how many nested continuations launched with
+// hpx::launch::adaptive are run inline before the next one is spawned as a new
+// thread (see the configuration setting hpx.continuation_inline_depth).
+#if !defined(HPX_CONTINUATION_INLINE_DEPTH)
+#if defined(HPX_DEBUG)
+#define HPX_CONTINUATION_INLINE_DEPTH 8
+#else
+#define HPX_CONTINUATION_INLINE_DEPTH 16
+#endif
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Make sure we have support for more than 64 threads for Xeon Phi
 #if defined(__MIC__) && !defined(HPX_HAVE_MORE_THAN_64_THREADS)
@@ -18,52 +18,17 @@
 #include <hpx/modules/concepts.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/execution_base.hpp>
-#include <hpx/modules/memory.hpp>
 #include <hpx/modules/synchronization.hpp>
-#include <hpx/modules/thread_support.hpp>
 #include <hpx/modules/type_support.hpp>
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <exception>
-#include <mutex>
 #include <type_traits>
 
 namespace hpx::execution::experimental {
 
-    namespace detail {
-
-        HPX_CXX_CORE_EXPORT struct run_loop_data;
-
-        HPX_CORE_EXPORT void intrusive_ptr_add_ref(run_loop_data* p) noexcept;
-        HPX_CORE_EXPORT void intrusive_ptr_release(run_loop_data* p) noexcept;
-
-        HPX_CXX_CORE_EXPORT struct run_loop_data
-        {
-            using mutex_type = hpx::spinlock;
-
-            run_loop_data() noexcept
-              : count_(1)
-            {
-            }
-
-            run_loop_data(run_loop_data const&) = delete;
-            run_loop_data(run_loop_data&&) = delete;
-            run_loop_data& operator=(run_loop_data const&) = delete;
-            run_loop_data& operator=(run_loop_data&&) = delete;
-
-            ~run_loop_data() = default;
-
-            mutable mutex_type mtx_;
-
-        private:
-            friend HPX_CORE_EXPORT void intrusive_ptr_add_ref(
-                run_loop_data*) noexcept;
-            friend HPX_CORE_EXPORT void intrusive_ptr_release(
-                run_loop_data*) noexcept;
-
-            hpx::util::atomic_count count_;
-        };
-    }    // namespace detail
-
     // A run_loop is an execution context on which work can be scheduled. It
     // maintains a simple, thread-safe first-in-first-out queue of work. Its
     // run() member function removes elements from the queue and executes them
@@ -85,16 +50,9 @@ namespace hpx::execution::experimental {
     {
         struct run_loop_opstate_base
         {
-            explicit run_loop_opstate_base(run_loop_opstate_base* tail) noexcept
-              : next(this)
-              , tail(tail)
-            {
-            }
-
-            run_loop_opstate_base(run_loop_opstate_base* tail,
+            explicit run_loop_opstate_base(
                 void (*execute)(run_loop_opstate_base*) noexcept) noexcept
-              : next(tail)
-              , execute_(execute)
+              : execute_(execute)
             {
             }
 
@@ -106,12 +64,8 @@ namespace hpx::execution::experimental {
 
             ~run_loop_opstate_base() = default;
 
-            run_loop_opstate_base* next;
-            union
-            {
-                void (*execute_)(run_loop_opstate_base*) noexcept;
-                run_loop_opstate_base* tail;
-            };
+            run_loop_opstate_base* next = nullptr;
+            void (*execute_)(run_loop_opstate_base*) noexcept;
 
             void execute() noexcept
             {
@@ -132,11 +86,10 @@ namespace hpx::execution::experimental {
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
 
                 template <typename Receiver_>
-                type(run_loop_opstate_base* tail, run_loop& loop,
-                    Receiver_&& receiver) noexcept(noexcept(std::
-                        is_nothrow_constructible_v<std::decay_t<Receiver>,
-                            Receiver_>))
-                  : run_loop_opstate_base(tail)
+                type(run_loop& loop, Receiver_&& receiver) noexcept(
+                    std::is_nothrow_constructible_v<std::decay_t<Receiver>,
+                        Receiver_>)
+                  : run_loop_opstate_base(&execute)
                   , loop(loop)
                   , receiver(HPX_FORWARD(Receiver_, receiver))
                 {
@@ -165,13 +118,6 @@ namespace hpx::execution::experimental {
                         });
                 }
 
-                type(run_loop_opstate_base* next, run_loop& loop, Receiver r)
-                  : run_loop_opstate_base(next, &execute)
-                  , loop(loop)
-                  , receiver(HPX_MOVE(r))
-                {
-                }
-
                 friend void tag_invoke(
                     hpx::execution::experimental::start_t, type& os) noexcept
                 {
@@ -211,12 +157,12 @@ namespace hpx::execution::experimental {
                 friend operation_state<Receiver> tag_invoke(
                     hpx::execution::experimental::connect_t,
                     run_loop_sender const& s,
-                    Receiver&& receiver) noexcept(noexcept(std::
+                    Receiver&& receiver) noexcept(std::
                         is_nothrow_constructible_v<operation_state<Receiver>,
-                            run_loop_opstate_base*, run_loop&>))
+                            run_loop&, Receiver>)
                 {
                     return operation_state<Receiver>(
-                        &s.loop.head, s.loop, HPX_FORWARD(Receiver, receiver));
+                        s.loop, HPX_FORWARD(Receiver, receiver));
                 }
 
                 // clang-format off
@@ -301,58 +247,118 @@ namespace hpx::execution::experimental {
     private:
         friend struct run_loop_scheduler::run_loop_sender;
 
-        hpx::intrusive_ptr<detail::run_loop_data> mtx;
-        hpx::lcos::local::detail::condition_variable cond_var;
+        // The queue is a lock-free list of operation states that is pushed to
+        // by any number of threads (LIFO). The thread executing run() takes
+        // all queued items at once and reverses their order, which restores
+        // FIFO order. The lowest bit of the list head is set while the thread
+        // executing run() is waiting for new items, only then do producers
+        // need to acquire the mutex and notify the condition variable.
+        static constexpr std::uintptr_t waiting_bit = 1;
 
-        // MSVC and gcc don't properly handle the friend declaration above
-#if defined(HPX_MSVC) || defined(HPX_GCC_VERSION)
-    public:
-#endif
-        run_loop_opstate_base head;
+        // number of spin iterations before the thread executing run() starts
+        // waiting on the condition variable
+        static constexpr std::size_t spin_count = 32;
 
-    private:
-        bool stop = false;
+        std::atomic<std::uintptr_t> queue_{0};
+        std::atomic<bool> stop_{false};
+
+        // items taken from queue_, accessed by the thread executing run() only
+        run_loop_opstate_base* pending_ = nullptr;
 
-        void push_back(run_loop_opstate_base* t)
+        // number of threads currently inside push_back() or finish(), those
+        // may access the run_loop after run() has returned
+        std::atomic<std::size_t> active_{0};
+
+        hpx::spinlock mtx_;
+        hpx::lcos::local::detail::condition_variable cond_var_;
+
+        void push_back(run_loop_opstate_base* t) noexcept
         {
-            auto const local_mtx = mtx;    // keep alive
-            std::unique_lock l(local_mtx->mtx_);
+            active_.fetch_add(1, std::memory_order_relaxed);
+
+            stop_.store(false, std::memory_order_relaxed);
+
+            std::uintptr_t old = queue_.load(std::memory_order_relaxed);
+            do
+            {
+                t->next = reinterpret_cast<run_loop_opstate_base*>(
+                    old & ~waiting_bit);
+            } while (!queue_.compare_exchange_weak(old,
+                reinterpret_cast<std::uintptr_t>(t), std::memory_order_seq_cst,
+                std::memory_order_relaxed));
+
+            if (old & waiting_bit)
+            {
+                notify_waiting(false);
+            }
 
-            stop = false;
-            t->next = &head;
-            head.tail = head.tail->next = t;
-            cond_var.notify_one(HPX_MOVE(l));
+            active_.fetch_sub(1, std::memory_order_release);
         }
 
         run_loop_opstate_base* pop_front()
         {
-            auto const local_mtx = mtx;    // keep alive
-            std::unique_lock l(local_mtx->mtx_);
-
-            while (head.next == &head && !stop)
+            for (std::size_t k = 0; /**/; ++k)
             {
-                cond_var.wait(l);
+                if (pending_ != nullptr)
+                {
+                    run_loop_opstate_base* t = pending_;
+                    pending_ = t->next;
+                    return t;
+                }
+
+                if (queue_.load(std::memory_order_relaxed) != 0)
+                {
+                    take_all();
+                    continue;
+                }
+
+                if (stop_.load(std::memory_order_acquire))
+                {
+                    // items pushed before finish() was called are visible now
+                    if (queue_.load(std::memory_order_acquire) == 0)
+                    {
+                        return nullptr;
+                    }
+                    continue;
+                }
+
+                if (k < spin_count)
+                {
+                    hpx::util::detail::yield_k(k, "run_loop::pop_front");
+                }
+                else
+                {
+                    wait_for_work();
+                    k = 0;
+                }
             }
+        }
+
+        void take_all() noexcept
+        {
+            HPX_ASSERT(pending_ == nullptr);
+
+            auto* t = reinterpret_cast<run_loop_opstate_base*>(
+                queue_.exchange(0, std::memory_order_acquire));
+            HPX_ASSERT((reinterpret_cast<std::uintptr_t>(t) & waiting_bit) ==
+                0);
 
-            if (head.tail == head.next)
+            // restore FIFO order
+            while (t != nullptr)
             {
-                head.tail = &head;
+                run_loop_opstate_base* next = t->next;
+                t->next = pending_;
+                pending_ = t;
+                t = next;
             }
-
-            // std::exchange(head.next, head.next->next);
-            auto const old_val = HPX_MOVE(head.next);
-            head.next = HPX_MOVE(head.next->next);
-            return old_val;
         }
 
+        HPX_CORE_EXPORT void wait_for_work();
+        HPX_CORE_EXPORT void notify_waiting(bool all) noexcept;
+
     public:
         // [exec.run_loop.ctor] construct/copy/destroy
-        run_loop() noexcept
-          // NOLINTNEXTLINE(bugprone-unhandled-exception-at-new)
-          : mtx(new detail::run_loop_data(), false)
-          , head(&head)    //-V546
-        {
-        }
+        run_loop() = default;
 
         run_loop(run_loop const&) = delete;
         run_loop(run_loop&&) = delete;
@@ -363,7 +369,17 @@ namespace hpx::execution::experimental {
         // Otherwise, has no effects.
         ~run_loop()
         {
-            if (head.next != &head || !stop)
+            // wait for threads that have made the last item available or that
+            // have called finish() to leave push_back() or finish()
+            hpx::util::yield_while(
+                [&]() {
+                    return active_.load(std::memory_order_acquire) != 0;
+                },
+                "run_loop::~run_loop");
+
+            if (pending_ != nullptr ||
+                queue_.load(std::memory_order_relaxed) != 0 ||
+                !stop_.load(std::memory_order_relaxed))
             {
                 std::terminate();
             }
@@ -378,21 +394,26 @@ namespace hpx::execution::experimental {
         void run()
         {
             // Precondition: state is starting.
-            //HPX_ASSERT(head.next != &head || !stop);
-            for (run_loop_opstate_base* t; (t = pop_front()) != &head; /**/)
+            for (run_loop_opstate_base* t; (t = pop_front()) != nullptr; /**/)
             {
                 t->execute();
             }
-            HPX_ASSERT(stop);    // Postcondition: state is finishing.
+
+            // Postcondition: state is finishing.
+            HPX_ASSERT(stop_.load(std::memory_order_relaxed));
         }
 
-        void finish()
+        void finish() noexcept
         {
-            auto const local_mtx = mtx;    // keep alive
-            std::unique_lock l(local_mtx->mtx_);
+            active_.fetch_add(1, std::memory_order_relaxed);
+
+            stop_.store(true, std::memory_order_seq_cst);
+            if (queue_.load(std::memory_order_seq_cst) & waiting_bit)
+            {
+                notify_waiting(true);
+            }
 
-            stop = true;
-            cond_var.notify_all(HPX_MOVE(l));
+            active_.fetch_sub(1, std::memory_order_release);
         }
     };
 
@@ -401,13 +422,8 @@ namespace hpx::execution::experimental {
     ///////////////////////////////////////////////////////////////////////////
     template <typename ReceiverId>
     inline void run_loop::run_loop_opstate<ReceiverId>::type::start() & noexcept
-    try
     {
         loop.push_back(this);
     }
-    catch (...)
-    {
-        set_error(HPX_MOVE(receiver), std::current_exception());
-    }
 }    // namespace hpx::execution::experimental
 #endif
@@ -25,7 +25,6 @@
 #include <hpx/modules/execution_base.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/memory.hpp>
-#include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/tag_invoke.hpp>
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/modules/type_support.hpp>
@@ -34,7 +33,6 @@
 #include <cstddef>
 #include <exception>
 #include <memory>
-#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -74,6 +72,25 @@ namespace hpx::execution::experimental {
             }
         };
 
+        // Operation states waiting for the predecessor of split or
+        // ensure_started to complete are linked into an intrusive lock-free
+        // stack. The nodes live in the operation states themselves, attaching
+        // a receiver does not allocate.
+        HPX_CXX_CORE_EXPORT struct split_continuation_base
+        {
+            using complete_function_type =
+                void (*)(split_continuation_base*) noexcept;
+
+            explicit constexpr split_continuation_base(
+                complete_function_type complete) noexcept
+              : complete(complete)
+            {
+            }
+
+            split_continuation_base* next = nullptr;
+            complete_function_type complete;
+        };
+
         HPX_CXX_CORE_EXPORT template <typename Sender, typename Allocator,
             submission_type Type, typename Scheduler = no_scheduler>
         struct split_sender
@@ -135,10 +152,13 @@ namespace hpx::execution::experimental {
                     Allocator>::template rebind_alloc<shared_state>;
                 HPX_NO_UNIQUE_ADDRESS allocator_type alloc;
 
-                hpx::spinlock mtx;
                 hpx::util::atomic_count reference_count{0};
                 std::atomic<bool> start_called{false};
-                std::atomic<bool> predecessor_done{false};
+
+                // Head of the stack of waiting operation states. Once the
+                // predecessor has completed, this holds the address of the
+                // shared state itself, which can't alias any operation state.
+                std::atomic<void*> waiting{nullptr};
 
                 using operation_state_type =
                     std::decay_t<connect_result_t<Sender, split_receiver>>;
@@ -158,9 +178,6 @@ namespace hpx::execution::experimental {
                     value_type>
                     v;
 
-                using continuation_type = hpx::move_only_function<void()>;
-                hpx::detail::small_vector<continuation_type, 1> continuations;
-
                 struct split_receiver
                 {
                     hpx::intrusive_ptr<shared_state> state;
@@ -285,113 +302,65 @@ namespace hpx::execution::experimental {
 
                 virtual void set_predecessor_done()
                 {
-                    predecessor_done = true;
-
+                    // Mark the predecessor as done and take ownership of all
+                    // operation states attached so far. The values or errors
+                    // have been stored before, the release part of the
+                    // exchange makes them visible to threads attaching
+                    // operation states later on.
+                    void* head = waiting.exchange(
+                        static_cast<void*>(this), std::memory_order_acq_rel);
+
+                    // The operation states have been pushed in reverse
+                    // order, complete them in the order of attachment.
+                    split_continuation_base* prev = nullptr;
+                    auto* current = static_cast<split_continuation_base*>(head);
+                    while (current != nullptr)
                     {
-                        // We require taking the lock here to synchronize with
-                        // threads attempting to add continuations to the vector
-                        // of continuations. However, it is enough to take it
-                        // once and release it immediately.
-                        //
-                        // Without the lock we may not see writes to the vector.
-                        // With the lock threads attempting to add continuations
-                        // will either:
-                        // - See predecessor_done = true in which case they will
-                        //   call the continuation directly without adding it to
-                        //   the vector of continuations. Accessing the vector
-                        //   below without the lock is safe in this case because
-                        //   the vector is not modified.
-                        // - See predecessor_done = false and proceed to take
-                        //   the lock. If they see predecessor_done after taking
-                        //   the lock they can again release the lock and call
-                        //   the continuation directly. Accessing the vector
-                        //   without the lock is again safe because the vector
-                        //   is not modified.
-                        // - See predecessor_done = false and proceed to take
-                        //   the lock. If they see predecessor_done is still
-                        //   false after taking the lock, they will proceed to
-                        //   add a continuation to the vector. Since they keep
-                        //   the lock they can safely write to the vector. This
-                        //   thread will not proceed past the lock until they
-                        //   have finished writing to the vector.
-                        //
-                        // Importantly, once this thread has taken and released
-                        // this lock, threads attempting to add continuations to
-                        // the vector must see predecessor_done = true after
-                        // taking the lock in their threads and will not add
-                        // continuations to the vector.
-                        std::unique_lock l{mtx};
+                        split_continuation_base* next = current->next;
+                        current->next = prev;
+                        prev = current;
+                        current = next;
                     }
 
-                    if (!continuations.empty())
+                    while (prev != nullptr)
                     {
-                        for (auto const& continuation : continuations)
-                        {
-                            continuation();
-                        }
-
-                        continuations.clear();
+                        // completing may destroy the operation state
+                        split_continuation_base* next = prev->next;
+                        prev->complete(prev);
+                        prev = next;
                     }
                 }
 
                 template <typename Receiver>
-                void add_continuation(Receiver& receiver) = delete;
+                void complete_continuation(Receiver&& receiver)
+                {
+                    // One of set_error/set_stopped/set_value has been called
+                    // and values/errors have been stored into the shared
+                    // state. We can trigger the continuation directly.
+                    // TODO: Should this preserve the scheduler? It does not
+                    // if we call set_* inline.
+                    hpx::visit(
+                        done_error_value_visitor<Receiver>{
+                            HPX_FORWARD(Receiver, receiver)},
+                        v);
+                }
 
-                template <typename Receiver>
-                void add_continuation(Receiver&& receiver)
+                void add_continuation(split_continuation_base* op) noexcept
                 {
-                    if (predecessor_done)
+                    void* head = waiting.load(std::memory_order_acquire);
+                    do
                     {
-                        // If we read predecessor_done here it means that one of
-                        // set_error/set_stopped/set_value has been called and
-                        // values/errors have been stored into the shared state.
-                        // We can trigger the continuation directly.
-                        // TODO: Should this preserve the scheduler? It does not
-                        // if we call set_* inline.
-                        hpx::visit(
-                            done_error_value_visitor<Receiver>{
-                                HPX_FORWARD(Receiver, receiver)},
-                            v);
-                    }
-                    else
-                    {
-                        // If predecessor_done is false, we have to take the
-                        // lock to potentially add the continuation to the
-                        // vector of continuations.
-                        std::unique_lock l{mtx};
-
-                        if (predecessor_done)
+                        if (head == static_cast<void*>(this))
                         {
-                            // By the time the lock has been taken,
-                            // predecessor_done might already be true and we can
-                            // release the lock early and call the continuation
-                            // directly again.
-                            l.unlock();
-                            hpx::visit(
-                                done_error_value_visitor<Receiver>{
-                                    HPX_FORWARD(Receiver, receiver)},
-                                v);
+                            // the predecessor is done already, complete the
+                            // operation state directly
+                            op->complete(op);
+                            return;
                         }
-                        else
-                        {
-                            // If predecessor_done is still false, we add the
-                            // continuation to the vector of continuations. This
-                            // has to be done while holding the lock, since
-                            // other threads may also try to add continuations
-                            // to the vector and the vector is not threadsafe in
-                            // itself. The continuation will be called later
-                            // when set_error/set_stopped/set_value is called.
-                            continuations.emplace_back(
-                                [this,
-                                    receiver = HPX_FORWARD(
-                                        Receiver, receiver)]() mutable {
-                                    hpx::visit(
-                                        done_error_value_visitor<Receiver>{
-                                            HPX_MOVE(receiver)},
-                                        v);
-                                });
-                        }
-                    }
+                        op->next = static_cast<split_continuation_base*>(head);
+                    } while (!waiting.compare_exchange_weak(head,
+                        static_cast<void*>(op), std::memory_order_release,
+                        std::memory_order_acquire));
                 }
 
                 void start() & noexcept
@@ -522,7 +491,7 @@ namespace hpx::execution::experimental {
             split_sender& operator=(split_sender&&) = default;
 
             template <typename Receiver>
-            struct operation_state
+            struct operation_state : split_continuation_base
             {
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
                 hpx::intrusive_ptr<shared_state> state;
@@ -530,11 +499,19 @@ namespace hpx::execution::experimental {
                 template <typename Receiver_>
                 operation_state(Receiver_&& receiver,
                     hpx::intrusive_ptr<shared_state> state)
-                  : receiver(HPX_FORWARD(Receiver_, receiver))
+                  : split_continuation_base(&operation_state::complete_impl)
+                  , receiver(HPX_FORWARD(Receiver_, receiver))
                   , state(HPX_MOVE(state))
                 {
                 }
 
+                static void complete_impl(
+                    split_continuation_base* base) noexcept
+                {
+                    auto& os = static_cast<operation_state&>(*base);
+                    os.state->complete_continuation(HPX_MOVE(os.receiver));
+                }
+
                 operation_state(operation_state&&) = delete;
                 operation_state& operator=(operation_state&&) = delete;
                 operation_state(operation_state const&) = delete;
@@ -550,7 +527,7 @@ namespace hpx::execution::experimental {
                         os.state->start();
                     }
 
-                    os.state->add_continuation(HPX_MOVE(os.receiver));
+                    os.state->add_continuation(&os);
                 }
             };
 
@@ -0,0 +1,338 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX20_COROUTINES)
+
+#include <hpx/assert.hpp>
+#include <hpx/modules/allocator_support.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/type_support.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::experimental {
+
+    HPX_CXX_CORE_EXPORT template <typename T = void>
+    class task;
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Awaiter used by task<T> for hpx::future<T> and hpx::shared_future<T>.
+        //
+        // The coroutine is resumed directly from the completion handler of
+        // the future's shared state, i.e. on the worker thread that makes the
+        // future ready. The shared state falls back to running the handler
+        // on a new HPX thread if there is not sufficient stack space left on
+        // the completing thread. If the future becomes ready while the
+        // handler is being attached, the coroutine continues without being
+        // suspended.
+        HPX_CXX_CORE_EXPORT template <typename Future>
+        struct future_awaiter
+        {
+            // The awaited future is a temporary of the co_await expression or
+            // an lvalue, both outlive the suspension of the coroutine.
+            Future& future_;
+            std::atomic<bool> resumed_{false};
+
+            [[nodiscard]] bool await_ready() const noexcept
+            {
+                return future_.is_ready();
+            }
+
+            bool await_suspend(hpx::coroutine_handle<> h)
+            {
+                auto const& state = traits::detail::get_shared_state(future_);
+                HPX_ASSERT(state);
+
+                // whoever comes second resumes the coroutine
+                state->set_on_completed([this, h]() {
+                    if (resumed_.exchange(true, std::memory_order_acq_rel))
+                    {
+                        h.resume();
+                    }
+                });
+                return !resumed_.exchange(true, std::memory_order_acq_rel);
+            }
+
+            decltype(auto) await_resume()
+            {
+                return future_.get();
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        HPX_CXX_CORE_EXPORT template <typename T>
+        struct task_promise_result
+        {
+            template <typename U>
+            void return_value(U&& value)
+            {
+                result_.template emplace<1>(HPX_FORWARD(U, value));
+            }
+
+            T get_result()
+            {
+                if (result_.index() == 2)
+                {
+                    std::rethrow_exception(hpx::get<2>(HPX_MOVE(result_)));
+                }
+                HPX_ASSERT(result_.index() == 1);
+                return hpx::get<1>(HPX_MOVE(result_));
+            }
+
+            hpx::variant<hpx::monostate, T, std::exception_ptr> result_;
+        };
+
+        template <>
+        struct task_promise_result<void>
+        {
+            void return_void() noexcept
+            {
+                result_.template emplace<1>();
+            }
+
+            void get_result()
+            {
+                if (result_.index() == 2)
+                {
+                    std::rethrow_exception(hpx::get<2>(HPX_MOVE(result_)));
+                }
+                HPX_ASSERT(result_.index() == 1);
+            }
+
+            hpx::variant<hpx::monostate, hpx::monostate, std::exception_ptr>
+                result_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        HPX_CXX_CORE_EXPORT template <typename T>
+        hpx::future<T> task_to_future(task<T> t)
+        {
+            co_return co_await HPX_MOVE(t);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief A lazily started coroutine producing a value of type \a T.
+    ///
+    /// A task<T> does not start executing before it is awaited. Awaiting a
+    /// task from another coroutine transfers control to the task directly
+    /// (symmetric transfer), and once the task finishes, control is
+    /// transferred back to the awaiting coroutine in the same way. Chains of
+    /// awaited tasks therefore run without going through the scheduler and
+    /// without growing the stack.
+    ///
+    /// Inside a task, co_await may be applied to other tasks, to
+    /// hpx::future<T> and hpx::shared_future<T> (the task is resumed inline
+    /// on the thread that makes the future ready), and to senders with a
+    /// single value completion (the task is resumed inline by the
+    /// completing receiver, co_await schedule(sched) moves the task onto
+    /// the given scheduler).
+    ///
+    /// Use get_future() to start a task from code that is not a coroutine.
+    HPX_CXX_CORE_EXPORT template <typename T>
+    class task
+    {
+    public:
+        struct promise_type;
+
+    private:
+        using handle_type = hpx::coroutine_handle<promise_type>;
+
+        struct final_awaiter
+        {
+            static constexpr bool await_ready() noexcept
+            {
+                return false;
+            }
+
+            static hpx::coroutine_handle<> await_suspend(
+                handle_type h) noexcept
+            {
+#if defined(HPX_HAVE_STDEXEC)
+                return h.promise().continuation().handle();
+#else
+                return h.promise().continuation();
+#endif
+            }
+
+            static constexpr void await_resume() noexcept {}
+        };
+
+        using allocator_type = hpx::util::internal_allocator<char>;
+
+    public:
+        struct promise_type
+          : detail::task_promise_result<T>
+          , hpx::execution::experimental::with_awaitable_senders<promise_type>
+        {
+            task get_return_object() noexcept
+            {
+                return task(handle_type::from_promise(*this));
+            }
+
+            static constexpr hpx::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            static constexpr final_awaiter final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void unhandled_exception() noexcept
+            {
+                this->result_.template emplace<2>(std::current_exception());
+            }
+
+            // futures are resumed directly from their completion handler,
+            // everything else is forwarded to as_awaitable (which handles
+            // tasks, other awaitables, and senders)
+            template <typename Awaitable>
+            decltype(auto) await_transform(Awaitable&& awaitable)
+            {
+                using awaitable_type = std::remove_reference_t<Awaitable>;
+                if constexpr (hpx::traits::is_future_v<awaitable_type>)
+                {
+                    return detail::future_awaiter<awaitable_type>{awaitable};
+                }
+                else
+                {
+                    return hpx::execution::experimental::as_awaitable(
+                        HPX_FORWARD(Awaitable, awaitable), *this);
+                }
+            }
+
+            [[nodiscard]] static void* operator new(std::size_t size)
+            {
+                using traits = std::allocator_traits<allocator_type>;
+
+                allocator_type alloc{};
+                return traits::allocate(alloc, size);
+            }
+
+            static void operator delete(void* p, std::size_t size) noexcept
+            {
+                using traits = std::allocator_traits<allocator_type>;
+
+                allocator_type alloc{};
+                traits::deallocate(alloc, static_cast<char*>(p), size);
+            }
+        };
+
+        task() = default;
+
+        task(task&& rhs) noexcept
+          : coro_(std::exchange(rhs.coro_, {}))
+        {
+        }
+
+        task& operator=(task&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                if (coro_)
+                {
+                    coro_.destroy();
+                }
+                coro_ = std::exchange(rhs.coro_, {});
+            }
+            return *this;
+        }
+
+        task(task const&) = delete;
+        task& operator=(task const&) = delete;
+
+        ~task()
+        {
+            if (coro_)
+            {
+                coro_.destroy();
+            }
+        }
+
+        [[nodiscard]] bool valid() const noexcept
+        {
+            return static_cast<bool>(coro_);
+        }
+
+        /// Start executing the task on the calling thread and return a future
+        /// that becomes ready once the task has finished.
+        hpx::future<T> get_future() &&
+        {
+            HPX_ASSERT(valid());
+            return detail::task_to_future(HPX_MOVE(*this));
+        }
+
+    private:
+        explicit task(handle_type coro) noexcept
+          : coro_(coro)
+        {
+        }
+
+        struct task_awaiter
+        {
+            handle_type coro_;
+
+            explicit task_awaiter(handle_type coro) noexcept
+              : coro_(coro)
+            {
+            }
+
+            task_awaiter(task_awaiter const&) = delete;
+            task_awaiter& operator=(task_awaiter const&) = delete;
+
+            ~task_awaiter()
+            {
+                if (coro_)
+                {
+                    coro_.destroy();
+                }
+            }
+
+            static constexpr bool await_ready() noexcept
+            {
+                return false;
+            }
+
+            // start the awaited task by transferring control to it directly
+            template <typename ParentPromise>
+            hpx::coroutine_handle<> await_suspend(
+                hpx::coroutine_handle<ParentPromise> parent) noexcept
+            {
+                coro_.promise().set_continuation(parent);
+                return coro_;
+            }
+
+            T await_resume()
+            {
+                return coro_.promise().get_result();
+            }
+        };
+
+        friend task_awaiter operator co_await(task&& t) noexcept
+        {
+            HPX_ASSERT(t.valid());
+            return task_awaiter(std::exchange(t.coro_, {}));
+        }
+
+        handle_type coro_;
+    };
+}    // namespace hpx::experimental
+
+#endif    // HPX_HAVE_CXX20_COROUTINES
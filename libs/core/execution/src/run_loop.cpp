@@ -7,27 +7,54 @@
 #include <hpx/execution/algorithms/run_loop.hpp>
 
 #include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
 
 #if !defined(HPX_HAVE_STDEXEC)
 ///////////////////////////////////////////////////////////////////////////////
-namespace hpx::execution::experimental::detail {
+namespace hpx::execution::experimental {
 
-    void intrusive_ptr_add_ref(run_loop_data* p) noexcept
+    void run_loop::wait_for_work()
     {
-        p->count_.increment();
+        std::unique_lock l(mtx_);
+
+        // announce that we're about to wait, this fails if new items were
+        // pushed in the meantime
+        std::uintptr_t expected = 0;
+        if (!queue_.compare_exchange_strong(
+                expected, waiting_bit, std::memory_order_seq_cst))
+        {
+            return;
+        }
+
+        // Producers clear the waiting bit when pushing the next item.
+        // finish() sets stop_ before checking for the waiting bit. In both
+        // cases the notifying thread has to acquire the mutex first, which
+        // we hold until we're waiting on the condition variable.
+        while (queue_.load(std::memory_order_seq_cst) == waiting_bit &&
+            !stop_.load(std::memory_order_seq_cst))
+        {
+            cond_var_.wait(l);
+        }
+
+        // reset the waiting bit if we were woken up by finish()
+        expected = waiting_bit;
+        queue_.compare_exchange_strong(
+            expected, 0, std::memory_order_relaxed);
     }
 
-    void intrusive_ptr_release(run_loop_data* p) noexcept
+    void run_loop::notify_waiting(bool all) noexcept
     {
-        if (0 == p->count_.decrement())
+        std::unique_lock l(mtx_);
+        if (all)
         {
-            // The thread that decrements the reference count to zero must
-            // perform an acquire to ensure that it doesn't start destructing
-            // the object until all previous writes have drained.
-            std::atomic_thread_fence(std::memory_order_acquire);
-
-            delete p;
+            cond_var_.notify_all(HPX_MOVE(l));
+        }
+        else
+        {
+            cond_var_.notify_one(HPX_MOVE(l));
         }
     }
-}    // namespace hpx::execution::experimental::detail
+}    // namespace hpx::execution::experimental
 #endif
@@ -0,0 +1,185 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_HAVE_CXX20_COROUTINES)
+#error "This test requires compiler support for C++20 coroutines"
+#endif
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::experimental::task<int> fib(int n)
+{
+    if (n < 2)
+    {
+        co_return n;
+    }
+    int const n1 = co_await fib(n - 1);
+    int const n2 = co_await fib(n - 2);
+    co_return n1 + n2;
+}
+
+hpx::experimental::task<int> chain(int n)
+{
+    if (n == 0)
+    {
+        co_return 0;
+    }
+    co_return 1 + co_await chain(n - 1);
+}
+
+hpx::experimental::task<void> set_value(int& value)
+{
+    value = 42;
+    co_return;
+}
+
+hpx::experimental::task<std::string> make_string()
+{
+    co_return std::string("task");
+}
+
+void test_task_await()
+{
+    HPX_TEST_EQ(fib(20).get_future().get(), 6765);
+    HPX_TEST_EQ(chain(200).get_future().get(), 200);
+    HPX_TEST_EQ(make_string().get_future().get(), std::string("task"));
+
+    int value = 0;
+    set_value(value).get_future().get();
+    HPX_TEST_EQ(value, 42);
+
+    // tasks are started lazily
+    int lazy_value = 0;
+    auto t = set_value(lazy_value);
+    HPX_TEST(t.valid());
+    HPX_TEST_EQ(lazy_value, 0);
+    std::move(t).get_future().get();
+    HPX_TEST_EQ(lazy_value, 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int just_wait(int result)
+{
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    return result;
+}
+
+hpx::experimental::task<int> await_futures()
+{
+    int const r1 = co_await hpx::make_ready_future(1);
+    int const r2 = co_await hpx::async(just_wait, 2);
+
+    hpx::shared_future<int> sf = hpx::async(just_wait, 3);
+    int const r3 = co_await sf;
+    int const r4 = co_await sf;
+
+    co_return r1 + r2 + r3 + r4;
+}
+
+hpx::experimental::task<int> await_senders()
+{
+    ex::thread_pool_scheduler sched{};
+
+    co_await ex::schedule(sched);
+    HPX_TEST(hpx::threads::get_self_ptr() != nullptr);
+
+    co_return co_await (
+        ex::just(20) | ex::then([](int i) { return i + 22; }));
+}
+
+void test_task_await_async()
+{
+    HPX_TEST_EQ(await_futures().get_future().get(), 9);
+    HPX_TEST_EQ(await_senders().get_future().get(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::experimental::task<int> throw_exception()
+{
+    throw std::runtime_error("error");
+    co_return 0;
+}
+
+hpx::experimental::task<int> catch_exception()
+{
+    try
+    {
+        co_await throw_exception();
+    }
+    catch (std::runtime_error const&)
+    {
+        co_return 1;
+    }
+    co_return 0;
+}
+
+hpx::experimental::task<int> await_exceptional_future()
+{
+    co_return co_await hpx::async([]() -> int {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+        throw std::runtime_error("error");
+    });
+}
+
+void test_task_exceptions()
+{
+    HPX_TEST_EQ(catch_exception().get_future().get(), 1);
+
+    bool caught_exception = false;
+    try
+    {
+        throw_exception().get_future().get();
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    caught_exception = false;
+    try
+    {
+        await_exceptional_future().get_future().get();
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_task_await();
+    test_task_await_async();
+    test_task_exceptions();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
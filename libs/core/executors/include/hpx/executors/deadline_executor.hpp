@@ -0,0 +1,356 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file deadline_executor.hpp
+/// \page hpx::execution::experimental::deadline_executor
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/modules/async_base.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/tag_invoke.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Attach an absolute deadline to an executor. All tasks scheduled through
+    /// the returned executor are expected to have finished before the given
+    /// point in time.
+    HPX_CXX_CORE_EXPORT inline constexpr struct with_deadline_t final
+      : detail::property_base<with_deadline_t>
+    {
+    } with_deadline{};
+
+    template <>
+    struct is_scheduling_property<with_deadline_t> : std::true_type
+    {
+    };
+
+    HPX_CXX_CORE_EXPORT inline constexpr struct get_deadline_t final
+      : hpx::functional::detail::tag_fallback<get_deadline_t>
+    {
+    private:
+        // executors that do not support deadlines don't impose any
+        template <typename Target>
+        friend HPX_FORCEINLINE constexpr hpx::chrono::steady_clock::time_point
+        tag_fallback_invoke(get_deadline_t, Target&&) noexcept
+        {
+            return (hpx::chrono::steady_clock::time_point::max)();
+        }
+    } get_deadline{};
+
+    template <>
+    struct is_scheduling_property<get_deadline_t> : std::true_type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Statistics collected by a deadline_executor (and all of its copies).
+    HPX_CXX_CORE_EXPORT struct deadline_executor_statistics
+    {
+        // number of tasks that have been run
+        std::uint64_t executed = 0;
+
+        // number of tasks that have finished after their deadline
+        std::uint64_t missed = 0;
+
+        // number of tasks that were run by a worker thread other than the one
+        // that has scheduled them
+        std::uint64_t stolen = 0;
+    };
+
+    /// Return the number of tasks with a deadline that have been run by any
+    /// deadline_executor in this process.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::int64_t get_deadline_tasks_count(
+        bool reset);
+
+    /// Return the number of tasks run by any deadline_executor in this process
+    /// that have finished after their deadline.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::int64_t get_deadline_misses_count(
+        bool reset);
+
+    /// Return the number of tasks run by any deadline_executor in this process
+    /// that have been stolen from the queue of another worker thread.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::int64_t get_deadline_steals_count(
+        bool reset);
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // One queue per worker thread, each of which is a binary heap ordered
+        // by the deadline of the tasks (ties are resolved in FIFO order).
+        // Tasks are pushed to the queue of the worker thread that schedules
+        // them. A worker picks the task with the earliest deadline out of all
+        // queues, preferring its own queue for tasks with equal deadlines.
+        class HPX_CORE_EXPORT deadline_queues
+        {
+        public:
+            using time_point = hpx::chrono::steady_clock::time_point;
+            using task_type = hpx::move_only_function<void()>;
+
+            // a num_queues of zero creates one queue per worker thread of the
+            // current (or default) thread pool
+            explicit deadline_queues(std::size_t num_queues);
+
+            deadline_queues(deadline_queues const&) = delete;
+            deadline_queues(deadline_queues&&) = delete;
+            deadline_queues& operator=(deadline_queues const&) = delete;
+            deadline_queues& operator=(deadline_queues&&) = delete;
+
+            ~deadline_queues();
+
+            void push(time_point deadline, task_type&& f);
+
+            // run exactly one of the queued tasks, there must be at least one
+            // task that has been pushed and not run yet
+            void run_next();
+
+            [[nodiscard]] std::size_t num_queues() const noexcept
+            {
+                return queues_.size();
+            }
+
+            [[nodiscard]] deadline_executor_statistics statistics()
+                const noexcept;
+
+        private:
+            struct item
+            {
+                time_point deadline;
+                std::uint64_t sequence;
+                task_type f;
+            };
+
+            struct queue
+            {
+                hpx::spinlock mtx;
+                std::vector<item> heap;
+
+                // deadline of the first item in the heap (time_point::max()
+                // if empty), used to select a queue without locking all
+                std::atomic<time_point::rep> earliest;
+
+                queue() noexcept
+                  : earliest((time_point::max)().time_since_epoch().count())
+                {
+                }
+            };
+
+            [[nodiscard]] std::size_t current_queue() noexcept;
+            bool try_pop(std::size_t q, item& result);
+            bool try_pop_earliest(std::size_t local, item& result,
+                std::size_t& source);
+
+            std::vector<hpx::util::cache_aligned_data<queue>> queues_;
+            std::atomic<std::uint64_t> sequence_;
+            std::atomic<std::size_t> next_queue_;
+
+            std::atomic<std::uint64_t> executed_;
+            std::atomic<std::uint64_t> missed_;
+            std::atomic<std::uint64_t> stolen_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A deadline_executor orders the tasks scheduled through it by earliest
+    /// deadline first (EDF) before they are run on the wrapped executor.
+    ///
+    /// The deadline of the tasks is set using the with_deadline property:
+    ///
+    /// \code
+    ///     deadline_executor<> exec;
+    ///     auto f = hpx::async(
+    ///         with_deadline(exec, steady_clock::now() + 5ms), handle_request);
+    /// \endcode
+    ///
+    /// Tasks without a deadline are run after all tasks with a deadline that
+    /// have been scheduled so far. Every task that is scheduled posts a small
+    /// runner to the wrapped executor which picks the queued task with the
+    /// earliest deadline once it gets to run. This way the order in which
+    /// tasks are run adapts to their deadlines regardless of the scheduling
+    /// policy of the underlying thread pool. Tasks that finish after their
+    /// deadline are counted as misses, see statistics() and the performance
+    /// counters /threads/count/deadline-tasks and
+    /// /threads/count/deadline-misses.
+    ///
+    /// All copies of a deadline_executor share the same queues.
+    HPX_CXX_CORE_EXPORT template <
+        typename BaseExecutor = hpx::execution::parallel_executor>
+    class deadline_executor
+    {
+    public:
+        using execution_category = hpx::execution::parallel_execution_tag;
+        using executor_parameters_type =
+            typename BaseExecutor::executor_parameters_type;
+        using time_point = hpx::chrono::steady_clock::time_point;
+
+        deadline_executor()
+          : deadline_executor(BaseExecutor{})
+        {
+        }
+
+        explicit deadline_executor(
+            BaseExecutor const& exec, std::size_t num_queues = 0)
+          : exec_(exec)
+          , queues_(std::make_shared<detail::deadline_queues>(num_queues))
+          , deadline_((time_point::max)())
+        {
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(deadline_executor const& rhs) const noexcept
+        {
+            return exec_ == rhs.exec_ && queues_ == rhs.queues_ &&
+                deadline_ == rhs.deadline_;
+        }
+
+        bool operator!=(deadline_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        constexpr deadline_executor const& context() const noexcept
+        {
+            return *this;
+        }
+        /// \endcond
+
+        [[nodiscard]] deadline_executor_statistics statistics() const noexcept
+        {
+            return queues_->statistics();
+        }
+
+        [[nodiscard]] std::size_t num_queues() const noexcept
+        {
+            return queues_->num_queues();
+        }
+
+    private:
+        // --------------------------------------------------------------------
+        // deadline property
+        friend deadline_executor tag_invoke(
+            hpx::execution::experimental::with_deadline_t,
+            deadline_executor const& exec,
+            hpx::chrono::steady_time_point const& deadline)
+        {
+            auto exec_with_deadline = exec;
+            exec_with_deadline.deadline_ = deadline.value();
+            return exec_with_deadline;
+        }
+
+        friend constexpr time_point tag_invoke(
+            hpx::execution::experimental::get_deadline_t,
+            deadline_executor const& exec) noexcept
+        {
+            return exec.deadline_;
+        }
+
+        // --------------------------------------------------------------------
+        // OneWayExecutor interface
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::sync_execute_t,
+            deadline_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return exec
+                .async_execute_impl(HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...)
+                .get();
+        }
+
+        // --------------------------------------------------------------------
+        // TwoWayExecutor interface
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::async_execute_t,
+            deadline_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return exec.async_execute_impl(
+                HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // --------------------------------------------------------------------
+        // NonBlockingOneWayExecutor (adapted) interface
+        template <typename F, typename... Ts>
+        friend void tag_invoke(hpx::parallel::execution::post_t,
+            deadline_executor const& exec, F&& f, Ts&&... ts)
+        {
+            exec.schedule(hpx::util::deferred_call(
+                HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...));
+        }
+
+        template <typename F, typename... Ts>
+        hpx::future<hpx::util::detail::invoke_deferred_result_t<F, Ts...>>
+        async_execute_impl(F&& f, Ts&&... ts) const
+        {
+            using result_type =
+                hpx::util::detail::invoke_deferred_result_t<F, Ts...>;
+
+            hpx::packaged_task<result_type()> task(hpx::util::deferred_call(
+                HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...));
+            hpx::future<result_type> result = task.get_future();
+
+            schedule(HPX_MOVE(task));
+            return result;
+        }
+
+        template <typename F>
+        void schedule(F&& f) const
+        {
+            queues_->push(deadline_, HPX_FORWARD(F, f));
+
+            // every queued task is matched by exactly one runner
+            hpx::parallel::execution::post(
+                exec_, [queues = queues_]() { queues->run_next(); });
+        }
+
+        BaseExecutor exec_;
+        std::shared_ptr<detail::deadline_queues> queues_;
+        time_point deadline_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_CXX_CORE_EXPORT template <typename BaseExecutor>
+    struct is_one_way_executor<
+        hpx::execution::experimental::deadline_executor<BaseExecutor>>
+      : std::true_type
+    {
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename BaseExecutor>
+    struct is_never_blocking_one_way_executor<
+        hpx::execution::experimental::deadline_executor<BaseExecutor>>
+      : std::true_type
+    {
+    };
+
+    HPX_CXX_CORE_EXPORT template <typename BaseExecutor>
+    struct is_two_way_executor<
+        hpx::execution::experimental::deadline_executor<BaseExecutor>>
+      : std::true_type
+    {
+    };
+}    // namespace hpx::execution::experimental
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/executors/detail/bulk_invoke_helper.hpp>
+#include <hpx/executors/detail/index_queue_stealing.hpp>
 #include <hpx/modules/async_base.hpp>
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/coroutines.hpp>
@@ -68,67 +69,48 @@ namespace hpx::parallel::execution::detail {
 
             hpx::optional<std::uint32_t> index;
 
-            // Handle local queue first
+            // Handle local queue first. Whenever it runs dry, steal half of
+            // the chunks left in one of the neighboring queues (from their
+            // opposite end) and continue with those.
+            constexpr auto opposite_end =
+                hpx::concurrency::detail::opposite_end_v<Which>;
+
             auto& local_queue = state->queues[worker_thread].data_;
-            while ((index = local_queue.template pop<Which>()))
+            // chunks refilled from another queue are traced as stolen
+            for (bool stolen = false; /**/; stolen = true)
             {
+                while ((index = local_queue.template pop<Which>()))
+                {
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-                static hpx::util::itt::event notify_event("do_work_chunk");
-                hpx::util::itt::mark_event e(notify_event);
+                    static hpx::util::itt::event notify_event("do_work_chunk");
+                    static hpx::util::itt::event notify_event_stealing(
+                        "do_work_chunk (stealing)");
+                    hpx::util::itt::mark_event e(
+                        stolen ? notify_event_stealing : notify_event);
 #endif
-                hpx::tracing::mark_event evt("do_work_chunk");
-
-                auto const i_begin = *index * chunk_size;
-                auto const i_end = (std::min) (i_begin + chunk_size,
-                    static_cast<std::uint32_t>(size));
-
-                auto it = std::next(hpx::util::begin(state->shape), i_begin);
-                for (std::uint32_t i = i_begin; i != i_end; (void) ++it, ++i)
-                {
-                    hpx::execution::experimental::detail::bulk_invoke_helper(
-                        index_pack_type{}, f, *it, ts);
+                    hpx::tracing::mark_event evt(stolen ?
+                            "do_work_chunk (stealing)" :
+                            "do_work_chunk");
+
+                    auto const i_begin = *index * chunk_size;
+                    auto const i_end = (std::min) (i_begin + chunk_size,
+                        static_cast<std::uint32_t>(size));
+
+                    auto it =
+                        std::next(hpx::util::begin(state->shape), i_begin);
+                    for (std::uint32_t i = i_begin; i != i_end;
+                        (void) ++it, ++i)
+                    {
+                        hpx::execution::experimental::detail::
+                            bulk_invoke_helper(index_pack_type{}, f, *it, ts);
+                    }
                 }
-            }
 
-            if (allow_stealing)
-            {
-                // Then steal from the opposite end of the neighboring queues
-                constexpr auto opposite_end =
-                    hpx::concurrency::detail::opposite_end_v<Which>;
-
-                auto const num_threads = state->num_threads;
-                for (std::uint32_t offset = 1; offset != num_threads; ++offset)
+                if (!allow_stealing ||
+                    !steal_index_range<opposite_end>(
+                        state->queues, worker_thread, state->num_threads))
                 {
-                    std::size_t neighbor_thread = worker_thread + offset;
-                    if (neighbor_thread >= num_threads)
-                        neighbor_thread -= num_threads;
-
-                    auto& neighbor_queue = state->queues[neighbor_thread].data_;
-                    while (
-                        (index = neighbor_queue.template pop<opposite_end>()))
-                    {
-#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-                        static hpx::util::itt::event notify_event(
-                            "do_work_chunk (stealing)");
-                        hpx::util::itt::mark_event e(notify_event);
-#endif
-                        hpx::tracing::mark_event evt(
-                            "do_work_chunk (stealing)");
-
-                        auto const i_begin = *index * chunk_size;
-                        auto const i_end = (std::min) (i_begin + chunk_size,
-                            static_cast<std::uint32_t>(size));
-
-                        auto it =
-                            std::next(hpx::util::begin(state->shape), i_begin);
-                        for (std::uint32_t i = i_begin; i != i_end;
-                            (void) ++it, ++i)
-                        {
-                            hpx::execution::experimental::detail::
-                                bulk_invoke_helper(
-                                    index_pack_type{}, f, *it, ts);
-                        }
-                    }
+                    break;
                 }
             }
         }
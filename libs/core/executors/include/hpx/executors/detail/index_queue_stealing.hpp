@@ -0,0 +1,52 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/datastructures.hpp>
+
+#include <cstddef>
+
+namespace hpx::parallel::execution::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Lazy binary splitting of the index queues used by the bulk algorithms.
+    //
+    // Once a worker has drained its own queue it steals half of the chunks
+    // left in the queue of one of the other workers (taken from the given end
+    // of that queue) and moves them into its own queue. The stolen chunks are
+    // then processed from the local queue, where they can be stolen again by
+    // other idle workers. This way long runs of expensive iterations are
+    // split recursively between all idle workers instead of being handed out
+    // one chunk at a time.
+    //
+    // Returns false if all other queues were found empty, in which case there
+    // is no work left that has not been claimed by some worker.
+    HPX_CXX_CORE_EXPORT template <hpx::concurrency::detail::queue_end Which,
+        typename Queues>
+    bool steal_index_range(Queues& queues, std::size_t const worker_thread,
+        std::size_t const num_threads) noexcept
+    {
+        auto& local_queue = queues[worker_thread].data_;
+        for (std::size_t offset = 1; offset < num_threads; ++offset)
+        {
+            std::size_t neighbor_thread = worker_thread + offset;
+            if (neighbor_thread >= num_threads)
+                neighbor_thread -= num_threads;
+
+            auto& neighbor_queue = queues[neighbor_thread].data_;
+            if (auto stolen = neighbor_queue.template steal_half<Which>())
+            {
+                local_queue.refill(hpx::get<0>(*stolen), hpx::get<1>(*stolen),
+                    hpx::get<2>(*stolen));
+                return true;
+            }
+        }
+        return false;
+    }
+}    // namespace hpx::parallel::execution::detail
@@ -15,6 +15,7 @@
 #include <hpx/modules/async_base.hpp>
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/coroutines.hpp>
+#include <hpx/modules/datastructures.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/execution.hpp>
 #include <hpx/modules/execution_base.hpp>
@@ -59,7 +60,16 @@ namespace hpx::execution::experimental {
     /// which it will yield to other work.  Since starting and resuming the
     /// worker threads is a slow operation the executor should be reused
     /// whenever possible for multiple adjacent parallel algorithms or
-    /// invocations of bulk_(a)sync_execute.
+    /// invocations of bulk_(a)sync_execute. With idle_mode::passive the worker
+    /// threads suspend after the delay instead of yielding, they don't use any
+    /// resources until the next parallel region starts.
+    ///
+    /// Parallel regions may be nested: calling bulk_sync_execute from a
+    /// thread that currently executes a parallel region of the same executor
+    /// runs the nested region on the calling thread and on all worker threads
+    /// of the executor that have already finished their part of the enclosing
+    /// region. If there are no idle worker threads the nested region is
+    /// executed by the calling thread alone.
     HPX_CXX_CORE_EXPORT class fork_join_executor
     {
     public:
@@ -73,6 +83,17 @@ namespace hpx::execution::experimental {
             dynamic,
         };
 
+        /// Type of waiting used by the worker threads while no parallel region
+        /// is active. idle_mode::spin keeps the worker threads spinning and
+        /// yields to other work after the yield delay; idle_mode::passive
+        /// suspends the worker threads after the yield delay until the next
+        /// parallel region starts.
+        enum class idle_mode : std::uint8_t
+        {
+            spin,
+            passive,
+        };
+
         /// \cond NOINTERNAL
         using execution_category = hpx::execution::parallel_execution_tag;
         using executor_parameters_type =
@@ -93,6 +114,7 @@ namespace hpx::execution::experimental {
                 active = 3,
                 stopping = 4,
                 stopped = 5,
+                reserved = 6,    // claimed for a nested parallel region
             };
 
             using queue_type =
@@ -105,6 +127,16 @@ namespace hpx::execution::experimental {
                 std::size_t, std::size_t, queues_type&, hpx::spinlock&,
                 std::exception_ptr&) noexcept;
 
+            // The members of the team executing a nested parallel region.
+            struct nested_team
+            {
+                region_data_type& region_data_;
+                queues_type& queues_;
+                hpx::spinlock& exception_mutex_;
+                std::exception_ptr& exception_;
+                std::size_t num_threads_;
+            };
+
             // Members that change for each parallel region.
             struct region_data
             {
@@ -121,6 +153,22 @@ namespace hpx::execution::experimental {
                 void* argument_pack_;
                 void* results_;
                 hpx::latch* sync_with_main_thread_;
+
+                // The HPX thread associated with this entry, used to detect
+                // nested parallel regions. It is read by other team members
+                // while being set, hence atomic. Relaxed accesses suffice as
+                // a thread only needs to find the id it has stored itself.
+                std::atomic<void*> thread_id_{nullptr};
+
+                // The team and the index of this thread in that team if it has
+                // been borrowed for a nested parallel region.
+                nested_team const* nested_team_ = nullptr;
+                std::size_t nested_index_ = 0;
+
+                // Used to wake up a suspended worker thread (idle_mode::passive
+                // only).
+                std::atomic<bool> sleeping_{false};
+                hpx::binary_semaphore wakeup_{0};
             };
 
             // Can't apply 'using' here as the type needs to be forward
@@ -141,6 +189,7 @@ namespace hpx::execution::experimental {
             threads::thread_stacksize stacksize_ =
                 threads::thread_stacksize::small_;
             loop_schedule schedule_ = loop_schedule::static_;
+            idle_mode idle_mode_ = idle_mode::spin;
             std::uint64_t yield_delay_;
 
             std::size_t main_thread_;
@@ -161,10 +210,44 @@ namespace hpx::execution::experimental {
             // executor properties
             char const* annotation_ = nullptr;
 
+            // Suspend the calling worker thread as long as op(state of data,
+            // state) holds. Whoever changes the state has to call
+            // notify_state_change afterwards.
+            template <typename Op>
+            static void suspend_this_thread_while(
+                region_data& data, thread_state state, Op&& op)
+            {
+                data.sleeping_.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (op(data.state_.load(std::memory_order_relaxed), state))
+                {
+                    data.wakeup_.acquire();
+                }
+                else if (!data.sleeping_.exchange(
+                             false, std::memory_order_relaxed))
+                {
+                    // the state has changed concurrently and we are about to
+                    // be woken up, consume the notification
+                    data.wakeup_.acquire();
+                }
+            }
+
+            static void notify_state_change(region_data& data)
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (data.sleeping_.load(std::memory_order_relaxed) &&
+                    data.sleeping_.exchange(false, std::memory_order_relaxed))
+                {
+                    data.wakeup_.release();
+                }
+            }
+
             template <typename Op>
             static thread_state wait_state_this_thread_while(
                 std::atomic<thread_state> const& tstate, thread_state state,
-                std::uint64_t const yield_delay, Op&& op, bool allow_yielding)
+                std::uint64_t const yield_delay, Op&& op, bool allow_yielding,
+                region_data* suspend_data = nullptr)
             {
                 auto const context = hpx::execution_base::this_thread::agent();
 
@@ -199,8 +282,17 @@ namespace hpx::execution::experimental {
                                 util::hardware::timestamp();
                             if ((base_time2 - base_time) > yield_delay)
                             {
-                                base_time = base_time2;
-                                context.yield();
+                                if (suspend_data != nullptr)
+                                {
+                                    suspend_this_thread_while(
+                                        *suspend_data, state, op);
+                                    base_time = util::hardware::timestamp();
+                                }
+                                else
+                                {
+                                    base_time = base_time2;
+                                    context.yield();
+                                }
                             }
                         }
 
@@ -248,6 +340,7 @@ namespace hpx::execution::experimental {
                 // The threads are bound to the current core.
                 bool const priority_bound_;
                 bool const allow_yielding_;
+                bool const suspend_when_idle_;
 
                 static void set_state_this_thread(
                     region_data& data, thread_state const state) noexcept
@@ -261,18 +354,29 @@ namespace hpx::execution::experimental {
                     return data.state_.load(std::memory_order_relaxed);
                 }
 
+                // wait as long the state is 'idle' or 'reserved'
+                thread_state wait_for_work(region_data& data) const
+                {
+                    return shared_data::wait_state_this_thread_while(
+                        data.state_, thread_state::idle, yield_delay_,
+                        [](thread_state current, thread_state state) {
+                            return current == state ||
+                                current == thread_state::reserved;
+                        },
+                        allow_yielding_, suspend_when_idle_ ? &data : nullptr);
+                }
+
                 void operator()() const noexcept
                 {
                     region_data& data = region_data_[thread_index_].data_;
 
                     HPX_ASSERT(
                         get_state_this_thread(data) == thread_state::starting);
+                    data.thread_id_.store(threads::get_self_id().get(),
+                        std::memory_order_relaxed);
                     set_state_this_thread(data, thread_state::idle);
 
-                    // wait as long the state is 'idle'
-                    auto state = shared_data::wait_state_this_thread_while(
-                        data.state_, thread_state::idle, yield_delay_,
-                        std::equal_to<>(), allow_yielding_);
+                    auto state = wait_for_work(data);
 
                     HPX_ASSERT(!priority_bound_ ||
                         thread_index_ == hpx::get_worker_thread_num());
@@ -285,15 +389,29 @@ namespace hpx::execution::experimental {
 
                             hpx::util::itt::mark_event e(notify_event);
 #endif
-                            data.thread_function_helper_(region_data_,
-                                thread_index_, num_threads_, queues_,
-                                exception_mutex_, exception_);
+                            if (data.nested_team_ == nullptr)
+                            {
+                                data.thread_function_helper_(region_data_,
+                                    thread_index_, num_threads_, queues_,
+                                    exception_mutex_, exception_);
+                            }
+                            else
+                            {
+                                // this thread has been borrowed by a nested
+                                // parallel region
+                                nested_team const& team = *data.nested_team_;
+                                data.nested_team_ = nullptr;
+
+                                data.thread_function_helper_(
+                                    team.region_data_, data.nested_index_,
+                                    team.num_threads_, team.queues_,
+                                    team.exception_mutex_, team.exception_);
+
+                                set_state_this_thread(data, thread_state::idle);
+                            }
                         }
 
-                        // wait as long the state is 'idle'
-                        state = shared_data::wait_state_this_thread_while(
-                            data.state_, thread_state::idle, yield_delay_,
-                            std::equal_to<>(), allow_yielding_);
+                        state = wait_for_work(data);
 
                         HPX_ASSERT(!priority_bound_ ||
                             thread_index_ == hpx::get_worker_thread_num());
@@ -317,10 +435,21 @@ namespace hpx::execution::experimental {
                 {
                     region_data_[t].data_.state_.store(
                         state, std::memory_order_release);
+                    notify_worker(t);
                     HPX_SMT_PAUSE;
                 }
             }
 
+            // wake up the given worker thread if it has been suspended while
+            // waiting for work
+            void notify_worker(std::size_t const t)
+            {
+                if (idle_mode_ == idle_mode::passive && t != main_thread_)
+                {
+                    notify_state_change(region_data_[t].data_);
+                }
+            }
+
             void wait_state_all(thread_state const state) const noexcept
             {
                 bool const allow_yielding =
@@ -489,7 +618,9 @@ namespace hpx::execution::experimental {
                                 .queues_ = queues_,
                                 .priority_bound_ = priority_bound,
                                 .allow_yielding_ = stacksize_ !=
-                                    threads::thread_stacksize::nostack});
+                                    threads::thread_stacksize::nostack,
+                                .suspend_when_idle_ =
+                                    idle_mode_ == idle_mode::passive});
 
                         ++t;
                     }
@@ -554,11 +685,13 @@ namespace hpx::execution::experimental {
             explicit shared_data(threads::thread_priority const priority,
                 threads::thread_stacksize const stacksize,
                 loop_schedule const sched,
-                std::chrono::nanoseconds const yield_delay)
+                std::chrono::nanoseconds const yield_delay,
+                idle_mode const idle)
               : pool_(threads::detail::get_self_or_default_pool())
               , priority_(priority)
               , stacksize_(stacksize)
               , schedule_(sched)
+              , idle_mode_(idle)
               , yield_delay_(static_cast<std::uint64_t>(
                     static_cast<double>(yield_delay.count()) /
                     pool_->timestamp_scale()))
@@ -575,11 +708,12 @@ namespace hpx::execution::experimental {
                 threads::thread_stacksize const stacksize,
                 loop_schedule const sched,
                 std::chrono::nanoseconds const yield_delay,
-                hpx::threads::mask_cref_type pu_mask)
+                idle_mode const idle, hpx::threads::mask_cref_type pu_mask)
               : pool_(threads::detail::get_self_or_default_pool())
               , priority_(priority)
               , stacksize_(stacksize)
               , schedule_(sched)
+              , idle_mode_(idle)
               , yield_delay_(static_cast<std::uint64_t>(
                     static_cast<double>(yield_delay.count()) /
                     pool_->timestamp_scale()))
@@ -627,6 +761,7 @@ namespace hpx::execution::experimental {
                 return pool_ == rhs.pool_ && priority_ == rhs.priority_ &&
                     stacksize_ == rhs.stacksize_ &&
                     schedule_ == rhs.schedule_ &&
+                    idle_mode_ == rhs.idle_mode_ &&
                     yield_delay_ == rhs.yield_delay_ &&
                     pu_mask_ == rhs.pu_mask_;
             }
@@ -913,6 +1048,16 @@ namespace hpx::execution::experimental {
                         Args>::call_dynamic;
                 }
 
+                // Claim all worker threads before handing out any work. A
+                // worker thread that starts executing this region may open a
+                // nested region, which must not borrow threads that have not
+                // been given their part of this region yet.
+                for (std::size_t t = 0; t != num_threads_; ++t)
+                {
+                    region_data_[t].data_.state_.store(
+                        thread_state::reserved, std::memory_order_relaxed);
+                }
+
                 for (std::size_t t = 0; t != num_threads_; ++t)
                 {
                     region_data& data = region_data_[t].data_;
@@ -924,9 +1069,11 @@ namespace hpx::execution::experimental {
                     data.thread_function_helper_ = func;
                     data.results_ = results;
                     data.sync_with_main_thread_ = sync_with_main_thread;
+                    data.nested_team_ = nullptr;
                     // NOLINTEND(bugprone-multi-level-implicit-pointer-conversion)
 
                     data.state_.store(state, std::memory_order_release);
+                    notify_worker(t);
                 }
                 return func;
             }
@@ -946,9 +1093,12 @@ namespace hpx::execution::experimental {
                         continue;    // don't run sync task on main thread
                     }
 
+                    // claim the worker thread, it may concurrently be
+                    // borrowed by a nested region
                     region_data& data = region_data_[t].data_;
-                    if (data.state_.load(std::memory_order_acquire) ==
-                        thread_state::idle)
+                    auto expected = thread_state::idle;
+                    if (data.state_.compare_exchange_strong(expected,
+                            thread_state::reserved, std::memory_order_acq_rel))
                     {
                         // NOLINTBEGIN(bugprone-multi-level-implicit-pointer-conversion)
                         data.element_function_ = &function_pack;
@@ -956,9 +1106,11 @@ namespace hpx::execution::experimental {
                         data.argument_pack_ = &args;
                         data.thread_function_helper_ = func;
                         data.sync_with_main_thread_ = sync_with_main_thread;
+                        data.nested_team_ = nullptr;
                         // NOLINTEND(bugprone-multi-level-implicit-pointer-conversion)
 
                         data.state_.store(state, std::memory_order_release);
+                        notify_worker(t);
                         return t;
                     }
                 }
@@ -984,10 +1136,168 @@ namespace hpx::execution::experimental {
                 }
             }
 
+            // Return the index of the team member the calling thread is
+            // associated with if it currently executes a parallel region of
+            // this executor, -1 otherwise.
+            [[nodiscard]] std::size_t find_active_team_member() const noexcept
+            {
+                auto const self = threads::get_self_id();
+                if (self == threads::invalid_thread_id)
+                {
+                    return static_cast<std::size_t>(-1);
+                }
+
+                for (std::size_t t = 0; t != num_threads_; ++t)
+                {
+                    region_data const& data = region_data_[t].data_;
+                    if (data.thread_id_.load(std::memory_order_relaxed) ==
+                            self.get() &&
+                        data.state_.load(std::memory_order_acquire) !=
+                            thread_state::idle)
+                    {
+                        return t;
+                    }
+                }
+                return static_cast<std::size_t>(-1);
+            }
+
+            // Execute a nested parallel region on the calling thread and all
+            // worker threads that are idle at this point.
+            template <typename Result, typename F, typename S, typename Args>
+            void invoke_nested(
+                void* results, F& f, S const& shape, Args& argument_pack)
+            {
+                // Reserve all idle worker threads, this prevents concurrent
+                // nested regions from borrowing the same threads.
+                hpx::detail::small_vector<std::size_t, 16> members;
+                for (std::size_t t = 0; t != num_threads_; ++t)
+                {
+                    // the main thread does not wait for work
+                    if (t == main_thread_)
+                    {
+                        continue;
+                    }
+
+                    auto expected = thread_state::idle;
+                    if (region_data_[t].data_.state_.compare_exchange_strong(
+                            expected, thread_state::reserved,
+                            std::memory_order_acq_rel))
+                    {
+                        members.push_back(t);
+                    }
+                }
+
+                std::size_t const team_size = members.size() + 1;
+
+                thread_function_helper_type* func;
+                if (schedule_ == loop_schedule::static_ || team_size == 1)
+                {
+                    func = &thread_function_helper<Result, F, S,
+                        Args>::call_static;
+                }
+                else
+                {
+                    func = &thread_function_helper<Result, F, S,
+                        Args>::call_dynamic;
+                }
+
+                region_data_type team_data(team_size);
+                queues_type team_queues(
+                    schedule_ == loop_schedule::dynamic ? team_size : 0);
+                hpx::spinlock team_mutex;
+                std::exception_ptr team_exception;
+                nested_team const team{team_data, team_queues, team_mutex,
+                    team_exception, team_size};
+
+                for (std::size_t i = 0; i != team_size; ++i)
+                {
+                    region_data& data = team_data[i].data_;
+
+                    // NOLINTBEGIN(bugprone-multi-level-implicit-pointer-conversion)
+                    data.element_function_ = &f;
+                    data.shape_ = &shape;
+                    data.argument_pack_ = &argument_pack;
+                    data.thread_function_helper_ = func;
+                    data.results_ = results;
+                    data.sync_with_main_thread_ = nullptr;
+                    // NOLINTEND(bugprone-multi-level-implicit-pointer-conversion)
+
+                    data.state_.store(thread_state::partitioning_work,
+                        std::memory_order_relaxed);
+                }
+
+                // hand the nested region to the borrowed worker threads
+                for (std::size_t i = 1; i != team_size; ++i)
+                {
+                    std::size_t const t = members[i - 1];
+                    region_data& data = region_data_[t].data_;
+
+                    data.thread_function_helper_ = func;
+                    data.nested_team_ = &team;
+                    data.nested_index_ = i;
+
+                    data.state_.store(thread_state::partitioning_work,
+                        std::memory_order_release);
+                    notify_worker(t);
+                }
+
+                // participate in the nested region
+                func(team_data, 0, team_size, team_queues, team_mutex,
+                    team_exception);
+
+                // wait for the borrowed threads to finish their work and
+                // to return to the enclosing region
+                bool const allow_yielding =
+                    stacksize_ != threads::thread_stacksize::nostack;
+                for (std::size_t const t : members)
+                {
+                    wait_state_this_thread_while(region_data_[t].data_.state_,
+                        thread_state::idle, yield_delay_,
+                        std::not_equal_to<>(), allow_yielding);
+                }
+
+                // rethrow exception, if any
+                if (team_exception)
+                {
+                    std::rethrow_exception(HPX_MOVE(team_exception));
+                }
+            }
+
+            template <typename F, typename S, typename... Ts>
+            decltype(auto) bulk_sync_execute_nested(
+                F&& f, S const& shape, Ts&&... ts)
+            {
+                auto argument_pack =
+                    hpx::forward_as_tuple(HPX_FORWARD(Ts, ts)...);
+
+                using result_type =
+                    hpx::parallel::execution::detail::bulk_execute_result_t<F,
+                        S, Ts...>;
+
+                if constexpr (std::is_void_v<result_type>)
+                {
+                    invoke_nested<void>(nullptr, f, shape, argument_pack);
+                }
+                else
+                {
+                    result_type results(hpx::util::size(shape));
+                    invoke_nested<result_type>(
+                        &results, f, shape, argument_pack);
+                    return results;
+                }
+            }
+
         public:
             template <typename F, typename S, typename... Ts>
             decltype(auto) bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
             {
+                // support for nested parallel regions
+                if (find_active_team_member() != static_cast<std::size_t>(-1))
+                {
+                    return bulk_sync_execute_nested(
+                        HPX_FORWARD(F, f), shape, HPX_FORWARD(Ts, ts)...);
+                }
+
                 // protect against nested use of this executor instance
                 if (region_data_[main_thread_].data_.state_.load(
                         std::memory_order_relaxed) != thread_state::idle)
@@ -1003,6 +1313,8 @@ namespace hpx::execution::experimental {
                         "fork_join_executor::bulk_sync_execute"));
 #endif
                 exception_ = std::exception_ptr();
+                region_data_[main_thread_].data_.thread_id_.store(
+                    threads::get_self_id().get(), std::memory_order_relaxed);
 
                 // Set the data for this parallel region
                 auto argument_pack =
@@ -1275,16 +1587,19 @@ namespace hpx::execution::experimental {
         /// \param sched     The loop schedule of the parallel regions.
         /// \param yield_delay The time after which the executor yields to other
         ///        work if it has not received any new work for execution.
+        /// \param idle      The way the worker threads wait for new work once
+        ///                  the yield delay has passed.
         explicit fork_join_executor(
             threads::thread_priority priority = threads::thread_priority::bound,
             threads::thread_stacksize stacksize =
                 threads::thread_stacksize::small_,
             loop_schedule sched = loop_schedule::dynamic,
             std::chrono::nanoseconds yield_delay = std::chrono::microseconds(
-                300))
+                300),
+            idle_mode idle = idle_mode::spin)
         {
             shared_data_ = std::make_shared<shared_data>(
-                priority, stacksize, sched, yield_delay);
+                priority, stacksize, sched, yield_delay, idle);
         }
 
         /// \brief Construct a fork_join_executor.
@@ -1296,16 +1611,19 @@ namespace hpx::execution::experimental {
         /// \param sched     The loop schedule of the parallel regions.
         /// \param yield_delay The time after which the executor yields to other
         ///        work if it has not received any new work for execution.
+        /// \param idle      The way the worker threads wait for new work once
+        ///                  the yield delay has passed.
         explicit fork_join_executor(hpx::threads::mask_cref_type pu_mask,
             threads::thread_priority priority = threads::thread_priority::bound,
             threads::thread_stacksize stacksize =
                 threads::thread_stacksize::small_,
             loop_schedule sched = loop_schedule::dynamic,
             std::chrono::nanoseconds yield_delay = std::chrono::microseconds(
-                300))
+                300),
+            idle_mode idle = idle_mode::spin)
         {
             shared_data_ = std::make_shared<shared_data>(
-                priority, stacksize, sched, yield_delay, pu_mask);
+                priority, stacksize, sched, yield_delay, idle, pu_mask);
         }
 
         friend fork_join_executor tag_invoke(
@@ -1360,6 +1678,9 @@ namespace hpx::execution::experimental {
     HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::ostream& operator<<(
         std::ostream& os, fork_join_executor::loop_schedule schedule);
 
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::ostream& operator<<(
+        std::ostream& os, fork_join_executor::idle_mode mode);
+
     /// \cond NOINTERNAL
     template <>
     struct is_bulk_one_way_executor<fork_join_executor> : std::true_type
@@ -0,0 +1,315 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_graph.hpp
+/// \page hpx::execution::experimental::task_graph
+/// \headerfile hpx/execution.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/datastructures.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/futures.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::execution::experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A task_graph records a directed acyclic graph of tasks once and
+    /// replays it on an executor as often as needed.
+    ///
+    /// Applications that build the same dataflow graph (using hpx::dataflow,
+    /// future::then, or when_all) over and over again pay for allocating the
+    /// shared states and for the scheduling decisions every time. A
+    /// task_graph instead stores the tasks together with their successors
+    /// and the number of their predecessors. Replaying the graph resets the
+    /// preallocated dependency counters, schedules all tasks without
+    /// predecessors on the given executor, and runs every other task as soon
+    /// as its last predecessor has finished. One of the tasks that are made
+    /// ready by a finishing task is run directly on the same thread, all
+    /// others are posted to the executor.
+    ///
+    /// Tasks can depend only on tasks that were added before, which makes
+    /// sure the graph is acyclic. If a task throws an exception, the tasks
+    /// that have not been started yet are skipped and the exception is
+    /// reported through the future returned by replay(). A graph must not be
+    /// modified or replayed again while a replay is in progress.
+    HPX_CXX_CORE_EXPORT class task_graph
+    {
+    public:
+        using node_id = std::size_t;
+
+        task_graph() = default;
+
+        task_graph(task_graph const&) = delete;
+        task_graph(task_graph&&) = delete;
+        task_graph& operator=(task_graph const&) = delete;
+        task_graph& operator=(task_graph&&) = delete;
+
+        ~task_graph() = default;
+
+        /// Add a task to the graph that will be run after all the given tasks
+        /// have finished. Returns the identifier of the new task.
+        template <typename F>
+        node_id add(F&& f, std::initializer_list<node_id> dependencies = {})
+        {
+            return add_node(
+                HPX_FORWARD(F, f), dependencies.begin(), dependencies.end());
+        }
+
+        template <typename F>
+        node_id add(F&& f, std::vector<node_id> const& dependencies)
+        {
+            return add_node(
+                HPX_FORWARD(F, f), dependencies.begin(), dependencies.end());
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return nodes_.size();
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return nodes_.empty();
+        }
+
+        /// Remove all tasks from the graph.
+        void clear() noexcept
+        {
+            nodes_.clear();
+            roots_.clear();
+            counters_.reset();
+            num_counters_ = 0;
+        }
+
+        /// Run all tasks of the graph on the given executor. The returned
+        /// future becomes ready once all tasks have finished. If one of the
+        /// initial tasks can't be posted, the exception is rethrown once the
+        /// tasks already started have finished.
+        template <typename Executor>
+        hpx::future<void> replay(Executor&& exec)
+        {
+            if (nodes_.empty())
+            {
+                return hpx::make_ready_future();
+            }
+
+            prepare_replay();
+
+            hpx::future<void> result = promise_.get_future();
+            for (std::size_t i = 0; i != roots_.size(); ++i)
+            {
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        hpx::parallel::execution::post(exec,
+                            [this, root = roots_[i], exec]() mutable {
+                                execute(root, exec);
+                            });
+                    },
+                    [&](std::exception_ptr ep) {
+                        // Skip all remaining tasks. The roots which were not
+                        // posted are released directly, this accounts for
+                        // them and their successors in remaining_, then wait
+                        // for the tasks already in flight before rethrowing.
+                        if (!failed_.exchange(true, std::memory_order_relaxed))
+                        {
+                            exception_ = ep;
+                        }
+                        for (std::size_t j = i; j != roots_.size(); ++j)
+                        {
+                            execute(roots_[j], exec);
+                        }
+                        result.wait();
+                        std::rethrow_exception(HPX_MOVE(ep));
+                    });
+            }
+            return result;
+        }
+
+        /// Run all tasks of the graph on the given executor and wait for them
+        /// to finish.
+        template <typename Executor>
+        void run(Executor&& exec)
+        {
+            replay(HPX_FORWARD(Executor, exec)).get();
+        }
+
+    private:
+        struct node
+        {
+            hpx::move_only_function<void()> f_;
+            hpx::detail::small_vector<node_id, 4> successors_;
+            std::uint32_t num_predecessors_ = 0;
+        };
+
+        template <typename F, typename Iterator>
+        node_id add_node(F&& f, Iterator begin, Iterator end)
+        {
+            node_id const id = nodes_.size();
+
+            for (Iterator it = begin; it != end; ++it)
+            {
+                if (*it >= id)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "task_graph::add",
+                        "tasks can depend only on tasks that were added "
+                        "before");
+                }
+            }
+
+            node n;
+            n.f_ = HPX_FORWARD(F, f);
+            for (/**/; begin != end; ++begin)
+            {
+                nodes_[*begin].successors_.push_back(id);
+                ++n.num_predecessors_;
+            }
+
+            if (n.num_predecessors_ == 0)
+            {
+                roots_.push_back(id);
+            }
+
+            nodes_.push_back(HPX_MOVE(n));
+            return id;
+        }
+
+        void prepare_replay()
+        {
+            if (num_counters_ != nodes_.size())
+            {
+                counters_.reset(
+                    new std::atomic<std::uint32_t>[nodes_.size()]);
+                num_counters_ = nodes_.size();
+            }
+
+            for (std::size_t i = 0; i != nodes_.size(); ++i)
+            {
+                counters_[i].store(
+                    nodes_[i].num_predecessors_, std::memory_order_relaxed);
+            }
+
+            remaining_.store(nodes_.size(), std::memory_order_relaxed);
+            failed_.store(false, std::memory_order_relaxed);
+            exception_ = std::exception_ptr();
+            promise_ = hpx::promise<void>();
+        }
+
+        template <typename Executor>
+        void execute(node_id id, Executor& exec) noexcept
+        {
+            constexpr node_id no_node = static_cast<node_id>(-1);
+
+            while (true)
+            {
+                // skip all remaining tasks once one of the tasks has failed
+                if (!failed_.load(std::memory_order_relaxed))
+                {
+                    hpx::detail::try_catch_exception_ptr(
+                        [&]() { nodes_[id].f_(); },
+                        [&](std::exception_ptr ep) {
+                            if (!failed_.exchange(
+                                    true, std::memory_order_relaxed))
+                            {
+                                exception_ = HPX_MOVE(ep);
+                            }
+                        });
+                }
+
+                // release the successors, continue with the first one that
+                // became ready on this thread
+                node_id next = no_node;
+                for (node_id const successor : nodes_[id].successors_)
+                {
+                    if (counters_[successor].fetch_sub(
+                            1, std::memory_order_acq_rel) != 1)
+                    {
+                        continue;
+                    }
+
+                    if (next == no_node)
+                    {
+                        next = successor;
+                    }
+                    else
+                    {
+                        post_node(successor, exec);
+                    }
+                }
+
+                if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    // this was the last task, the graph must not be accessed
+                    // anymore once the promise has been made ready
+                    HPX_ASSERT(next == no_node);
+                    finish();
+                    return;
+                }
+
+                if (next == no_node)
+                {
+                    return;
+                }
+                id = next;
+            }
+        }
+
+        template <typename Executor>
+        void post_node(node_id id, Executor& exec) noexcept
+        {
+            hpx::detail::try_catch_exception_ptr(
+                [&]() {
+                    hpx::parallel::execution::post(exec,
+                        [this, id, exec]() mutable { execute(id, exec); });
+                },
+                [&](std::exception_ptr) {
+                    // if the task can't be scheduled, run it directly
+                    execute(id, exec);
+                });
+        }
+
+        void finish() noexcept
+        {
+            hpx::promise<void> p = HPX_MOVE(promise_);
+            std::exception_ptr ep = HPX_MOVE(exception_);
+
+            if (ep)
+            {
+                p.set_exception(HPX_MOVE(ep));
+            }
+            else
+            {
+                p.set_value();
+            }
+        }
+
+        std::vector<node> nodes_;
+        std::vector<node_id> roots_;
+
+        // per-replay state
+        std::unique_ptr<std::atomic<std::uint32_t>[]> counters_;
+        std::size_t num_counters_ = 0;
+        std::atomic<std::size_t> remaining_{0};
+        std::atomic<bool> failed_{false};
+        std::exception_ptr exception_;
+        hpx::promise<void> promise_;
+    };
+}    // namespace hpx::execution::experimental
@@ -28,6 +28,7 @@
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/executors/detail/index_queue_stealing.hpp>
 #include <hpx/executors/thread_pool_scheduler.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
@@ -195,40 +196,31 @@ namespace hpx::execution::experimental::detail {
             auto worker_thread = task_f->worker_thread;
             auto& local_queue = op_state->queues[worker_thread].data_;
 
-            // Handle local queue first
-            hpx::optional<std::uint32_t> index;
-            while ((index = local_queue.template pop<Which>()))
-            {
-                do_work_chunk(ts, *index);
-            }
+            // Steal from the opposite end of the neighboring queues
+            static constexpr auto opposite_end =
+                hpx::concurrency::detail::opposite_end_v<Which>;
 
-            if (task_f->allow_stealing)
+            // Handle local queue first. Whenever it runs dry, move half of
+            // the chunks left in one of the neighboring queues into the local
+            // queue, where they can be stolen again by other idle workers.
+            hpx::optional<std::uint32_t> index;
+            do
             {
-                // Then steal from the opposite end of the neighboring queues
-                static constexpr auto opposite_end =
-                    hpx::concurrency::detail::opposite_end_v<Which>;
-
-                for (std::uint32_t offset = 1;
-                    offset != op_state->num_worker_threads; ++offset)
+                while ((index = local_queue.template pop<Which>()))
                 {
-                    std::size_t neighbor_thread =
-                        (worker_thread + offset) % op_state->num_worker_threads;
-                    auto& neighbor_queue =
-                        op_state->queues[neighbor_thread].data_;
-
-                    while (
-                        (index = neighbor_queue.template pop<opposite_end>()))
-                    {
-                        do_work_chunk(ts, *index);
-                    }
+                    do_work_chunk(ts, *index);
                 }
-            }
+            } while (task_f->allow_stealing &&
+                hpx::parallel::execution::detail::steal_index_range<
+                    opposite_end>(op_state->queues, worker_thread,
+                    op_state->num_worker_threads));
         }
 
     public:
         // Visit the values sent from the predecessor sender. This function
         // first tries to handle all chunks in the queue owned by worker_thread.
-        // It then tries to steal chunks from neighboring threads.
+        // It then tries to steal chunks from neighboring threads, splitting
+        // the remaining work of the victim in half each time.
         //
         template <typename Ts>
             requires(!std::same_as<std::decay_t<Ts>, hpx::monostate>)
@@ -657,7 +649,10 @@ namespace hpx::execution::experimental::detail {
     // thread is spawned for each underlying worker (OS) thread. The HPX thread
     // is responsible for work in one queue. If the queue is empty, no HPX
     // thread will be spawned. Once the HPX thread has finished working on its
-    // own queue, it will attempt to steal work from other queues.
+    // own queue, it will attempt to steal work from other queues. It moves
+    // half of the chunks left in the victim's queue into its own queue (lazy
+    // binary splitting), so imbalanced work is redistributed recursively
+    // between all idle workers.
     //
     // Since predecessor sender must complete on an HPX thread (the completion
     // scheduler is a thread_pool_scheduler; otherwise the customization defined
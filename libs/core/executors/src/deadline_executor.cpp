@@ -0,0 +1,240 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/executors/deadline_executor.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    namespace {
+
+        // process-wide counters, exposed as performance counters
+        std::atomic<std::int64_t> deadline_tasks_count(0);
+        std::atomic<std::int64_t> deadline_misses_count(0);
+        std::atomic<std::int64_t> deadline_steals_count(0);
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& counter, bool reset) noexcept
+        {
+            if (reset)
+            {
+                return counter.exchange(0, std::memory_order_relaxed);
+            }
+            return counter.load(std::memory_order_relaxed);
+        }
+    }    // namespace
+
+    std::int64_t get_deadline_tasks_count(bool reset)
+    {
+        return get_and_reset(deadline_tasks_count, reset);
+    }
+
+    std::int64_t get_deadline_misses_count(bool reset)
+    {
+        return get_and_reset(deadline_misses_count, reset);
+    }
+
+    std::int64_t get_deadline_steals_count(bool reset)
+    {
+        return get_and_reset(deadline_steals_count, reset);
+    }
+}    // namespace hpx::execution::experimental
+
+namespace hpx::execution::experimental::detail {
+
+    namespace {
+
+        std::size_t default_num_queues()
+        {
+            threads::thread_pool_base const* pool =
+                threads::detail::get_self_or_default_pool();
+            return pool != nullptr ? (std::max) (pool->get_os_thread_count(),
+                                         static_cast<std::size_t>(1)) :
+                                     1;
+        }
+    }    // namespace
+
+    deadline_queues::deadline_queues(std::size_t num_queues)
+      : queues_(num_queues != 0 ? num_queues : default_num_queues())
+      , sequence_(0)
+      , next_queue_(0)
+      , executed_(0)
+      , missed_(0)
+      , stolen_(0)
+    {
+    }
+
+    deadline_queues::~deadline_queues() = default;
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        // std::push_heap/pop_heap create a max-heap, the 'largest' item is the
+        // one with the earliest deadline (and the smallest sequence number)
+        struct later_deadline
+        {
+            template <typename Item>
+            bool operator()(Item const& lhs, Item const& rhs) const noexcept
+            {
+                if (lhs.deadline != rhs.deadline)
+                {
+                    return lhs.deadline > rhs.deadline;
+                }
+                return lhs.sequence > rhs.sequence;
+            }
+        };
+    }    // namespace
+
+    std::size_t deadline_queues::current_queue() noexcept
+    {
+        std::size_t const num_thread = hpx::get_worker_thread_num();
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            return num_thread % queues_.size();
+        }
+
+        // distribute tasks scheduled from outside the runtime
+        return next_queue_.fetch_add(1, std::memory_order_relaxed) %
+            queues_.size();
+    }
+
+    void deadline_queues::push(time_point deadline, task_type&& f)
+    {
+        std::uint64_t const sequence =
+            sequence_.fetch_add(1, std::memory_order_relaxed);
+
+        queue& q = queues_[current_queue()].data_;
+
+        std::lock_guard<hpx::spinlock> l(q.mtx);
+        q.heap.push_back(item{deadline, sequence, HPX_MOVE(f)});
+        std::push_heap(q.heap.begin(), q.heap.end(), later_deadline{});
+        q.earliest.store(q.heap.front().deadline.time_since_epoch().count(),
+            std::memory_order_relaxed);
+    }
+
+    bool deadline_queues::try_pop(std::size_t qnum, item& result)
+    {
+        queue& q = queues_[qnum].data_;
+
+        std::lock_guard<hpx::spinlock> l(q.mtx);
+        if (q.heap.empty())
+        {
+            return false;
+        }
+
+        std::pop_heap(q.heap.begin(), q.heap.end(), later_deadline{});
+        result = HPX_MOVE(q.heap.back());
+        q.heap.pop_back();
+
+        q.earliest.store(q.heap.empty() ?
+                (time_point::max)().time_since_epoch().count() :
+                q.heap.front().deadline.time_since_epoch().count(),
+            std::memory_order_relaxed);
+        return true;
+    }
+
+    bool deadline_queues::try_pop_earliest(
+        std::size_t local, item& result, std::size_t& source)
+    {
+        std::size_t const num_queues = queues_.size();
+
+        // steal from another queue only if it holds a task with an earlier
+        // deadline than the local queue
+        std::size_t best = local;
+        time_point::rep best_deadline =
+            queues_[local].data_.earliest.load(std::memory_order_relaxed);
+        for (std::size_t i = 1; i != num_queues; ++i)
+        {
+            std::size_t const victim = (local + i) % num_queues;
+            time_point::rep const deadline =
+                queues_[victim].data_.earliest.load(std::memory_order_relaxed);
+            if (deadline < best_deadline)
+            {
+                best = victim;
+                best_deadline = deadline;
+            }
+        }
+
+        if (try_pop(best, result))
+        {
+            source = best;
+            return true;
+        }
+
+        // the hint was outdated or all queued tasks have no deadline, take
+        // the first task that can be found, starting with the local queue
+        for (std::size_t i = 0; i != num_queues; ++i)
+        {
+            std::size_t const victim = (local + i) % num_queues;
+            if (try_pop(victim, result))
+            {
+                source = victim;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void deadline_queues::run_next()
+    {
+        std::size_t const local = current_queue();
+
+        // Every pushed task is followed by exactly one call to run_next, thus
+        // there is at least one task that has not been taken by any other
+        // runner yet. It may be missed by try_pop_earliest if it's pushed to
+        // a queue that was inspected before, in which case we try again.
+        item task;
+        std::size_t source = local;
+        hpx::util::yield_while(
+            [&]() { return !try_pop_earliest(local, task, source); },
+            "deadline_queues::run_next");
+
+        if (source != local)
+        {
+            stolen_.fetch_add(1, std::memory_order_relaxed);
+            deadline_steals_count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        auto on_exit = hpx::experimental::scope_exit([&] {
+            if (task.deadline != (time_point::max)())
+            {
+                deadline_tasks_count.fetch_add(1, std::memory_order_relaxed);
+                if (hpx::chrono::steady_clock::now() > task.deadline)
+                {
+                    missed_.fetch_add(1, std::memory_order_relaxed);
+                    deadline_misses_count.fetch_add(
+                        1, std::memory_order_relaxed);
+                }
+            }
+
+            // publish the other counters together with the number of
+            // executed tasks
+            executed_.fetch_add(1, std::memory_order_release);
+        });
+
+        task.f();
+    }
+
+    deadline_executor_statistics deadline_queues::statistics() const noexcept
+    {
+        deadline_executor_statistics result;
+        result.executed = executed_.load(std::memory_order_acquire);
+        result.missed = missed_.load(std::memory_order_relaxed);
+        result.stolen = stolen_.load(std::memory_order_relaxed);
+        return result;
+    }
+}    // namespace hpx::execution::experimental::detail
@@ -34,4 +34,28 @@ namespace hpx::execution::experimental {
 
         return os;
     }
+
+    std::ostream& operator<<(
+        std::ostream& os, fork_join_executor::idle_mode mode)
+    {
+        switch (mode)
+        {
+        case fork_join_executor::idle_mode::spin:
+            os << "spin";
+            break;
+        case fork_join_executor::idle_mode::passive:
+            os << "passive";
+            break;
+        default:
+            os << "<unknown>";
+            break;
+        }
+
+        os << " ("
+           << static_cast<
+                  std::underlying_type_t<fork_join_executor::idle_mode>>(mode)
+           << ")";
+
+        return os;
+    }
 }    // namespace hpx::execution::experimental
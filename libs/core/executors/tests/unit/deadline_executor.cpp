@@ -0,0 +1,298 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/functional.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+using steady_clock = hpx::chrono::steady_clock;
+
+///////////////////////////////////////////////////////////////////////////////
+// An executor that holds on to all posted work until it is explicitly run,
+// which allows to observe the order imposed by the deadline_executor.
+struct deferred_executor
+{
+    using execution_category = hpx::execution::parallel_execution_tag;
+    using executor_parameters_type =
+        hpx::execution::experimental::default_parameters;
+
+    std::shared_ptr<std::vector<hpx::move_only_function<void()>>> work =
+        std::make_shared<std::vector<hpx::move_only_function<void()>>>();
+
+    void run_all() const
+    {
+        auto pending = std::move(*work);
+        for (auto& f : pending)
+        {
+            f();
+        }
+    }
+
+    bool operator==(deferred_executor const& rhs) const noexcept
+    {
+        return work == rhs.work;
+    }
+
+    bool operator!=(deferred_executor const& rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    deferred_executor const& context() const noexcept
+    {
+        return *this;
+    }
+
+    template <typename F, typename... Ts>
+    friend void tag_invoke(hpx::parallel::execution::post_t,
+        deferred_executor const& exec, F&& f, Ts&&... ts)
+    {
+        exec.work->emplace_back(hpx::util::deferred_call(
+            std::forward<F>(f), std::forward<Ts>(ts)...));
+    }
+};
+
+template <>
+struct hpx::execution::experimental::is_one_way_executor<deferred_executor>
+  : std::true_type
+{
+};
+
+template <>
+struct hpx::execution::experimental::is_never_blocking_one_way_executor<
+    deferred_executor> : std::true_type
+{
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// the statistics are updated after a task has finished running, i.e. after
+// its future has become ready
+template <typename Executor>
+ex::deadline_executor_statistics wait_for_executed(
+    Executor const& exec, std::uint64_t count)
+{
+    hpx::util::yield_while(
+        [&]() { return exec.statistics().executed < count; });
+    return exec.statistics();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_properties()
+{
+    std::cerr << "test_properties\n";
+
+    // executors that don't support deadlines don't impose any
+    hpx::execution::parallel_executor par_exec;
+    HPX_TEST(ex::get_deadline(par_exec) == (steady_clock::time_point::max)());
+
+    ex::deadline_executor<> exec;
+    HPX_TEST(ex::get_deadline(exec) == (steady_clock::time_point::max)());
+    HPX_TEST(exec.num_queues() != 0);
+
+    auto const deadline = steady_clock::now() + std::chrono::seconds(10);
+    auto exec_with_deadline = ex::with_deadline(exec, deadline);
+    HPX_TEST(ex::get_deadline(exec_with_deadline) == deadline);
+    HPX_TEST(ex::get_deadline(exec) == (steady_clock::time_point::max)());
+    HPX_TEST(exec != exec_with_deadline);
+
+    // deadlines can be given using other clocks
+    auto exec_with_system_deadline = ex::with_deadline(
+        exec, std::chrono::system_clock::now() + std::chrono::seconds(10));
+    HPX_TEST(ex::get_deadline(exec_with_system_deadline) !=
+        (steady_clock::time_point::max)());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_edf_order()
+{
+    std::cerr << "test_edf_order\n";
+
+    deferred_executor base;
+    ex::deadline_executor<deferred_executor> exec(base, 2);
+
+    std::mutex mtx;
+    std::vector<int> order;
+    auto record = [&](int i) {
+        std::lock_guard<std::mutex> l(mtx);
+        order.push_back(i);
+    };
+
+    auto const now = steady_clock::now();
+    auto const in = [&](int seconds) {
+        return ex::with_deadline(exec, now + std::chrono::seconds(seconds));
+    };
+
+    // tasks without a deadline run last, in the order they were scheduled
+    hpx::parallel::execution::post(exec, record, 6);
+    hpx::parallel::execution::post(in(30), record, 3);
+    hpx::parallel::execution::post(in(10), record, 1);
+    hpx::parallel::execution::post(exec, record, 7);
+    hpx::parallel::execution::post(in(40), record, 4);
+    hpx::parallel::execution::post(in(20), record, 2);
+    hpx::parallel::execution::post(in(40), record, 5);
+
+    HPX_TEST(order.empty());
+    base.run_all();
+
+    HPX_TEST_EQ(order.size(), static_cast<std::size_t>(7));
+    for (std::size_t i = 0; i != order.size(); ++i)
+    {
+        HPX_TEST_EQ(order[i], static_cast<int>(i + 1));
+    }
+
+    auto const stats = exec.statistics();
+    HPX_TEST_EQ(stats.executed, static_cast<std::uint64_t>(7));
+    HPX_TEST_EQ(stats.missed, static_cast<std::uint64_t>(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_async()
+{
+    std::cerr << "test_async\n";
+
+    ex::deadline_executor<> exec;
+    auto const deadline = steady_clock::now() + std::chrono::seconds(60);
+    auto exec_with_deadline = ex::with_deadline(exec, deadline);
+
+    constexpr int num_tasks = 1000;
+
+    std::vector<hpx::future<int>> futures;
+    futures.reserve(num_tasks);
+    for (int i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(
+            hpx::async(exec_with_deadline, [](int j) { return j; }, i));
+    }
+
+    for (int i = 0; i != num_tasks; ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), i);
+    }
+
+    HPX_TEST_EQ(hpx::parallel::execution::sync_execute(
+                    exec_with_deadline, [](int j) { return j + 1; }, 41),
+        42);
+
+    hpx::future<int> f = hpx::parallel::execution::then_execute(
+        exec_with_deadline, [](hpx::future<int>&& f) { return f.get() + 1; },
+        hpx::make_ready_future(41));
+    HPX_TEST_EQ(f.get(), 42);
+
+    std::atomic<int> count(0);
+    hpx::latch l(num_tasks + 1);
+    for (int i = 0; i != num_tasks; ++i)
+    {
+        hpx::post(exec, [&]() {
+            ++count;
+            l.count_down(1);
+        });
+    }
+    l.arrive_and_wait();
+    HPX_TEST_EQ(count.load(), num_tasks);
+
+    auto const stats = wait_for_executed(exec, 2 * num_tasks + 2);
+    HPX_TEST_EQ(stats.executed, static_cast<std::uint64_t>(2 * num_tasks + 2));
+    HPX_TEST(stats.stolen <= stats.executed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_exception()
+{
+    std::cerr << "test_exception\n";
+
+    ex::deadline_executor<> exec;
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::async(exec, []() -> int {
+            throw std::runtime_error("test_exception");
+        }).get();
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(
+        wait_for_executed(exec, 1).executed, static_cast<std::uint64_t>(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_deadline_misses()
+{
+    std::cerr << "test_deadline_misses\n";
+
+    std::int64_t const tasks_before = ex::get_deadline_tasks_count(false);
+    std::int64_t const misses_before = ex::get_deadline_misses_count(false);
+
+    ex::deadline_executor<> exec;
+
+    // a deadline that has passed already is always missed
+    auto past = ex::with_deadline(
+        exec, steady_clock::now() - std::chrono::milliseconds(1));
+    auto future = ex::with_deadline(
+        exec, steady_clock::now() + std::chrono::seconds(60));
+
+    hpx::async(past, [] {}).get();
+    hpx::async(future, [] {}).get();
+    hpx::async(exec, [] {}).get();
+
+    auto const stats = wait_for_executed(exec, 3);
+    HPX_TEST_EQ(stats.executed, static_cast<std::uint64_t>(3));
+    HPX_TEST_EQ(stats.missed, static_cast<std::uint64_t>(1));
+
+    // tasks without a deadline are not counted
+    HPX_TEST_EQ(ex::get_deadline_tasks_count(false) - tasks_before,
+        static_cast<std::int64_t>(2));
+    HPX_TEST_EQ(ex::get_deadline_misses_count(false) - misses_before,
+        static_cast<std::int64_t>(1));
+
+    ex::get_deadline_misses_count(true);
+    HPX_TEST_EQ(ex::get_deadline_misses_count(false),
+        static_cast<std::int64_t>(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_properties();
+    test_edf_order();
+    test_async();
+    test_exception();
+    test_deadline_misses();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -437,6 +438,162 @@ void test_invoke_sync_exception(ExecutorArgs&&... args)
     HPX_TEST(caught_exception);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename... ExecutorArgs>
+void test_bulk_sync_nested(ExecutorArgs&&... args)
+{
+    std::cerr << "test_bulk_sync_nested\n";
+
+    constexpr std::size_t n_outer = 13;
+    constexpr std::size_t n_inner = 57;
+
+    std::vector<int> outer(n_outer);
+    std::iota(std::begin(outer), std::end(outer), 0);
+    std::vector<int> inner(n_inner);
+    std::iota(std::begin(inner), std::end(inner), 0);
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    // nested regions are executed by the calling thread and the idle
+    // members of the team
+    count1 = 0;
+    count2 = 0;
+    hpx::parallel::execution::bulk_sync_execute(
+        exec,
+        [&](int, int passed_through) {
+            HPX_TEST_EQ(passed_through, 42);
+            ++count1;
+
+            hpx::parallel::execution::bulk_sync_execute(
+                exec,
+                [](int, int passed_through) {
+                    HPX_TEST_EQ(passed_through, 43);
+                    ++count2;
+                },
+                inner, 43);
+        },
+        outer, 42);
+    HPX_TEST_EQ(count1.load(), n_outer);
+    HPX_TEST_EQ(count2.load(), n_outer * n_inner);
+
+    // nested regions returning results
+    std::vector<int> const sums = hpx::parallel::execution::bulk_sync_execute(
+        exec,
+        [&](int i) {
+            std::vector<int> const results =
+                hpx::parallel::execution::bulk_sync_execute(
+                    exec, [i](int j) { return i + j; }, inner);
+            return std::accumulate(results.begin(), results.end(), 0);
+        },
+        outer);
+
+    for (std::size_t i = 0; i != n_outer; ++i)
+    {
+        HPX_TEST_EQ(static_cast<std::size_t>(sums[i]),
+            i * n_inner + n_inner * (n_inner - 1) / 2);
+    }
+
+    // exceptions thrown in nested regions are propagated to the caller
+    bool caught_exception = false;
+    try
+    {
+        hpx::parallel::execution::bulk_sync_execute(
+            exec,
+            [&](int) {
+                hpx::parallel::execution::bulk_sync_execute(
+                    exec, &bulk_test_exception, inner, 42);
+            },
+            outer);
+
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const& /*e*/)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+
+    // the executor is usable after nested regions
+    count1 = 0;
+    hpx::parallel::execution::bulk_sync_execute(exec, &bulk_test, outer, 42);
+    HPX_TEST_EQ(count1.load(), n_outer);
+}
+
+// Every element of the outer region opens a nested region right away, the
+// first worker thread to start does so while the remaining worker threads
+// are still being handed their part of the outer region.
+template <typename... ExecutorArgs>
+void test_bulk_sync_nested_while_publishing(ExecutorArgs&&... args)
+{
+    std::cerr << "test_bulk_sync_nested_while_publishing\n";
+
+    std::size_t const n_outer = hpx::get_num_worker_threads();
+    constexpr std::size_t n_inner = 16;
+
+    std::vector<int> outer(n_outer);
+    std::iota(std::begin(outer), std::end(outer), 0);
+    std::vector<int> inner(n_inner);
+    std::iota(std::begin(inner), std::end(inner), 0);
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    for (std::size_t i = 0; i != 1000; ++i)
+    {
+        std::vector<std::atomic<std::size_t>> outer_counts(n_outer);
+        count2 = 0;
+        hpx::parallel::execution::bulk_sync_execute(
+            exec,
+            [&](int j) {
+                hpx::parallel::execution::bulk_sync_execute(
+                    exec, [](int) { ++count2; }, inner);
+                ++outer_counts[j];
+            },
+            outer);
+
+        for (auto const& count : outer_counts)
+        {
+            HPX_TEST_EQ(count.load(), static_cast<std::size_t>(1));
+        }
+        HPX_TEST_EQ(count2.load(), n_outer * n_inner);
+    }
+}
+
+void test_passive_idle_mode(fork_join_executor::loop_schedule schedule)
+{
+    std::cerr << "test_passive_idle_mode\n";
+
+    constexpr std::size_t n = 107;
+    std::vector<int> v(n);
+    std::iota(std::begin(v), std::end(v), 0);
+
+    fork_join_executor exec{hpx::threads::thread_priority::bound,
+        hpx::threads::thread_stacksize::small_, schedule,
+        std::chrono::microseconds(1), fork_join_executor::idle_mode::passive};
+
+    count1 = 0;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        // give the worker threads time to suspend
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        hpx::parallel::execution::bulk_sync_execute(exec, &bulk_test, v, 42);
+        HPX_TEST_EQ(count1.load(), (i + 1) * n);
+    }
+
+    test_bulk_sync_nested(hpx::threads::thread_priority::bound,
+        hpx::threads::thread_stacksize::small_, schedule,
+        std::chrono::microseconds(1), fork_join_executor::idle_mode::passive);
+    test_bulk_sync_nested_while_publishing(
+        hpx::threads::thread_priority::bound,
+        hpx::threads::thread_stacksize::small_, schedule,
+        std::chrono::microseconds(1), fork_join_executor::idle_mode::passive);
+}
+
 void static_check_executor()
 {
     using namespace hpx::traits;
@@ -470,6 +627,9 @@ void test_executor(hpx::threads::thread_priority priority,
     test_invoke_sync_homogeneous_exception(priority, stacksize, schedule);
     test_invoke_sync_exception(priority, stacksize, schedule);
 
+    test_bulk_sync_nested(priority, stacksize, schedule);
+    test_bulk_sync_nested_while_publishing(priority, stacksize, schedule);
+
     test_processing_mask(priority, stacksize, schedule);
 }
 
@@ -509,6 +669,9 @@ int hpx_main()
     // Call regression test for #6922
     test_fork_join_static_large_range();
 
+    test_passive_idle_mode(fork_join_executor::loop_schedule::static_);
+    test_passive_idle_mode(fork_join_executor::loop_schedule::dynamic);
+
     // Using thread_priority::low hangs for unknown reasons.
     for (auto const priority : {
              // hpx::threads::thread_priority::low,
@@ -0,0 +1,281 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_diamond()
+{
+    std::cerr << "test_diamond\n";
+
+    // a -> (b, c) -> d, every task verifies that its predecessors are done
+    std::atomic<int> a(0), b(0), c(0), d(0);
+    std::atomic<bool> order_violated(false);
+
+    ex::task_graph g;
+    auto const ta = g.add([&] { ++a; });
+    auto const tb = g.add(
+        [&] {
+            if (b.load() != a.load() - 1)
+                order_violated = true;
+            ++b;
+        },
+        {ta});
+    auto const tc = g.add(
+        [&] {
+            if (c.load() != a.load() - 1)
+                order_violated = true;
+            ++c;
+        },
+        {ta});
+    g.add(
+        [&] {
+            if (d.load() != b.load() - 1 || d.load() != c.load() - 1)
+                order_violated = true;
+            ++d;
+        },
+        {tb, tc});
+
+    HPX_TEST_EQ(g.size(), static_cast<std::size_t>(4));
+
+    hpx::execution::parallel_executor exec;
+    for (int i = 0; i != 10; ++i)
+    {
+        g.run(exec);
+    }
+
+    HPX_TEST(!order_violated);
+    HPX_TEST_EQ(a.load(), 10);
+    HPX_TEST_EQ(b.load(), 10);
+    HPX_TEST_EQ(c.load(), 10);
+    HPX_TEST_EQ(d.load(), 10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// a time-stepping like graph: every cell depends on itself and its neighbors
+// in the previous step
+void test_stencil()
+{
+    std::cerr << "test_stencil\n";
+
+    constexpr std::size_t width = 16;
+    constexpr std::size_t steps = 8;
+
+    std::vector<std::atomic<std::size_t>> values(width * (steps + 1));
+
+    ex::task_graph g;
+    std::vector<ex::task_graph::node_id> previous(width);
+    for (std::size_t i = 0; i != width; ++i)
+    {
+        previous[i] = g.add([&values, i] { ++values[i]; });
+    }
+
+    for (std::size_t s = 1; s <= steps; ++s)
+    {
+        std::vector<ex::task_graph::node_id> current(width);
+        for (std::size_t i = 0; i != width; ++i)
+        {
+            std::size_t const left = (i + width - 1) % width;
+            std::size_t const right = (i + 1) % width;
+
+            current[i] = g.add(
+                [&values, s, i, left, right] {
+                    std::size_t const prev = (s - 1) * width;
+                    std::size_t const expected = values[s * width + i] + 1;
+                    HPX_TEST_EQ(values[prev + left].load(), expected);
+                    HPX_TEST_EQ(values[prev + i].load(), expected);
+                    HPX_TEST_EQ(values[prev + right].load(), expected);
+                    ++values[s * width + i];
+                },
+                {previous[left], previous[i], previous[right]});
+        }
+        previous = current;
+    }
+
+    hpx::execution::parallel_executor exec;
+    std::size_t const replays = 20;
+    for (std::size_t r = 0; r != replays; ++r)
+    {
+        g.replay(exec).get();
+    }
+
+    for (auto const& v : values)
+    {
+        HPX_TEST_EQ(v.load(), replays);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_exception()
+{
+    std::cerr << "test_exception\n";
+
+    std::atomic<int> executed(0);
+
+    ex::task_graph g;
+    auto const t1 = g.add([&] { ++executed; });
+    auto const t2 =
+        g.add([]() { throw std::runtime_error("test_exception"); }, {t1});
+    g.add([&] { ++executed; }, {t2});
+
+    hpx::execution::parallel_executor exec;
+
+    bool caught_exception = false;
+    try
+    {
+        g.run(exec);
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // the successor of the failing task was skipped
+    HPX_TEST_EQ(executed.load(), 1);
+
+    // the graph can be replayed after a failure
+    caught_exception = false;
+    try
+    {
+        g.run(exec);
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(executed.load(), 2);
+
+    // dependencies on tasks that don't exist yet are rejected
+    caught_exception = false;
+    try
+    {
+        g.add([] {}, {g.size()});
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(g.size(), static_cast<std::size_t>(3));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// an executor which fails to post tasks once its budget is used up
+struct failing_executor
+{
+    template <typename F>
+    friend void tag_invoke(hpx::parallel::execution::post_t,
+        failing_executor const& exec, F&& f)
+    {
+        if (exec.budget_->fetch_sub(1) <= 0)
+        {
+            throw std::runtime_error("failing_executor");
+        }
+        hpx::parallel::execution::post(exec.exec_, std::forward<F>(f));
+    }
+
+    hpx::execution::parallel_executor exec_;
+    std::shared_ptr<std::atomic<int>> budget_;
+};
+
+void test_post_failure()
+{
+    std::cerr << "test_post_failure\n";
+
+    // three independent chains of two tasks each
+    std::atomic<int> executed(0);
+
+    ex::task_graph g;
+    for (int i = 0; i != 3; ++i)
+    {
+        auto const t = g.add([&] { ++executed; });
+        g.add([&] { ++executed; }, {t});
+    }
+
+    // the second root can't be posted, replay returns only after the tasks
+    // already in flight have finished and rethrows the error
+    failing_executor exec{{}, std::make_shared<std::atomic<int>>(1)};
+
+    bool caught_exception = false;
+    try
+    {
+        g.run(exec);
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_LTE(executed.load(), 2);
+
+    // the graph can be replayed after a failure
+    executed = 0;
+    g.run(hpx::execution::parallel_executor());
+    HPX_TEST_EQ(executed.load(), 6);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_empty()
+{
+    std::cerr << "test_empty\n";
+
+    ex::task_graph g;
+    HPX_TEST(g.empty());
+    g.run(hpx::execution::parallel_executor());
+
+    std::atomic<int> executed(0);
+    g.add([&] { ++executed; });
+    g.run(hpx::execution::parallel_executor());
+    HPX_TEST_EQ(executed.load(), 1);
+
+    // adding tasks after a replay is possible
+    g.add([&] { ++executed; }, {0});
+    g.run(hpx::execution::parallel_executor());
+    HPX_TEST_EQ(executed.load(), 3);
+
+    g.clear();
+    HPX_TEST(g.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_diamond();
+    test_stencil();
+    test_exception();
+    test_post_failure();
+    test_empty();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -53,6 +53,20 @@ namespace hpx::lcos::detail {
     HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void set_run_on_completed_error_handler(
         run_on_completed_error_handler_type f);
 
+    // Set (get) the maximum number of nested continuations launched with
+    // hpx::launch::adaptive that are run inline on the same thread.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void set_continuation_inline_depth(
+        std::size_t depth) noexcept;
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::size_t
+    get_continuation_inline_depth() noexcept;
+
+    // Return whether a continuation launched with hpx::launch::adaptive can be
+    // run inline on the current thread, i.e. whether the current thread is an
+    // HPX thread that has neither exceeded the allowed continuation nesting
+    // depth nor is running low on stack space.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT bool
+    can_run_continuation_inline() noexcept;
+
     ///////////////////////////////////////////////////////////////////////
     HPX_CXX_CORE_EXPORT template <typename Result>
     struct future_data;
@@ -17,6 +17,7 @@
 #include <hpx/modules/async_base.hpp>
 #include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
 #include <hpx/modules/memory.hpp>
 #include <hpx/modules/threading_base.hpp>
 
@@ -322,20 +323,64 @@ namespace hpx::lcos::detail {
             }
 
             ptr->execute_deferred();
-            ptr->set_on_completed(
-                [this_ = HPX_MOVE(this_), state = HPX_MOVE(state),
-                    policy = HPX_FORWARD(Policy, policy),
-                    spawner = HPX_FORWARD(Spawner, spawner)]() mutable -> void {
-                    if (hpx::has_async_policy(policy))
+
+            // the launch policy is needed only to decide whether the
+            // continuation is run inline or on a new thread, for
+            // launch::adaptive this is decided once the future has become
+            // ready
+            bool const is_adaptive = hpx::has_adaptive_policy(policy);
+            bool const is_async = !is_adaptive && hpx::has_async_policy(policy);
+
+            using spawner_type = std::decay_t<Spawner>;
+            if constexpr (std::is_empty_v<spawner_type> &&
+                std::is_default_constructible_v<spawner_type>)
+            {
+                // Stateless spawners (the common .then() case) are recreated
+                // when the continuation runs. The completion handler then
+                // holds two pointers and two flags only, which fits into the
+                // small object buffer of the callback stored inline in the
+                // antecedent's shared state; attaching the continuation
+                // does not allocate.
+                auto on_completed = [this_ = HPX_MOVE(this_),
+                                        state = HPX_MOVE(state), is_async,
+                                        is_adaptive]() mutable -> void {
+                    if (is_async ||
+                        (is_adaptive && !can_run_continuation_inline()))
                     {
                         this_->template async<Unwrap>(
-                            HPX_MOVE(state), HPX_FORWARD(Spawner, spawner));
+                            HPX_MOVE(state), spawner_type{});
                     }
                     else
                     {
                         this_->template run<Unwrap>(HPX_MOVE(state));
                     }
-                });
+                };
+
+                static_assert(sizeof(on_completed) <=
+                        hpx::util::detail::function_storage_size,
+                    "the completion handler should not require a separate "
+                    "allocation");
+
+                ptr->set_on_completed(HPX_MOVE(on_completed));
+            }
+            else
+            {
+                ptr->set_on_completed(
+                    [this_ = HPX_MOVE(this_), state = HPX_MOVE(state), is_async,
+                        is_adaptive, spawner = HPX_FORWARD(Spawner, spawner)]()
+                        mutable -> void {
+                        if (is_async ||
+                            (is_adaptive && !can_run_continuation_inline()))
+                        {
+                            this_->template async<Unwrap>(
+                                HPX_MOVE(state), HPX_MOVE(spawner));
+                        }
+                        else
+                        {
+                            this_->template run<Unwrap>(HPX_MOVE(state));
+                        }
+                    });
+            }
         }
 
     protected:
@@ -580,8 +625,7 @@ namespace hpx::lcos::detail {
     traits::detail::shared_state_ptr_t<future_unwrap_result_t<Future>> unwrap(
         Future&& future, error_code& ec)
     {
-        using allocator_type = hpx::util::thread_local_caching_allocator<
-            hpx::lockfree::variable_size_stack,
+        using allocator_type = hpx::util::thread_local_recycling_allocator<
             hpx::util::internal_allocator<>>;
         return unwrap_impl_alloc(
             allocator_type{}, HPX_FORWARD(Future, future), ec);
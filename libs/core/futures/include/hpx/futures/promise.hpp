@@ -40,7 +40,7 @@ namespace hpx {
 
         public:
             promise_base()
-              : shared_state_(new shared_state_type(init_no_addref{}), false)
+              : shared_state_(create_shared_state(), false)
               , future_retrieved_(false)
               , shared_future_retrieved_(false)
             {
@@ -48,28 +48,10 @@ namespace hpx {
 
             template <typename Allocator>
             promise_base(std::allocator_arg_t, Allocator const& a)
-              : shared_state_()
+              : shared_state_(create_shared_state(a), false)
               , future_retrieved_(false)
               , shared_future_retrieved_(false)
             {
-                using allocator_shared_state_type =
-                    traits::shared_state_allocator_t<SharedState, Allocator>;
-
-                using other_allocator =
-                    typename std::allocator_traits<Allocator>::
-                        template rebind_alloc<allocator_shared_state_type>;
-
-                using traits = std::allocator_traits<other_allocator>;
-                using unique_pointer =
-                    std::unique_ptr<allocator_shared_state_type,
-                        util::allocator_deleter<other_allocator>>;
-
-                other_allocator alloc(a);
-                unique_pointer p(traits::allocate(alloc, 1),
-                    util::allocator_deleter<other_allocator>{alloc});
-
-                traits::construct(alloc, p.get(), init_no_addref{}, alloc);
-                shared_state_.reset(p.release(), false);
             }
 
             promise_base(promise_base&& other) noexcept
@@ -218,6 +200,46 @@ namespace hpx {
                 }
             }
 
+            // plain shared states are recycled through a per-worker free
+            // list, derived shared states are allocated as usual
+            static shared_state_type* create_shared_state()
+            {
+                if constexpr (std::is_same_v<SharedState,
+                                  lcos::detail::future_data<R>>)
+                {
+                    return create_shared_state(
+                        hpx::util::thread_local_recycling_allocator<
+                            hpx::util::internal_allocator<>>{});
+                }
+                else
+                {
+                    return new shared_state_type(init_no_addref{});
+                }
+            }
+
+            template <typename Allocator>
+            static shared_state_type* create_shared_state(Allocator const& a)
+            {
+                using allocator_shared_state_type =
+                    traits::shared_state_allocator_t<SharedState, Allocator>;
+
+                using other_allocator =
+                    typename std::allocator_traits<Allocator>::
+                        template rebind_alloc<allocator_shared_state_type>;
+
+                using traits = std::allocator_traits<other_allocator>;
+                using unique_pointer =
+                    std::unique_ptr<allocator_shared_state_type,
+                        util::allocator_deleter<other_allocator>>;
+
+                other_allocator alloc(a);
+                unique_pointer p(traits::allocate(alloc, 1),
+                    util::allocator_deleter<other_allocator>{alloc});
+
+                traits::construct(alloc, p.get(), init_no_addref{}, alloc);
+                return p.release();
+            }
+
             hpx::intrusive_ptr<shared_state_type> shared_state_;
             bool future_retrieved_;
             bool shared_future_retrieved_;
@@ -17,6 +17,7 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/memory.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <exception>
 #include <mutex>
@@ -34,6 +35,52 @@ namespace hpx::lcos::detail {
         run_on_completed_error_handler = HPX_MOVE(f);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        std::atomic<std::size_t> continuation_inline_depth(
+            HPX_CONTINUATION_INLINE_DEPTH);
+    }    // namespace
+
+    void set_continuation_inline_depth(std::size_t depth) noexcept
+    {
+        continuation_inline_depth.store(depth, std::memory_order_relaxed);
+    }
+
+    std::size_t get_continuation_inline_depth() noexcept
+    {
+        return continuation_inline_depth.load(std::memory_order_relaxed);
+    }
+
+    bool can_run_continuation_inline() noexcept
+    {
+        // continuations triggered from outside of HPX threads are always run
+        // on a new thread
+        if (nullptr == hpx::threads::get_self_ptr())
+        {
+            return false;
+        }
+
+        // handle_on_completed has already accounted for the continuation
+        // that is about to run
+        std::size_t const depth = threads::get_continuation_recursion_count();
+        if (depth > get_continuation_inline_depth())
+        {
+            return false;
+        }
+
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+        // don't run inline on a stack that handle_on_completed would
+        // consider exhausted
+        return this_thread::has_sufficient_stack_space();
+#else
+        // running the continuation inline at the maximum depth would force
+        // handle_on_completed to run the next level on a new thread, which
+        // would block the current thread
+        return depth < HPX_CONTINUATION_MAX_RECURSION_DEPTH;
+#endif
+    }
+
     future_data_refcnt_base::~future_data_refcnt_base() = default;
 
     ///////////////////////////////////////////////////////////////////////////
@@ -259,11 +306,14 @@ namespace hpx::lcos::detail {
         handle_continuation_recursion_count cnt;
         if (is_hpx_thread)
         {
+            // the nesting depth is tracked in any case, it is used by
+            // continuations launched with launch::adaptive
+            [[maybe_unused]] std::size_t const depth = cnt.increment();
 #if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
             recurse_asynchronously = !this_thread::has_sufficient_stack_space();
 #else
             recurse_asynchronously =
-                cnt.increment() > HPX_CONTINUATION_MAX_RECURSION_DEPTH;
+                depth > HPX_CONTINUATION_MAX_RECURSION_DEPTH;
 #endif
         }
 
@@ -0,0 +1,214 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// the maximum number of nested continuations that can run inline regardless of
+// the configured depth
+#if defined(HPX_HAVE_THREADS_GET_STACK_POINTER)
+constexpr std::size_t max_inline_depth = static_cast<std::size_t>(-1);
+#else
+constexpr std::size_t max_inline_depth =
+    HPX_CONTINUATION_MAX_RECURSION_DEPTH - 1;
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void test_policy()
+{
+    std::cerr << "test_policy\n";
+
+    hpx::launch const policy = hpx::launch::adaptive;
+    HPX_TEST(policy == hpx::launch::adaptive);
+    HPX_TEST(hpx::has_adaptive_policy(policy));
+    HPX_TEST(hpx::has_adaptive_policy(hpx::launch::adaptive));
+
+    // the default policy of future::then is not adaptive
+    HPX_TEST(!hpx::has_adaptive_policy(hpx::launch()));
+    HPX_TEST(!hpx::has_adaptive_policy(hpx::launch::async));
+    HPX_TEST(!hpx::has_adaptive_policy(hpx::launch::sync));
+
+    // launch::all allows all launch modes, adaptive included
+    HPX_TEST(static_cast<int>(hpx::launch::all.policy()) &
+        static_cast<int>(hpx::launch_policy::adaptive));
+    HPX_TEST(!hpx::has_adaptive_policy(hpx::launch::all));
+
+    // used with hpx::async, launch::adaptive spawns a new thread
+    hpx::threads::thread_id_type const self = hpx::threads::get_self_id();
+    hpx::future<hpx::threads::thread_id_type> f = hpx::async(
+        hpx::launch::adaptive, []() { return hpx::threads::get_self_id(); });
+    HPX_TEST(f.get() != self);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_ready_future()
+{
+    std::cerr << "test_ready_future\n";
+
+    hpx::threads::thread_id_type const self = hpx::threads::get_self_id();
+    hpx::threads::thread_id_type ran_on;
+
+    // attaching to a ready future runs the continuation right away
+    hpx::future<int> f = hpx::make_ready_future(41).then(
+        hpx::launch::adaptive, [&](hpx::future<int>&& f) {
+            ran_on = hpx::threads::get_self_id();
+            return f.get() + 1;
+        });
+
+    if (max_inline_depth != 0)
+    {
+        HPX_TEST(f.is_ready());
+        HPX_TEST(ran_on == self);
+    }
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Attach a chain of continuations to a future that is made ready afterwards
+// and return the number of continuations that were run directly on the thread
+// that made the future ready.
+std::size_t run_chain(std::size_t length)
+{
+    hpx::threads::thread_id_type const self = hpx::threads::get_self_id();
+    std::vector<hpx::threads::thread_id_type> ran_on(length);
+
+    hpx::promise<std::size_t> p;
+    hpx::future<std::size_t> f = p.get_future();
+    for (std::size_t i = 0; i != length; ++i)
+    {
+        f = f.then(hpx::launch::adaptive,
+            [&, i](hpx::future<std::size_t>&& prev) {
+                ran_on[i] = hpx::threads::get_self_id();
+                return prev.get() + 1;
+            });
+    }
+
+    p.set_value(0);
+    HPX_TEST_EQ(f.get(), length);
+
+    // the continuations that were run inline have to be the first ones of
+    // the chain
+    std::size_t inlined = 0;
+    while (inlined != length && ran_on[inlined] == self)
+    {
+        ++inlined;
+    }
+    for (std::size_t i = inlined; i != length; ++i)
+    {
+        HPX_TEST(ran_on[i] != self);
+    }
+    return inlined;
+}
+
+void test_inline_depth()
+{
+    std::cerr << "test_inline_depth\n";
+
+    std::size_t const depth =
+        hpx::lcos::detail::get_continuation_inline_depth();
+
+    hpx::lcos::detail::set_continuation_inline_depth(4);
+    HPX_TEST_EQ(hpx::lcos::detail::get_continuation_inline_depth(),
+        static_cast<std::size_t>(4));
+
+    // the continuations beyond the configured depth spill to new threads
+    std::size_t const inlined = run_chain(12);
+    HPX_TEST(inlined <= 4);
+    if (max_inline_depth != 0)
+    {
+        HPX_TEST(inlined != 0);
+    }
+
+    // a depth of zero behaves like launch::async
+    hpx::lcos::detail::set_continuation_inline_depth(0);
+    HPX_TEST_EQ(run_chain(12), static_cast<std::size_t>(0));
+
+    hpx::lcos::detail::set_continuation_inline_depth(depth);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_long_chain()
+{
+    std::cerr << "test_long_chain\n";
+
+    // long chains must not run into stack overflows
+    std::size_t const inlined = run_chain(10000);
+    HPX_TEST(inlined <= hpx::lcos::detail::get_continuation_inline_depth());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_exception()
+{
+    std::cerr << "test_exception\n";
+
+    hpx::promise<int> p;
+    hpx::future<int> f =
+        p.get_future()
+            .then(hpx::launch::adaptive,
+                [](hpx::future<int>&& f) -> int {
+                    f.get();
+                    throw std::runtime_error("test_exception");
+                })
+            .then(hpx::launch::adaptive,
+                [](hpx::future<int>&& f) { return f.get() + 1; });
+
+    p.set_value(41);
+
+    bool caught_exception = false;
+    try
+    {
+        f.get();
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_unwrap()
+{
+    std::cerr << "test_unwrap\n";
+
+    // continuations returning a future are unwrapped as usual
+    hpx::future<int> f = hpx::make_ready_future(20).then(
+        hpx::launch::adaptive, [](hpx::future<int>&& f) {
+            return hpx::async([i = f.get()]() { return 2 * i + 2; });
+        });
+    HPX_TEST_EQ(f.get(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_policy();
+    test_ready_future();
+    test_inline_depth();
+    test_long_chain();
+    test_exception();
+    test_unwrap();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -50,8 +50,7 @@ namespace hpx::lcos::local {
         explicit base_and_gate(std::size_t count = 0)
           : received_segments_(count)
           , promise_(std::allocator_arg,
-                hpx::util::thread_local_caching_allocator<
-                    hpx::lockfree::variable_size_stack,
+                hpx::util::thread_local_recycling_allocator<
                     hpx::util::internal_allocator<>>{})
           , generation_(1)
         {
@@ -209,8 +208,7 @@ namespace hpx::lcos::local {
                 {
                     // we have received the last missing segment
                     using allocator_type =
-                        hpx::util::thread_local_caching_allocator<
-                            hpx::lockfree::variable_size_stack,
+                        hpx::util::thread_local_recycling_allocator<
                             hpx::util::internal_allocator<>>;
 
                     hpx::promise<void> p(std::allocator_arg, allocator_type{});
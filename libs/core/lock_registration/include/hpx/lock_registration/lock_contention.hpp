@@ -0,0 +1,207 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file lock_contention.hpp
+/// \brief Measure how often and for how long locks had to be waited for.
+///
+/// If HPX was configured with HPX_WITH_LOCK_CONTENTION_PROFILING=ON, the locks
+/// provided by HPX (hpx::spinlock, hpx::util::spinlock, hpx::spinlock_pool,
+/// hpx::mutex, and hpx::shared_mutex) report every acquisition through
+/// lock() while the profiling is active. The acquisitions are attributed to
+/// lock sites, i.e. the code addresses the locks were acquired from, and are
+/// counted in tables private to the acquiring OS thread. The tables of all
+/// threads are combined only when the data is queried.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+#include <atomic>
+
+#if defined(HPX_MSVC)
+#include <intrin.h>
+#endif
+#endif
+
+// The lock site of an acquisition through a lock function which is not
+// inlined is the address the lock function returns to.
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING) && defined(HPX_MSVC)
+#define HPX_LOCK_CONTENTION_CALLER() _ReturnAddress()
+#elif defined(HPX_HAVE_LOCK_CONTENTION_PROFILING) && defined(__GNUC__)
+#define HPX_LOCK_CONTENTION_CALLER() __builtin_return_address(0)
+#else
+#define HPX_LOCK_CONTENTION_CALLER() nullptr
+#endif
+
+namespace hpx::util {
+
+    /// The quantities recorded for every lock site.
+    HPX_CXX_CORE_EXPORT enum class lock_contention_kind : std::uint8_t
+    {
+        /// the number of times a lock was acquired
+        acquisitions = 0,
+
+        /// the number of acquisitions which had to wait for the lock
+        contended = 1,
+
+        /// the overall time (in nanoseconds) spent waiting for the lock
+        wait_time = 2
+    };
+
+    /// The data recorded for one lock site.
+    HPX_CXX_CORE_EXPORT struct lock_contention_site
+    {
+        /// the code address the lock was acquired from, nullptr for the
+        /// sites which did not fit into the tables of the OS threads
+        void const* site = nullptr;
+
+        /// the symbolized lock site (function+offset if available)
+        std::string name;
+
+        std::uint64_t acquisitions = 0;
+        std::uint64_t contended = 0;
+        std::int64_t wait_time = 0;
+        std::int64_t max_wait_time = 0;
+    };
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+    namespace detail {
+
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT extern std::atomic<bool>
+            lock_contention_enabled;
+
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::int64_t
+        lock_contention_now() noexcept;
+
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void record_lock_acquisition_at(
+            void const* site, std::int64_t wait_start) noexcept;
+
+        // The lock site is the address this function returns to. This
+        // function is called from the (inlined) lock functions, which places
+        // the lock site into the code acquiring the lock.
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT HPX_NOINLINE void
+        record_lock_acquisition(std::int64_t wait_start) noexcept;
+    }    // namespace detail
+
+    /// Return whether lock acquisitions are currently being recorded.
+    HPX_CXX_CORE_EXPORT inline bool lock_contention_profiling_enabled() noexcept
+    {
+        return detail::lock_contention_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Called by a lock function as soon as it has to wait for the lock,
+    /// returns the point in time the waiting started (zero if lock
+    /// acquisitions are not being recorded).
+    HPX_CXX_CORE_EXPORT HPX_FORCEINLINE std::int64_t
+    lock_contention_start() noexcept
+    {
+        return lock_contention_profiling_enabled() ?
+            detail::lock_contention_now() :
+            0;
+    }
+
+    /// Called by an inlined lock function once the lock was acquired,
+    /// \a wait_start is the value returned by lock_contention_start() or zero
+    /// if the lock was acquired without waiting.
+    HPX_CXX_CORE_EXPORT HPX_FORCEINLINE void record_lock_acquisition(
+        std::int64_t wait_start) noexcept
+    {
+        if (lock_contention_profiling_enabled())
+        {
+            detail::record_lock_acquisition(wait_start);
+        }
+    }
+
+    /// Same as above for lock functions which are not inlined, \a site should
+    /// be HPX_LOCK_CONTENTION_CALLER().
+    HPX_CXX_CORE_EXPORT HPX_FORCEINLINE void record_lock_acquisition(
+        void const* site, std::int64_t wait_start) noexcept
+    {
+        if (lock_contention_profiling_enabled())
+        {
+            detail::record_lock_acquisition_at(site, wait_start);
+        }
+    }
+
+    /// Start recording lock acquisitions. If \a report is not empty, a report
+    /// listing the \a max_sites lock sites with the longest overall wait time
+    /// (zero: all) is written to it when the profiling is stopped. \a report
+    /// is either 'cout', 'cerr', or the name of a file.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT bool start_lock_contention_profiling(
+        std::string const& report = "", std::size_t max_sites = 20);
+
+    /// Stop recording lock acquisitions and write the report, if requested.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void stop_lock_contention_profiling();
+
+    /// Return the data recorded for all lock sites, sorted by decreasing
+    /// overall wait time. The data is shared by all readers and is never
+    /// reset.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::vector<lock_contention_site>
+    get_lock_contention_sites();
+
+    /// Return the given quantity summed over all lock sites.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::int64_t get_lock_contention_total(
+        lock_contention_kind kind);
+
+    /// Print the \a max_sites lock sites with the longest overall wait time
+    /// (zero: all).
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void print_lock_contention_report(
+        std::ostream& os, std::size_t max_sites = 20);
+#else
+    HPX_CXX_CORE_EXPORT constexpr bool
+    lock_contention_profiling_enabled() noexcept
+    {
+        return false;
+    }
+
+    HPX_CXX_CORE_EXPORT constexpr std::int64_t lock_contention_start() noexcept
+    {
+        return 0;
+    }
+
+    HPX_CXX_CORE_EXPORT constexpr void record_lock_acquisition(
+        std::int64_t) noexcept
+    {
+    }
+
+    HPX_CXX_CORE_EXPORT constexpr void record_lock_acquisition(
+        void const*, std::int64_t) noexcept
+    {
+    }
+
+    HPX_CXX_CORE_EXPORT inline bool start_lock_contention_profiling(
+        std::string const& = "", std::size_t = 20)
+    {
+        return false;
+    }
+
+    HPX_CXX_CORE_EXPORT inline void stop_lock_contention_profiling() {}
+
+    HPX_CXX_CORE_EXPORT inline std::vector<lock_contention_site>
+    get_lock_contention_sites()
+    {
+        return {};
+    }
+
+    HPX_CXX_CORE_EXPORT constexpr std::int64_t get_lock_contention_total(
+        lock_contention_kind) noexcept
+    {
+        return 0;
+    }
+
+    HPX_CXX_CORE_EXPORT inline void print_lock_contention_report(
+        std::ostream&, std::size_t = 20)
+    {
+    }
+#endif
+}    // namespace hpx::util
@@ -0,0 +1,446 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+#include <hpx/lock_registration/lock_contention.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux) || defined(__APPLE__)
+#include <dlfcn.h>
+#define HPX_LOCK_CONTENTION_HAVE_DLADDR
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#define HPX_LOCK_CONTENTION_HAVE_DEMANGLE
+#endif
+#endif
+
+namespace hpx::util {
+
+    namespace detail {
+
+        std::atomic<bool> lock_contention_enabled(false);
+    }    // namespace detail
+
+    namespace {
+
+        // The counters of one lock site. They are updated by the OS thread
+        // owning the table only, but are read by the queries.
+        struct site_data
+        {
+            std::atomic<void const*> site{nullptr};
+            std::atomic<std::uint64_t> acquisitions{0};
+            std::atomic<std::uint64_t> contended{0};
+            std::atomic<std::int64_t> wait_time{0};
+            std::atomic<std::int64_t> max_wait_time{0};
+        };
+
+        constexpr std::size_t table_size_log2 = 10;
+        constexpr std::size_t table_size = std::size_t(1) << table_size_log2;
+        constexpr std::size_t max_probes = 16;
+
+        // The lock sites seen by one OS thread, an open addressing hash table
+        // keyed by the lock site. Tables are never freed, the table of an
+        // exiting thread is handed to the next new thread instead.
+        struct site_table
+        {
+            std::array<site_data, table_size> sites;
+
+            // collects the sites which did not fit into the table
+            site_data overflow;
+
+            std::atomic<bool> in_use{false};
+        };
+
+        struct lock_contention_registry
+        {
+            site_table* acquire_table()
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                for (auto const& table : tables_)
+                {
+                    bool expected = false;
+                    if (table->in_use.compare_exchange_strong(expected, true))
+                    {
+                        return table.get();
+                    }
+                }
+
+                tables_.push_back(std::make_unique<site_table>());
+                tables_.back()->in_use.store(true);
+                return tables_.back().get();
+            }
+
+            template <typename F>
+            void for_each_site(F&& f)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                for (auto const& table : tables_)
+                {
+                    for (site_data& data : table->sites)
+                    {
+                        if (data.site.load(std::memory_order_acquire) !=
+                            nullptr)
+                        {
+                            f(data);
+                        }
+                    }
+                    f(table->overflow);
+                }
+            }
+
+            std::mutex mtx_;
+            std::vector<std::unique_ptr<site_table>> tables_;
+
+            // where to write the report when the profiling is stopped
+            std::string report_;
+            std::size_t max_sites_ = 20;
+        };
+
+        // The registry is intentionally leaked, OS threads may record lock
+        // acquisitions while the static objects are being destroyed.
+        lock_contention_registry& get_registry()
+        {
+            static lock_contention_registry* registry =
+                new lock_contention_registry;
+            return *registry;
+        }
+
+        // The table of the calling OS thread, released on thread exit.
+        struct thread_table
+        {
+            thread_table() = default;
+
+            thread_table(thread_table const&) = delete;
+            thread_table(thread_table&&) = delete;
+            thread_table& operator=(thread_table const&) = delete;
+            thread_table& operator=(thread_table&&) = delete;
+
+            ~thread_table()
+            {
+                if (table != nullptr)
+                {
+                    table->in_use.store(false, std::memory_order_release);
+                }
+            }
+
+            site_table* table = nullptr;
+        };
+
+        thread_local thread_table current_table;
+
+        site_data& find_site(site_table& table, void const* site) noexcept
+        {
+            if (site == nullptr)
+            {
+                return table.overflow;
+            }
+
+            // Fibonacci hashing of the code address
+            std::size_t index = static_cast<std::size_t>(
+                (static_cast<std::uint64_t>(
+                     reinterpret_cast<std::uintptr_t>(site)) *
+                    0x9e3779b97f4a7c15ULL) >>
+                (64 - table_size_log2));
+
+            for (std::size_t i = 0; i != max_probes; ++i)
+            {
+                site_data& data = table.sites[index];
+                void const* current =
+                    data.site.load(std::memory_order_relaxed);
+                if (current == site)
+                {
+                    return data;
+                }
+                if (current == nullptr)
+                {
+                    // only the owning thread inserts new sites
+                    data.site.store(site, std::memory_order_release);
+                    return data;
+                }
+                index = (index + 1) & (table_size - 1);
+            }
+            return table.overflow;
+        }
+
+        void record(void const* site, std::int64_t wait_start) noexcept
+        {
+            thread_table& current = current_table;
+            if (current.table == nullptr)
+            {
+                try
+                {
+                    current.table = get_registry().acquire_table();
+                }
+                catch (...)
+                {
+                    return;
+                }
+            }
+
+            site_data& data = find_site(*current.table, site);
+            data.acquisitions.fetch_add(1, std::memory_order_relaxed);
+
+            if (wait_start != 0)
+            {
+                std::int64_t const wait =
+                    detail::lock_contention_now() - wait_start;
+
+                data.contended.fetch_add(1, std::memory_order_relaxed);
+                data.wait_time.fetch_add(wait, std::memory_order_relaxed);
+
+                std::int64_t max_wait =
+                    data.max_wait_time.load(std::memory_order_relaxed);
+                while (wait > max_wait &&
+                    !data.max_wait_time.compare_exchange_weak(
+                        max_wait, wait, std::memory_order_relaxed))
+                {
+                }
+            }
+        }
+
+        template <typename T>
+        T read(std::atomic<T> const& value) noexcept
+        {
+            return value.load(std::memory_order_relaxed);
+        }
+
+        // Lock sites are return addresses, they point behind the call
+        // instruction and are adjusted to refer to the call itself.
+        std::string symbolize(void const* site)
+        {
+            if (site == nullptr)
+            {
+                return "<other>";
+            }
+
+            auto const address = reinterpret_cast<std::uintptr_t>(site) - 1;
+
+            char buffer[64];
+#if defined(HPX_LOCK_CONTENTION_HAVE_DLADDR)
+            Dl_info info;
+            if (dladdr(reinterpret_cast<void*>(address), &info) != 0 &&
+                info.dli_sname != nullptr)
+            {
+                std::string name;
+#if defined(HPX_LOCK_CONTENTION_HAVE_DEMANGLE)
+                int status = 0;
+                char* demangled = abi::__cxa_demangle(
+                    info.dli_sname, nullptr, nullptr, &status);
+                name = status == 0 ? demangled : info.dli_sname;
+                std::free(demangled);
+#else
+                name = info.dli_sname;
+#endif
+                std::snprintf(buffer, sizeof(buffer), "+0x%zx",
+                    static_cast<std::size_t>(address + 1 -
+                        reinterpret_cast<std::uintptr_t>(info.dli_saddr)));
+                return name + buffer;
+            }
+#endif
+            std::snprintf(buffer, sizeof(buffer), "0x%zx",
+                static_cast<std::size_t>(address + 1));
+            return buffer;
+        }
+    }    // namespace
+
+    namespace detail {
+
+        std::int64_t lock_contention_now() noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+
+        void record_lock_acquisition_at(
+            void const* site, std::int64_t wait_start) noexcept
+        {
+            record(site, wait_start);
+        }
+
+        HPX_NOINLINE void record_lock_acquisition(
+            std::int64_t wait_start) noexcept
+        {
+            record(HPX_LOCK_CONTENTION_CALLER(), wait_start);
+        }
+    }    // namespace detail
+
+    bool start_lock_contention_profiling(
+        std::string const& report, std::size_t max_sites)
+    {
+        auto& registry = get_registry();
+        {
+            std::lock_guard<std::mutex> l(registry.mtx_);
+            registry.report_ = report;
+            registry.max_sites_ = max_sites;
+        }
+
+        detail::lock_contention_enabled.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    void stop_lock_contention_profiling()
+    {
+        if (!detail::lock_contention_enabled.exchange(false))
+        {
+            return;
+        }
+
+        auto& registry = get_registry();
+        std::string report;
+        std::size_t max_sites = 0;
+        {
+            std::lock_guard<std::mutex> l(registry.mtx_);
+            report = std::move(registry.report_);
+            registry.report_.clear();
+            max_sites = registry.max_sites_;
+        }
+
+        if (report.empty())
+        {
+            return;
+        }
+
+        if (report == "cout")
+        {
+            print_lock_contention_report(std::cout, max_sites);
+        }
+        else if (report == "cerr")
+        {
+            print_lock_contention_report(std::cerr, max_sites);
+        }
+        else
+        {
+            std::ofstream out(report);
+            if (!out)
+            {
+                std::cerr << "stop_lock_contention_profiling: could not open "
+                             "lock contention report file: "
+                          << report << "\n";
+                return;
+            }
+            print_lock_contention_report(out, max_sites);
+        }
+    }
+
+    std::vector<lock_contention_site> get_lock_contention_sites()
+    {
+        // the same site is usually recorded by several OS threads
+        std::unordered_map<void const*, lock_contention_site> sites;
+        get_registry().for_each_site([&](site_data& data) {
+            void const* site = data.site.load(std::memory_order_relaxed);
+
+            lock_contention_site& s = sites[site];
+            s.site = site;
+            s.acquisitions += read(data.acquisitions);
+            s.contended += read(data.contended);
+            s.wait_time += read(data.wait_time);
+            s.max_wait_time =
+                (std::max) (s.max_wait_time, read(data.max_wait_time));
+        });
+
+        std::vector<lock_contention_site> result;
+        result.reserve(sites.size());
+        for (auto& site : sites)
+        {
+            if (site.second.acquisitions != 0)
+            {
+                site.second.name = symbolize(site.first);
+                result.push_back(HPX_MOVE(site.second));
+            }
+        }
+
+        std::sort(result.begin(), result.end(),
+            [](lock_contention_site const& lhs,
+                lock_contention_site const& rhs) {
+                if (lhs.wait_time != rhs.wait_time)
+                {
+                    return lhs.wait_time > rhs.wait_time;
+                }
+                return lhs.acquisitions > rhs.acquisitions;
+            });
+        return result;
+    }
+
+    std::int64_t get_lock_contention_total(lock_contention_kind kind)
+    {
+        std::int64_t result = 0;
+        get_registry().for_each_site([&](site_data& data) {
+            switch (kind)
+            {
+            case lock_contention_kind::acquisitions:
+                result += static_cast<std::int64_t>(read(data.acquisitions));
+                break;
+
+            case lock_contention_kind::contended:
+                result += static_cast<std::int64_t>(read(data.contended));
+                break;
+
+            case lock_contention_kind::wait_time:
+                result += read(data.wait_time);
+                break;
+            }
+        });
+        return result;
+    }
+
+    void print_lock_contention_report(std::ostream& os, std::size_t max_sites)
+    {
+        std::vector<lock_contention_site> const sites =
+            get_lock_contention_sites();
+
+        lock_contention_site total;
+        for (auto const& site : sites)
+        {
+            total.acquisitions += site.acquisitions;
+            total.contended += site.contended;
+            total.wait_time += site.wait_time;
+        }
+
+        os << "lock contention: " << total.acquisitions << " acquisitions, "
+           << total.contended << " contended, " << total.wait_time
+           << " [ns] waited at " << sites.size() << " lock sites\n";
+
+        os << std::setw(14) << "wait [ns]" << std::setw(14) << "max [ns]"
+           << std::setw(12) << "contended" << std::setw(14) << "acquisitions"
+           << "  site\n";
+
+        std::size_t const count = max_sites == 0 ?
+            sites.size() :
+            (std::min) (max_sites, sites.size());
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            lock_contention_site const& site = sites[i];
+            os << std::setw(14) << site.wait_time << std::setw(14)
+               << site.max_wait_time << std::setw(12) << site.contended
+               << std::setw(14) << site.acquisitions << "  " << site.name
+               << "\n";
+        }
+        os << std::flush;
+    }
+}    // namespace hpx::util
+
+#endif
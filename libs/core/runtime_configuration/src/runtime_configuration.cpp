@@ -177,6 +177,9 @@ namespace hpx::util {
                 HPX_PP_EXPAND(HPX_IDLE_BACKOFF_TIME_MAX)) "}",
 #endif
             "default_scheduler_mode = ${HPX_DEFAULT_SCHEDULER_MODE}",
+            "continuation_inline_depth = "
+            "${HPX_CONTINUATION_INLINE_DEPTH:" HPX_PP_STRINGIZE(
+                HPX_PP_EXPAND(HPX_CONTINUATION_INLINE_DEPTH)) "}",
 
         /// If HPX_HAVE_ATTACH_DEBUGGER_ON_TEST_FAILURE is set,
         /// then apply the test-failure value as default.
@@ -206,6 +209,25 @@ namespace hpx::util {
             "enable = 1",
 #endif
 
+            // built-in task trace recorder, disabled if no file is given
+            "[hpx.task_trace]",
+            "file = ${HPX_TASK_TRACE_FILE}",
+            "buffer_size = ${HPX_TASK_TRACE_BUFFER_SIZE:65536}",
+            "flush_interval = ${HPX_TASK_TRACE_FLUSH_INTERVAL:100}",
+
+            // built-in sampling profiler, disabled if no file is given
+            "[hpx.sampling_profiler]",
+            "file = ${HPX_SAMPLING_PROFILER_FILE}",
+            "frequency = ${HPX_SAMPLING_PROFILER_FREQUENCY:100}",
+            "per_task = ${HPX_SAMPLING_PROFILER_PER_TASK:0}",
+
+            // lock contention profiling, requires
+            // HPX_WITH_LOCK_CONTENTION_PROFILING=ON
+            "[hpx.lock_contention]",
+            "enabled = ${HPX_LOCK_CONTENTION_ENABLED:0}",
+            "report = ${HPX_LOCK_CONTENTION_REPORT}",
+            "max_sites = ${HPX_LOCK_CONTENTION_MAX_SITES:20}",
+
             "[hpx.stacks]",
             "small_size = ${HPX_SMALL_STACK_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_SMALL_STACK_SIZE)) "}",
@@ -407,6 +407,25 @@ namespace hpx {
         void init_global_data();
         static void deinit_global_data();
 
+        // start and stop the built-in task trace recorder as configured by
+        // hpx.task_trace.file (does nothing if no file name is given)
+        void start_task_trace(
+            std::uint32_t locality_id = 0, std::uint32_t num_localities = 1);
+        static void stop_task_trace();
+
+        // start and stop the built-in sampling profiler as configured by
+        // hpx.sampling_profiler.file (does nothing if no file name is given)
+        void start_sampling_profiler(
+            std::uint32_t locality_id = 0, std::uint32_t num_localities = 1);
+        static void stop_sampling_profiler();
+
+        // start and stop recording the lock contention as configured by
+        // hpx.lock_contention.* (does nothing if neither enabled nor a report
+        // destination is given)
+        void start_lock_contention_profiling(
+            std::uint32_t locality_id = 0, std::uint32_t num_localities = 1);
+        static void stop_lock_contention_profiling();
+
         threads::thread_result_type run_helper(
             hpx::function<runtime::hpx_main_function_type> const& func,
             int& result, bool call_startup_functions,
@@ -16,6 +16,7 @@
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/io_service.hpp>
+#include <hpx/modules/lock_registration.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/static_reinit.hpp>
 #include <hpx/modules/synchronization.hpp>
@@ -24,6 +25,7 @@
 #include <hpx/modules/threadmanager.hpp>
 #include <hpx/modules/timing.hpp>
 #include <hpx/modules/topology.hpp>
+#include <hpx/modules/tracing.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/modules/util.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
@@ -639,6 +641,123 @@ namespace hpx {
         runtime_ = nullptr;
     }
 
+    void runtime::start_task_trace(
+        std::uint32_t locality_id, std::uint32_t num_localities)
+    {
+        std::string filename = hpx::util::get_entry_as<std::string>(
+            get_config(), "hpx.task_trace.file", "");
+        if (filename.empty())
+        {
+            return;
+        }
+
+        // every locality writes its own trace file
+        if (num_localities > 1)
+        {
+            filename += "." + std::to_string(locality_id);
+        }
+
+        auto const buffer_size = hpx::util::get_entry_as<std::size_t>(
+            get_config(), "hpx.task_trace.buffer_size", 65536);
+        auto const flush_interval = hpx::util::get_entry_as<std::size_t>(
+            get_config(), "hpx.task_trace.flush_interval", 100);
+
+        if (!hpx::tracing::start_task_trace(
+                filename, buffer_size, flush_interval))
+        {
+#if defined(HPX_HAVE_TASK_TRACE)
+            std::cerr << "runtime::start_task_trace: could not open task "
+                         "trace file: "
+                      << filename << "\n";
+#else
+            std::cerr << "runtime::start_task_trace: the task trace recorder "
+                         "is not available, reconfigure HPX with "
+                         "HPX_WITH_TASK_TRACE=ON\n";
+#endif
+        }
+    }
+
+    void runtime::stop_task_trace()
+    {
+        hpx::tracing::stop_task_trace();
+    }
+
+    void runtime::start_sampling_profiler(
+        std::uint32_t locality_id, std::uint32_t num_localities)
+    {
+        std::string filename = hpx::util::get_entry_as<std::string>(
+            get_config(), "hpx.sampling_profiler.file", "");
+        if (filename.empty())
+        {
+            return;
+        }
+
+        // every locality writes its own profile
+        if (num_localities > 1)
+        {
+            filename += "." + std::to_string(locality_id);
+        }
+
+        auto const frequency = hpx::util::get_entry_as<std::size_t>(
+            get_config(), "hpx.sampling_profiler.frequency", 100);
+        auto const per_task = hpx::util::get_entry_as<int>(
+            get_config(), "hpx.sampling_profiler.per_task", 0);
+
+        if (!hpx::tracing::start_sampling_profiler(
+                filename, frequency, per_task != 0))
+        {
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+            std::cerr << "runtime::start_sampling_profiler: could not open "
+                         "profile file: "
+                      << filename << "\n";
+#else
+            std::cerr << "runtime::start_sampling_profiler: the sampling "
+                         "profiler is not available, reconfigure HPX with "
+                         "HPX_WITH_SAMPLING_PROFILER=ON\n";
+#endif
+        }
+    }
+
+    void runtime::stop_sampling_profiler()
+    {
+        hpx::tracing::stop_sampling_profiler();
+    }
+
+    void runtime::start_lock_contention_profiling(
+        std::uint32_t locality_id, std::uint32_t num_localities)
+    {
+        std::string report = hpx::util::get_entry_as<std::string>(
+            get_config(), "hpx.lock_contention.report", "");
+        auto const enabled = hpx::util::get_entry_as<int>(
+            get_config(), "hpx.lock_contention.enabled", 0);
+        if (report.empty() && enabled == 0)
+        {
+            return;
+        }
+
+        // every locality writes its own report file
+        if (num_localities > 1 && !report.empty() && report != "cout" &&
+            report != "cerr")
+        {
+            report += "." + std::to_string(locality_id);
+        }
+
+        auto const max_sites = hpx::util::get_entry_as<std::size_t>(
+            get_config(), "hpx.lock_contention.max_sites", 20);
+
+        if (!hpx::util::start_lock_contention_profiling(report, max_sites))
+        {
+            std::cerr << "runtime::start_lock_contention_profiling: the lock "
+                         "contention profiling is not available, reconfigure "
+                         "HPX with HPX_WITH_LOCK_CONTENTION_PROFILING=ON\n";
+        }
+    }
+
+    void runtime::stop_lock_contention_profiling()
+    {
+        hpx::util::stop_lock_contention_profiling();
+    }
+
     std::uint64_t runtime::get_system_uptime()
     {
         auto const diff = static_cast<std::int64_t>(
@@ -1502,6 +1621,9 @@ namespace hpx {
 #ifdef HPX_HAVE_APEX
         util::external_timer::init(nullptr, 0, 1);
 #endif
+        start_task_trace();
+        start_sampling_profiler();
+        start_lock_contention_profiling();
 
         LRT_(info).format("cmd_line: {}", get_config().get_cmd_line());
 
@@ -1714,6 +1836,10 @@ namespace hpx {
             io_pool_->clear();
         }
 #endif
+
+        stop_lock_contention_profiling();
+        stop_sampling_profiler();
+        stop_task_trace();
     }
 
     // Second step in termination: shut down all services. This gets executed as
@@ -15,7 +15,12 @@
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/threading_base.hpp>
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS) ||                            \
+    defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+#include <hpx/modules/timing.hpp>
+#endif
 #include <hpx/modules/topology.hpp>
+#include <hpx/modules/tracing.hpp>
 #include <hpx/schedulers/deadlock_detection.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/thread_queue.hpp>
@@ -710,18 +715,46 @@ namespace hpx::threads::policies {
             return false;
         }
 
+        // Count an attempt of the given worker thread to steal from the
+        // queues of the given victim, by the NUMA domain of the victim.
+        void record_steal_attempt([[maybe_unused]] std::size_t num_thread,
+            [[maybe_unused]] std::size_t victim,
+            [[maybe_unused]] bool success) noexcept
+        {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            this->get_steal_statistics(num_thread).record_attempt(
+                thread_numa_domain_[victim], success);
+#endif
+        }
+
         bool attempt_stealing_pending(std::size_t num_thread,
             threads::thread_id_ref_type& thrd,
             [[maybe_unused]] thread_queue_type* this_high_priority_queue,
             [[maybe_unused]] thread_queue_type* this_queue)
         {
-            // Helper to increment steal counters only when enabled.
-            constexpr auto increment_counters =
-                []([[maybe_unused]] thread_queue_type* from_q,
-                    [[maybe_unused]] thread_queue_type* to_q) noexcept {
+            // Helper to increment steal counters and to record the steal
+            // event only when enabled.
+            auto const on_stolen =
+                [&]([[maybe_unused]] thread_queue_type* from_q,
+                    [[maybe_unused]] thread_queue_type* to_q,
+                    [[maybe_unused]] std::size_t idx) noexcept {
 #ifdef HPX_HAVE_THREAD_STEALING_COUNTS
                     from_q->increment_num_stolen_from_pending();
                     to_q->increment_num_stolen_to_pending();
+#endif
+#if defined(HPX_HAVE_TASK_TRACE)
+                    hpx::tracing::record_task_event(
+                        hpx::tracing::task_trace_event::steal, num_thread,
+                        reinterpret_cast<std::uint64_t>(
+                            get_thread_id_data(thrd)),
+                        idx);
+#endif
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+                    this->get_latency_histogram(
+                            latency_histogram_kind::steal, num_thread)
+                        .record(static_cast<std::int64_t>(
+                            hpx::chrono::high_resolution_clock::now() -
+                            get_thread_id_data(thrd)->get_ready_time()));
 #endif
                 };
 
@@ -737,9 +770,11 @@ namespace hpx::threads::policies {
                 if (thread_queue_type* q = queues_[idx].data_;
                     q->get_next_thread(thrd, true, true))
                 {
-                    increment_counters(q, this_queue);
+                    on_stolen(q, this_queue, idx);
+                    record_steal_attempt(num_thread, idx, true);
                     return true;
                 }
+                record_steal_attempt(num_thread, idx, false);
                 return false;
             };
 
@@ -752,7 +787,8 @@ namespace hpx::threads::policies {
                     if (thread_queue_type* q = high_priority_queues_[idx].data_;
                         q->get_next_thread(thrd, true, true))
                     {
-                        increment_counters(q, this_high_priority_queue);
+                        on_stolen(q, this_high_priority_queue, idx);
+                        record_steal_attempt(num_thread, idx, true);
                         return true;
                     }
                 }
@@ -872,11 +908,23 @@ namespace hpx::threads::policies {
             // Attempt stealing from other queues if enabled. If stealing
             // succeeds, attempt_stealing_pending returns true, and we return
             // true (thread obtained).
-            if (enable_stealing &&
-                attempt_stealing_pending(
-                    num_thread, thrd, this_high_priority_queue, this_queue))
+            if (enable_stealing)
             {
-                return true;
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                std::uint64_t const steal_start =
+                    hpx::chrono::high_resolution_clock::now();
+#endif
+                if (attempt_stealing_pending(
+                        num_thread, thrd, this_high_priority_queue, this_queue))
+                {
+                    return true;
+                }
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                this->get_steal_statistics(num_thread)
+                    .record_failed_steal_time(static_cast<std::int64_t>(
+                        hpx::chrono::high_resolution_clock::now() -
+                        steal_start));
+#endif
             }
 
             // Final fallback: try the global low-priority queue
@@ -1447,8 +1495,10 @@ namespace hpx::threads::policies {
                 if (0 != added)
                 {
                     increment_counters(q, this_queue);
+                    record_steal_attempt(num_thread, idx, true);
                     return true;
                 }
+                record_steal_attempt(num_thread, idx, false);
                 return false;
             };
 
@@ -1469,6 +1519,7 @@ namespace hpx::threads::policies {
                     if (0 != added)
                     {
                         increment_counters(q, this_high_priority_queue);
+                        record_steal_attempt(num_thread, idx, true);
                         return true;
                     }
                 }
@@ -1584,11 +1635,21 @@ namespace hpx::threads::policies {
 
             if (enable_stealing)
             {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                std::uint64_t const steal_start =
+                    hpx::chrono::high_resolution_clock::now();
+#endif
                 result = attempt_stealing(num_thread, added,
                              this_high_priority_queue, this_queue) &&
                     result;
                 if (0 != added)
                     return result;
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                this->get_steal_statistics(num_thread)
+                    .record_failed_steal_time(static_cast<std::int64_t>(
+                        hpx::chrono::high_resolution_clock::now() -
+                        steal_start));
+#endif
             }
 
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
@@ -1671,6 +1732,10 @@ namespace hpx::threads::policies {
             // Record this thread's NUMA domain for use in create_thread().
             thread_numa_domain_[num_thread] =
                 static_cast<std::size_t>(numa_domains[num_thread]);
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            this->get_steal_statistics(num_thread).set_numa_domain(
+                thread_numa_domain_[num_thread]);
+#endif
 
             std::size_t const num_pu = affinity_data_.get_pu_num(num_thread);
             mask_cref_type pu_mask = topo.get_thread_affinity_mask(num_pu);
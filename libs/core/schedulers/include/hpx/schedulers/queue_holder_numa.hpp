@@ -76,11 +76,12 @@ namespace hpx::threads::policies {
         // ----------------------------------------------------------------
         inline bool get_next_thread_HP(std::size_t qidx,
             threads::thread_id_ref_type& thrd, bool stealing,
-            bool core_stealing)
+            bool core_stealing, std::size_t first = 0)
         {
-            // loop over queues and take one task,
-            std::size_t q = qidx;
-            for (std::size_t i = 0; i < num_queues_;
+            // loop over queues and take one task, skipping the first queues
+            // if requested
+            std::size_t q = fast_mod(qidx + first, num_queues_);
+            for (std::size_t i = first; i < num_queues_;
                 ++i, q = fast_mod((qidx + i), num_queues_))
             {
                 if (queues_[q]->get_next_thread_HP(
@@ -108,12 +109,12 @@ namespace hpx::threads::policies {
         // ----------------------------------------------------------------
         inline bool get_next_thread(std::size_t qidx,
             threads::thread_id_ref_type& thrd, bool stealing,
-            bool core_stealing)
+            bool core_stealing, std::size_t first = 0)
         {
             // loop over queues and take one task, starting with the requested
-            // queue
-            std::size_t q = qidx;
-            for (std::size_t i = 0; i < num_queues_;
+            // queue (or the given number of queues after it)
+            std::size_t q = fast_mod(qidx + first, num_queues_);
+            for (std::size_t i = first; i < num_queues_;
                 ++i, q = fast_mod((qidx + i), num_queues_))
             {
                 // if we got a thread, return it, only allow stealing if i>0
@@ -16,6 +16,9 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/threading_base.hpp>
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+#include <hpx/modules/timing.hpp>
+#endif
 #include <hpx/modules/topology.hpp>
 #include <hpx/schedulers/lockfree_queue_backends.hpp>
 #include <hpx/schedulers/macros.hpp>
@@ -456,6 +459,22 @@ namespace hpx::threads::policies {
                 ->create_thread(data, thrd, local_num, ec);
         }
 
+        // Count an attempt of the given worker thread to steal from a queue of
+        // the given NUMA domain, passes the result of the attempt through.
+        bool record_steal_attempt([[maybe_unused]] std::size_t thread_num,
+            [[maybe_unused]] std::size_t domain,
+            [[maybe_unused]] bool stealing, bool result) noexcept
+        {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            if (stealing)
+            {
+                this->get_steal_statistics(thread_num).record_attempt(
+                    domain, result);
+            }
+#endif
+            return result;
+        }
+
         template <typename T>
         bool steal_by_function(std::size_t domain, std::size_t q_index,
             bool steal_numa, bool steal_core, thread_holder_type* origin,
@@ -610,13 +629,47 @@ namespace hpx::threads::policies {
 
             spq_deb.timed(getnext, debug::dec<>(thread_num));
 
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            // the time spent searching the queues of other worker threads is
+            // measured from the first visit of such a queue
+            std::uint64_t steal_start = 0;
+#endif
+            auto start_stealing = [&]() noexcept {
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+                if (steal_start == 0)
+                {
+                    steal_start = hpx::chrono::high_resolution_clock::now();
+                }
+#endif
+            };
+
+            // The queue holders visit the queue of this thread first and then
+            // those of the other cores of the domain. Split these searches to
+            // start the steal timer only after the local queue was found empty.
             auto get_next_thread_function_HP =
                 [&](std::size_t domain, std::size_t q_index,
                     thread_holder_type* /* receiver */,
                     threads::thread_id_ref_type& th, bool stealing,
                     bool allow_stealing) {
-                    return numa_holder_[domain].get_next_thread_HP(
-                        q_index, th, stealing, allow_stealing);
+                    auto& holder = numa_holder_[domain];
+                    std::size_t first = 0;
+                    if (!stealing)
+                    {
+                        if (holder.get_next_thread_HP(
+                                q_index, th, false, false))
+                        {
+                            return true;
+                        }
+                        if (!allow_stealing || holder.size() == 1)
+                        {
+                            return false;
+                        }
+                        first = 1;
+                    }
+                    start_stealing();
+                    return record_steal_attempt(this_thread, domain, stealing,
+                        holder.get_next_thread_HP(
+                            q_index, th, stealing, allow_stealing, first));
                 };
 
             auto get_next_thread_function =
@@ -624,8 +677,24 @@ namespace hpx::threads::policies {
                     thread_holder_type* /* receiver */,
                     threads::thread_id_ref_type& th, bool stealing,
                     bool allow_stealing) {
-                    return numa_holder_[domain].get_next_thread(
-                        q_index, th, stealing, allow_stealing);
+                    auto& holder = numa_holder_[domain];
+                    std::size_t first = 0;
+                    if (!stealing)
+                    {
+                        if (holder.get_next_thread(q_index, th, false, false))
+                        {
+                            return true;
+                        }
+                        if (!allow_stealing || holder.size() == 1)
+                        {
+                            return false;
+                        }
+                        first = 1;
+                    }
+                    start_stealing();
+                    return record_steal_attempt(this_thread, domain, stealing,
+                        holder.get_next_thread(
+                            q_index, th, stealing, allow_stealing, first));
                 };
 
             std::size_t domain = d_lookup_[this_thread];
@@ -634,7 +703,6 @@ namespace hpx::threads::policies {
             // first try a high priority task, allow stealing if stealing of HP
             // tasks in on, this will be fine but send a null function for
             // normal tasks
-
             if (bool const result =
                     steal_by_function<threads::thread_id_ref_type>(domain,
                         q_index, numa_stealing_, core_stealing_, nullptr, thrd,
@@ -644,6 +712,17 @@ namespace hpx::threads::policies {
                 return result;
             }
 
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            // only the search of the queues of other worker threads is timed
+            if (steal_start != 0)
+            {
+                this->get_steal_statistics(this_thread)
+                    .record_failed_steal_time(static_cast<std::int64_t>(
+                        hpx::chrono::high_resolution_clock::now() -
+                        steal_start));
+            }
+#endif
+
             // if we did not get a task at all, then try converting tasks in the
             // pending queue into staged ones
             std::size_t added = 0;
@@ -675,16 +754,18 @@ namespace hpx::threads::policies {
                 [&](std::size_t domain, std::size_t q_index,
                     thread_holder_type* receiver, std::size_t& add,
                     bool stealing, bool allow_stealing) {
-                    return numa_holder_[domain].add_new_HP(
-                        receiver, q_index, add, stealing, allow_stealing);
+                    return record_steal_attempt(this_thread, domain, stealing,
+                        numa_holder_[domain].add_new_HP(
+                            receiver, q_index, add, stealing, allow_stealing));
                 };
 
             auto add_new_function = [&](std::size_t domain, std::size_t q_index,
                                         thread_holder_type* receiver,
                                         std::size_t& add, bool stealing,
                                         bool allow_stealing) {
-                return numa_holder_[domain].add_new(
-                    receiver, q_index, add, stealing, allow_stealing);
+                return record_steal_attempt(this_thread, domain, stealing,
+                    numa_holder_[domain].add_new(
+                        receiver, q_index, add, stealing, allow_stealing));
             };
 
             std::size_t domain = d_lookup_[this_thread];
@@ -1077,6 +1158,11 @@ namespace hpx::threads::policies {
             hpx::threads::detail::set_thread_pool_num_tss(
                 parent_pool_->get_pool_id().index());
 
+#ifdef HPX_HAVE_THREAD_STEALING_COUNTS
+            this->get_steal_statistics(local_thread)
+                .set_numa_domain(d_lookup_[local_thread]);
+#endif
+
             // one thread holder per core (shared by PUs)
 
             // queue pointers we will assign to each thread
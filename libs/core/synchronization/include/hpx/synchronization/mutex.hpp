@@ -242,7 +242,9 @@ namespace hpx {
 
     protected:
         /// \cond NOPROTECTED
-        mutable mutex_type mtx_;
+        // lock() records the acquisitions of the mutex, the internal
+        // spinlock is not profiled separately
+        mutable mutex_type mtx_{hpx::detail::unprofiled};
         threads::thread_id_type owner_id_;
         hpx::lcos::local::detail::condition_variable cond_;
 #if defined(HPX_HAVE_MODULE_TRACY)
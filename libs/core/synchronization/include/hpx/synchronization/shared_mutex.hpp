@@ -23,6 +23,7 @@
 #include <atomic>
 #include <cstdint>
 #include <mutex>
+#include <type_traits>
 
 namespace hpx::detail {
 
@@ -32,11 +33,30 @@ namespace hpx::detail {
     {
         using mutex_type = Mutex;
 
+        // lock() and lock_shared() record the acquisitions of the
+        // shared_mutex, the internal lock is not profiled separately if it
+        // supports this
         HPX_HOST_DEVICE_CONSTEXPR shared_mutex_data() noexcept
+          : shared_mutex_data(std::is_constructible<mutex_type,
+                hpx::detail::unprofiled_t>())
+        {
+        }
+
+    private:
+        HPX_HOST_DEVICE_CONSTEXPR explicit shared_mutex_data(
+            std::true_type) noexcept
+          : state_change(hpx::detail::unprofiled)
+          , count_(1)
+        {
+        }
+
+        HPX_HOST_DEVICE_CONSTEXPR explicit shared_mutex_data(
+            std::false_type) noexcept
           : count_(1)
         {
         }
 
+    public:
         struct state_data
         {
             std::uint32_t shared_count;
@@ -99,12 +119,18 @@ namespace hpx::detail {
 
         void lock_shared()
         {
+            std::int64_t wait_start = 0;
             while (true)
             {
                 std::unique_lock<mutex_type> lk(state_change);
                 auto s = state.load(std::memory_order_acquire);
                 while (s.data.exclusive || s.data.exclusive_waiting_blocked)
                 {
+                    if (wait_start == 0)
+                    {
+                        wait_start = util::lock_contention_start();
+                    }
+
                     shared_cond.wait(lk);
                     s = state.load(std::memory_order_acquire);
                 }
@@ -117,6 +143,7 @@ namespace hpx::detail {
                     break;
                 }
             }
+            util::record_lock_acquisition(wait_start);
         }
 
         bool try_lock_shared()
@@ -189,11 +216,17 @@ namespace hpx::detail {
 
         void lock()
         {
+            std::int64_t wait_start = 0;
             while (true)
             {
                 auto s = state.load(std::memory_order_acquire);
                 while (s.data.shared_count != 0 || s.data.exclusive)
                 {
+                    if (wait_start == 0)
+                    {
+                        wait_start = util::lock_contention_start();
+                    }
+
                     auto s1 = s;
 
                     s.data.exclusive_waiting_blocked = true;
@@ -215,6 +248,7 @@ namespace hpx::detail {
                     break;
                 }
             }
+            util::record_lock_acquisition(wait_start);
         }
 
         bool try_lock()
@@ -37,6 +37,17 @@ namespace hpx {
 
     namespace detail {
 
+        // Tag selecting a spinlock whose acquisitions are not recorded by the
+        // lock contention profiler. This is used for the internal spinlocks of
+        // other synchronization primitives which record their own
+        // acquisitions.
+        HPX_CXX_CORE_EXPORT struct unprofiled_t
+        {
+            explicit unprofiled_t() = default;
+        };
+
+        HPX_CXX_CORE_EXPORT inline constexpr unprofiled_t unprofiled{};
+
         // std::mutex-compatible spinlock class (Backoff == true)
         // boost::mutex-compatible spinlock class (Backoff == false)
         HPX_CXX_CORE_EXPORT template <bool Backoff = true>
@@ -50,6 +61,9 @@ namespace hpx {
 
         private:
             std::atomic<bool> v_;
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            bool profiled_ = true;
+#endif
 #if defined(HPX_HAVE_MODULE_TRACY)
             hpx::tracy::lock_data context_;
 #endif
@@ -75,6 +89,14 @@ namespace hpx {
 #endif
             }
 
+            explicit spinlock(unprofiled_t) noexcept
+              : spinlock()
+            {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                profiled_ = false;
+#endif
+            }
+
             ~spinlock()
             {
                 HPX_ITT_SYNC_DESTROY(this);
@@ -93,6 +115,14 @@ namespace hpx {
             {
             }
 
+            explicit constexpr spinlock(unprofiled_t) noexcept
+              : v_(false)
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+              , profiled_(false)
+#endif
+            {
+            }
+
             ~spinlock() = default;
 #endif
 
@@ -122,8 +152,12 @@ namespace hpx {
                 //      doing is_locked() -> false followed by an acquire_lock()
                 //      operation. The above order can be changed arbitrarily
                 //      but the nature of execution will still remain the same.
+                std::int64_t wait_start = 0;
                 if (!acquire_lock())
                 {
+                    if (profiled())
+                        wait_start = util::lock_contention_start();
+
                     auto pred = [this]() noexcept { return is_locked(); };
                     do
                     {
@@ -136,6 +170,8 @@ namespace hpx {
                 if (run_after)
                     hpx::tracy::lock_acquired(context_);
 #endif
+                if (profiled())
+                    util::record_lock_acquisition(wait_start);
                 util::register_lock(this);
             }
 
@@ -181,6 +217,15 @@ namespace hpx {
             }
 
         private:
+            constexpr bool profiled() const noexcept
+            {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                return profiled_;
+#else
+                return true;
+#endif
+            }
+
             // returns whether the mutex has been acquired
             HPX_FORCEINLINE bool acquire_lock() noexcept
             {
@@ -19,6 +19,7 @@
 #include <hpx/modules/tracy.hpp>
 #endif
 
+#include <cstdint>
 #include <mutex>
 #include <string>
 #include <utility>
@@ -58,6 +59,7 @@ namespace hpx {
         bool const run_after = hpx::tracy::lock_prepare(context_);
 #endif
 
+        std::int64_t wait_start = 0;
         {
             std::unique_lock<mutex_type> l(mtx_);
 
@@ -73,6 +75,11 @@ namespace hpx {
 
             while (owner_id_ != threads::invalid_thread_id)
             {
+                if (wait_start == 0)
+                {
+                    wait_start = util::lock_contention_start();
+                }
+
                 cond_.wait(l, ec);
                 if (ec)
                 {
@@ -90,6 +97,8 @@ namespace hpx {
         if (run_after)
             hpx::tracy::lock_acquired(context_);
 #endif
+        util::record_lock_acquisition(
+            HPX_LOCK_CONTENTION_CALLER(), wait_start);
     }
 
     bool mutex::try_lock(char const* /* description */, error_code& /* ec */)
@@ -0,0 +1,184 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/lock_registration.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/mutex.hpp>
+#include <hpx/shared_mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+using hpx::util::lock_contention_kind;
+
+constexpr std::size_t num_acquisitions = 100;
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+///////////////////////////////////////////////////////////////////////////////
+// hold the lock for a while, forcing the caller to wait
+template <typename Mutex>
+void contend(Mutex& mtx)
+{
+    std::atomic<bool> locked(false);
+
+    hpx::future<void> f = hpx::async([&] {
+        std::lock_guard<Mutex> l(mtx);
+        locked = true;
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    });
+
+    while (!locked)
+    {
+        hpx::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<Mutex> l(mtx);
+    }
+    f.get();
+}
+
+void test_uncontended()
+{
+    std::cerr << "test_uncontended\n";
+
+    std::int64_t const acquisitions = hpx::util::get_lock_contention_total(
+        lock_contention_kind::acquisitions);
+
+    hpx::spinlock mtx;
+    for (std::size_t i = 0; i != num_acquisitions; ++i)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx);
+    }
+
+    HPX_TEST_LTE(acquisitions + static_cast<std::int64_t>(num_acquisitions),
+        hpx::util::get_lock_contention_total(
+            lock_contention_kind::acquisitions));
+}
+
+void test_contended()
+{
+    std::cerr << "test_contended\n";
+
+    std::int64_t const contended_before =
+        hpx::util::get_lock_contention_total(lock_contention_kind::contended);
+    std::int64_t const wait_time_before =
+        hpx::util::get_lock_contention_total(lock_contention_kind::wait_time);
+
+    hpx::mutex mtx;
+    contend(mtx);
+
+    HPX_TEST_LTE(contended_before + 1,
+        hpx::util::get_lock_contention_total(lock_contention_kind::contended));
+    HPX_TEST_LT(wait_time_before,
+        hpx::util::get_lock_contention_total(lock_contention_kind::wait_time));
+
+    hpx::shared_mutex shared_mtx;
+    contend(shared_mtx);
+
+    // the sites are sorted by decreasing wait time
+    std::vector<hpx::util::lock_contention_site> const sites =
+        hpx::util::get_lock_contention_sites();
+    HPX_TEST(!sites.empty());
+
+    std::uint64_t contended = 0;
+    for (std::size_t i = 0; i != sites.size(); ++i)
+    {
+        HPX_TEST_LT(static_cast<std::uint64_t>(0), sites[i].acquisitions);
+        HPX_TEST_LTE(sites[i].contended, sites[i].acquisitions);
+        HPX_TEST_LTE(sites[i].max_wait_time, sites[i].wait_time);
+        HPX_TEST(!sites[i].name.empty());
+        if (i != 0)
+        {
+            HPX_TEST_LTE(sites[i].wait_time, sites[i - 1].wait_time);
+        }
+        contended += sites[i].contended;
+    }
+    HPX_TEST_LTE(static_cast<std::uint64_t>(2), contended);
+
+    std::ostringstream report;
+    hpx::util::print_lock_contention_report(report, 5);
+    HPX_TEST_EQ(report.str().rfind("lock contention: ", 0),
+        static_cast<std::size_t>(0));
+}
+
+void test_stopped()
+{
+    std::cerr << "test_stopped\n";
+
+    hpx::util::stop_lock_contention_profiling();
+    HPX_TEST(!hpx::util::lock_contention_profiling_enabled());
+
+    // nothing is recorded once the profiling was stopped
+    std::int64_t const acquisitions = hpx::util::get_lock_contention_total(
+        lock_contention_kind::acquisitions);
+
+    hpx::spinlock mtx;
+    for (std::size_t i = 0; i != num_acquisitions; ++i)
+    {
+        std::lock_guard<hpx::spinlock> l(mtx);
+    }
+
+    HPX_TEST_EQ(acquisitions,
+        hpx::util::get_lock_contention_total(
+            lock_contention_kind::acquisitions));
+}
+#else
+///////////////////////////////////////////////////////////////////////////////
+void test_disabled()
+{
+    std::cerr << "test_disabled\n";
+
+    HPX_TEST(!hpx::util::start_lock_contention_profiling());
+    HPX_TEST(!hpx::util::lock_contention_profiling_enabled());
+
+    hpx::mutex mtx;
+    {
+        std::lock_guard<hpx::mutex> l(mtx);
+    }
+
+    HPX_TEST(hpx::util::get_lock_contention_sites().empty());
+    HPX_TEST_EQ(hpx::util::get_lock_contention_total(
+                    lock_contention_kind::acquisitions),
+        static_cast<std::int64_t>(0));
+
+    hpx::util::stop_lock_contention_profiling();
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+    HPX_TEST(hpx::util::start_lock_contention_profiling());
+    HPX_TEST(hpx::util::lock_contention_profiling_enabled());
+
+    test_uncontended();
+    test_contended();
+    test_stopped();
+#else
+    test_disabled();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
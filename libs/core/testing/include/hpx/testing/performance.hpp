@@ -20,8 +20,10 @@ namespace hpx::util {
         hpx::program_options::options_description& cmdline);
     HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void perftests_init(
         hpx::program_options::variables_map const& vm);
+    // Run and time the given test, returns the median time of one run (in
+    // seconds).
 #if defined(HPX_HAVE_NANOBENCH)
-    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void perftests_report(
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT double perftests_report(
         std::string const& name, std::string const& exec,
         std::size_t const steps, hpx::function<void()>&& test);
     HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void perftests_print_times(
@@ -30,7 +32,7 @@ namespace hpx::util {
         std::ostream& strm);
     HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void perftests_print_times();
 #else
-    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void perftests_report(
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT double perftests_report(
         std::string const& name, std::string const& exec,
         std::size_t const steps, hpx::function<void()>&& test);
 
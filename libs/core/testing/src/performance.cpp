@@ -6,13 +6,20 @@
 
 #include <hpx/testing/performance.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <optional>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #if defined(HPX_HAVE_NANOBENCH)
@@ -22,11 +29,75 @@
 
 namespace hpx::util {
 
+    namespace detail {
+
+        struct perftests_settings
+        {
+            // number of untimed runs preceding the measurements (if not
+            // given, the harness' default is used)
+            std::optional<std::size_t> warmup;
+
+            // number of timed runs, zero selects the benchmark's default
+            std::size_t repetitions = 0;
+
+            // file the JSON results are written to (if not empty)
+            std::string output;
+
+            // the command line options affecting the placement of the
+            // worker threads, recorded to make results comparable
+            std::vector<std::pair<std::string, std::string>> configuration;
+        };
+
+        perftests_settings& settings()
+        {
+            static perftests_settings s;
+            return s;
+        }
+
+        std::string option_as_string(
+            hpx::program_options::variables_map const& vm, char const* name)
+        {
+            auto const& value = vm[name].value();
+            if (auto const* s = hpx::any_cast<std::string>(&value))
+            {
+                return *s;
+            }
+            if (auto const* n = hpx::any_cast<std::size_t>(&value))
+            {
+                return std::to_string(*n);
+            }
+            if (auto const* v = hpx::any_cast<std::vector<std::string>>(&value))
+            {
+                std::string result;
+                for (auto const& s : *v)
+                {
+                    if (!result.empty())
+                        result += ";";
+                    result += s;
+                }
+                return result;
+            }
+            return {};
+        }
+    }    // namespace detail
+
     void perftests_cfg(hpx::program_options::options_description& cmdline)
     {
-        cmdline.add_options()("detailed_bench",
-            "Use if detailed benchmarks are required, showing the execution "
-            "time taken for each epoch");
+        // clang-format off
+        cmdline.add_options()
+            ("detailed_bench",
+                "Use if detailed benchmarks are required, showing the "
+                "execution time taken for each epoch")
+            ("bench_warmup", hpx::program_options::value<std::size_t>(),
+                "number of untimed runs of each benchmark before measuring "
+                "(default: 1, 40 if nanobench is used)")
+            ("bench_repetitions", hpx::program_options::value<std::size_t>(),
+                "number of timed runs of each benchmark (default: as defined "
+                "by the benchmark)")
+            ("bench_output", hpx::program_options::value<std::string>(),
+                "write the results and their statistics as JSON to the given "
+                "file");
+        // clang-format on
     }
 
     void perftests_init(hpx::program_options::variables_map const& vm)
@@ -35,6 +106,34 @@ namespace hpx::util {
         {
             detailed_ = true;
         }
+
+        auto& settings = detail::settings();
+        if (vm.count("bench_warmup"))
+        {
+            settings.warmup = vm["bench_warmup"].as<std::size_t>();
+        }
+        if (vm.count("bench_repetitions"))
+        {
+            settings.repetitions = vm["bench_repetitions"].as<std::size_t>();
+        }
+        if (vm.count("bench_output"))
+        {
+            settings.output = vm["bench_output"].as<std::string>();
+        }
+
+        settings.configuration.clear();
+        settings.configuration.emplace_back("hardware_concurrency",
+            std::to_string(std::thread::hardware_concurrency()));
+        for (char const* option : {"hpx:threads", "hpx:cores", "hpx:affinity",
+                 "hpx:bind", "hpx:pu-step", "hpx:pu-offset",
+                 "hpx:numa-sensitive"})
+        {
+            if (vm.count(option))
+            {
+                settings.configuration.emplace_back(
+                    option + 4, detail::option_as_string(vm, option));
+            }
+        }
     }
 
     namespace detail {
@@ -71,17 +170,29 @@ average: {{average(elapsed)}}{{^-last}}
 )DELIM";
         }
 
+        // the number of epochs (timed runs) of each benchmark
+        std::size_t nanobench_num_epochs() noexcept
+        {
+            return settings().repetitions != 0 ? settings().repetitions :
+                                                 nanobench_epochs;
+        }
+
         ankerl::nanobench::Bench& bench()
         {
             static ankerl::nanobench::Bench b;
             static ankerl::nanobench::Config cfg;
 
-            cfg.mWarmup = nanobench_warmup;
-            cfg.mNumEpochs = nanobench_epochs;
+            cfg.mWarmup = settings().warmup.value_or(nanobench_warmup);
+            cfg.mNumEpochs = nanobench_num_epochs();
 
             return b.config(cfg);
         }
+
+        constexpr std::size_t default_warmup = nanobench_warmup;
 #else
+        constexpr std::size_t default_warmup = 1;
+#endif
+
         // Json output for performance reports
         class json_perf_times
         {
@@ -97,6 +208,8 @@ average: {{average(elapsed)}}{{^-last}}
         public:
             HPX_CORE_EXPORT void add(std::string const& name,
                 std::string const& executor, long double time);
+
+            void print_json(std::ostream& strm) const;
         };
 
         json_perf_times& times()
@@ -105,6 +218,82 @@ average: {{average(elapsed)}}{{^-last}}
             return res;
         }
 
+        // Summary of the measured times of one benchmark. The confidence
+        // interval of the median is distribution free, it is based on the
+        // order statistics of the (sorted) series.
+        struct perf_statistics
+        {
+            long double mean = 0;
+            long double stddev = 0;
+            long double min = 0;
+            long double max = 0;
+            long double median = 0;
+            long double p5 = 0;
+            long double p25 = 0;
+            long double p75 = 0;
+            long double p95 = 0;
+            long double median_ci_lower = 0;
+            long double median_ci_upper = 0;
+        };
+
+        long double percentile(
+            std::vector<long double> const& sorted, double q) noexcept
+        {
+            double const pos = q * static_cast<double>(sorted.size() - 1);
+            auto const lower = static_cast<std::size_t>(pos);
+            std::size_t const upper = (std::min) (lower + 1, sorted.size() - 1);
+            auto const fraction = static_cast<long double>(
+                pos - static_cast<double>(lower));
+            return sorted[lower] + fraction * (sorted[upper] - sorted[lower]);
+        }
+
+        perf_statistics compute_statistics(std::vector<long double> series)
+        {
+            perf_statistics stats;
+            if (series.empty())
+            {
+                return stats;
+            }
+
+            std::sort(series.begin(), series.end());
+            auto const n = static_cast<double>(series.size());
+
+            long double sum = 0;
+            for (long double const val : series)
+            {
+                sum += val;
+            }
+            stats.mean = sum / static_cast<long double>(n);
+
+            long double squares = 0;
+            for (long double const val : series)
+            {
+                squares += (val - stats.mean) * (val - stats.mean);
+            }
+            stats.stddev = series.size() > 1 ?
+                std::sqrt(squares / static_cast<long double>(n - 1)) :
+                0;
+
+            stats.min = series.front();
+            stats.max = series.back();
+            stats.median = percentile(series, 0.5);
+            stats.p5 = percentile(series, 0.05);
+            stats.p25 = percentile(series, 0.25);
+            stats.p75 = percentile(series, 0.75);
+            stats.p95 = percentile(series, 0.95);
+
+            // ranks (1-based) bounding the 95% confidence interval of the
+            // median
+            double const half_width = 1.96 * std::sqrt(n) / 2;
+            double const lower = std::floor(n / 2 - half_width);
+            double const upper = std::ceil(1 + n / 2 + half_width);
+            stats.median_ci_lower =
+                series[static_cast<std::size_t>((std::max) (lower, 1.0)) - 1];
+            stats.median_ci_upper =
+                series[static_cast<std::size_t>((std::min) (upper, n)) - 1];
+            return stats;
+        }
+
         void add_time(std::string const& test_name, std::string const& executor,
             long double time)
         {
@@ -115,44 +304,7 @@ average: {{average(elapsed)}}{{^-last}}
         {
             if (detailed_)
             {
-                strm << "{\n";
-                strm << "  \"outputs\" : [";
-                int outputs = 0;
-                for (auto&& item : obj.m_map)
-                {
-                    long double average = static_cast<long double>(0.0);
-                    if (outputs)
-                        strm << ",";
-                    strm << "\n    {\n";
-                    strm << R"(      "name": ")" << std::get<0>(item.first)
-                         << "\",\n";
-                    strm << R"(      "executor": ")" << std::get<1>(item.first)
-                         << "\",\n";
-                    strm << R"(      "series": [)"
-                         << "\n";
-                    int series = 0;
-                    strm.precision(
-                        std::numeric_limits<long double>::max_digits10 - 1);
-                    for (long double const val : item.second)
-                    {
-                        if (series)
-                        {
-                            strm << ",\n";
-                        }
-                        strm << R"(         )" << std::scientific << val;
-                        ++series;
-                        average += val;
-                    }
-                    strm << "\n       ],\n";
-                    strm << std::scientific << R"(      "average": )"
-                         << average / series << "\n";
-                    strm << "    }";
-                    ++outputs;
-                }
-                if (outputs)
-                    strm << "\n";
-                strm << "]\n";
-                strm << "}\n";
+                obj.print_json(strm);
             }
             else
             {
@@ -168,10 +320,15 @@ average: {{average(elapsed)}}{{^-last}}
                         ++series;
                         average += val;
                     }
+                    perf_statistics const stats =
+                        compute_statistics(item.second);
                     strm.precision(
                         std::numeric_limits<long double>::max_digits10 - 1);
                     strm << std::scientific << "average: " << average / series
-                         << "\n\n";
+                         << "\n";
+                    strm << "median: " << stats.median << " (95% CI: "
+                         << stats.median_ci_lower << " - "
+                         << stats.median_ci_upper << ")\n\n";
                 }
             }
             return strm;
@@ -182,25 +339,114 @@ average: {{average(elapsed)}}{{^-last}}
         {
             m_map[key_t(name, executor)].push_back(time);
         }
-#endif
 
+        void json_perf_times::print_json(std::ostream& strm) const
+        {
+            auto const flags = strm.flags();
+            auto const precision = strm.precision(
+                std::numeric_limits<long double>::max_digits10 - 1);
+
+            strm << "{\n";
+            strm << "  \"configuration\": {";
+            int entries = 0;
+            for (auto const& [key, value] : settings().configuration)
+            {
+                if (entries++)
+                    strm << ",";
+                strm << "\n    \"" << key << "\": \"" << value << "\"";
+            }
+            strm << "\n  },\n";
+            strm << "  \"warmup\": "
+                 << settings().warmup.value_or(default_warmup) << ",\n";
+            strm << "  \"outputs\" : [";
+            int outputs = 0;
+            for (auto&& item : m_map)
+            {
+                if (outputs)
+                    strm << ",";
+                strm << "\n    {\n";
+                strm << R"(      "name": ")" << std::get<0>(item.first)
+                     << "\",\n";
+                strm << R"(      "executor": ")" << std::get<1>(item.first)
+                     << "\",\n";
+                strm << R"(      "series": [)"
+                     << "\n";
+                int series = 0;
+                for (long double const val : item.second)
+                {
+                    if (series)
+                    {
+                        strm << ",\n";
+                    }
+                    strm << R"(         )" << std::scientific << val;
+                    ++series;
+                }
+                strm << "\n       ],\n";
+
+                perf_statistics const stats = compute_statistics(item.second);
+                strm << std::scientific;
+                strm << R"(      "average": )" << stats.mean << ",\n";
+                strm << R"(      "stddev": )" << stats.stddev << ",\n";
+                strm << R"(      "min": )" << stats.min << ",\n";
+                strm << R"(      "max": )" << stats.max << ",\n";
+                strm << R"(      "median": )" << stats.median << ",\n";
+                strm << R"(      "median_ci": [)" << stats.median_ci_lower
+                     << ", " << stats.median_ci_upper << "],\n";
+                strm << R"(      "percentiles": {)"
+                     << R"("5": )" << stats.p5 << R"(, "25": )" << stats.p25
+                     << R"(, "75": )" << stats.p75 << R"(, "95": )"
+                     << stats.p95 << "}\n";
+                strm << "    }";
+                ++outputs;
+            }
+            if (outputs)
+                strm << "\n";
+            strm << "]\n";
+            strm << "}\n";
+
+            strm.precision(precision);
+            strm.flags(flags);
+        }
+
+#if defined(HPX_HAVE_NANOBENCH)
+        // the measurements collected by nanobench (the elapsed time of one
+        // run per epoch) in the format written without nanobench
+        json_perf_times nanobench_times()
+        {
+            using measure = ankerl::nanobench::Result::Measure;
+
+            json_perf_times result;
+            for (auto const& r : bench().results())
+            {
+                for (std::size_t i = 0; i != r.size(); ++i)
+                {
+                    result.add(r.config().mBenchmarkName,
+                        r.context("executor"), r.get(i, measure::elapsed));
+                }
+            }
+            return result;
+        }
+#endif
     }    // namespace detail
 
 #if defined(HPX_HAVE_NANOBENCH)
-    void perftests_report(std::string const& name, std::string const& exec,
+    double perftests_report(std::string const& name, std::string const& exec,
         std::size_t const steps, hpx::function<void()>&& test)
     {
         if (steps == 0)
-            return;
+            return 0;
 
         std::size_t const steps_per_epoch =
-            steps / detail::nanobench_epochs + 1;
+            steps / detail::nanobench_num_epochs() + 1;
+
+        auto& bench = detail::bench()
+                          .name(name)
+                          .context("executor", exec)
+                          .minEpochIterations(steps_per_epoch)
+                          .run(test);
 
-        detail::bench()
-            .name(name)
-            .context("executor", exec)
-            .minEpochIterations(steps_per_epoch)
-            .run(test);
+        return bench.results().back().median(
+            ankerl::nanobench::Result::Measure::elapsed);
     }
 
     // Print all collected results to the provided stream,
@@ -220,23 +466,45 @@ average: {{average(elapsed)}}{{^-last}}
     // Overload that uses a default nanobench template and prints to std::cout
     void perftests_print_times()
     {
+        // the JSON output is the same as without nanobench, including the
+        // statistics and the thread placement
         if (detailed_)
-            perftests_print_times(detail::nanobench_hpx_template(), std::cout);
+            detail::nanobench_times().print_json(std::cout);
         else
             perftests_print_times(
                 detail::nanobench_hpx_simple_template(), std::cout);
+
+        if (auto const& output = detail::settings().output; !output.empty())
+        {
+            std::ofstream file(output);
+            detail::nanobench_times().print_json(file);
+        }
     }
 #else
-    void perftests_report(std::string const& name, std::string const& exec,
+    double perftests_report(std::string const& name, std::string const& exec,
         std::size_t const steps, hpx::function<void()>&& test)
     {
         if (steps == 0)
-            return;
+            return 0;
+
+        auto const& settings = detail::settings();
+
+        // untimed runs to warm up the caches (and the thread pools)
+        std::size_t const warmup =
+            settings.warmup.value_or(detail::default_warmup);
+        for (std::size_t i = 0; i != warmup; ++i)
+        {
+            test();
+        }
+
+        std::size_t const repetitions =
+            settings.repetitions != 0 ? settings.repetitions : steps;
+
+        std::vector<long double> series;
+        series.reserve(repetitions);
 
-        // First iteration to cache the data
-        test();
         using timer = std::chrono::high_resolution_clock;
-        for (std::size_t i = 0; i != steps; ++i)
+        for (std::size_t i = 0; i != repetitions; ++i)
         {
             // For now, we don't flush the cache
             //flush_cache();
@@ -247,12 +515,22 @@ average: {{average(elapsed)}}{{^-last}}
                 std::chrono::duration_cast<std::chrono::duration<long double>>(
                     timer::now() - start);
             detail::add_time(name, exec, time.count());
+            series.push_back(time.count());
         }
+
+        return static_cast<double>(
+            detail::compute_statistics(HPX_MOVE(series)).median);
     }
 
     void perftests_print_times()
     {
         std::cout << detail::times();
+
+        if (auto const& output = detail::settings().output; !output.empty())
+        {
+            std::ofstream file(output);
+            detail::times().print_json(file);
+        }
     }
 #endif
 }    // namespace hpx::util
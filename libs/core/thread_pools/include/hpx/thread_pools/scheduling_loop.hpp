@@ -12,6 +12,10 @@
 #include <hpx/modules/execution_base.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/threading_base.hpp>
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS) ||                             \
+    defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
 #include <hpx/modules/tracing.hpp>
 #include <hpx/thread_pools/detail/background_thread.hpp>
 #include <hpx/thread_pools/detail/scheduling_callbacks.hpp>
@@ -81,6 +85,114 @@ namespace hpx::threads::detail {
     };
 #endif
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+    ///////////////////////////////////////////////////////////////////////////
+    // Record the time an HPX-thread has spent in the queues before being run
+    // and (on destruction) the time it has spent executing.
+    struct collect_thread_latencies
+    {
+        collect_thread_latencies(policies::scheduler_base& scheduler,
+            std::size_t num_thread, thread_data const* thrdptr) noexcept
+          : start_(hpx::chrono::high_resolution_clock::now())
+          , execution_(scheduler.get_latency_histogram(
+                latency_histogram_kind::execution, num_thread))
+        {
+            scheduler
+                .get_latency_histogram(
+                    latency_histogram_kind::queue_wait, num_thread)
+                .record(static_cast<std::int64_t>(
+                    start_ - thrdptr->get_ready_time()));
+        }
+
+        collect_thread_latencies(collect_thread_latencies const&) = delete;
+        collect_thread_latencies(collect_thread_latencies&&) = delete;
+        collect_thread_latencies& operator=(
+            collect_thread_latencies const&) = delete;
+        collect_thread_latencies& operator=(
+            collect_thread_latencies&&) = delete;
+
+        ~collect_thread_latencies()
+        {
+            execution_.record(static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now() - start_));
+        }
+
+        std::uint64_t start_;
+        latency_histogram& execution_;
+    };
+#endif
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+    ///////////////////////////////////////////////////////////////////////////
+    // Accumulate the hardware events occurring while running an HPX-thread
+    // phase (if enabled).
+    struct sample_perf_events
+    {
+        explicit sample_perf_events(perf_event_counters& counters) noexcept
+          : counters_(perf_event_task_sampling() ? &counters : nullptr)
+        {
+            if (counters_ != nullptr)
+            {
+                counters_->start_task();
+            }
+        }
+
+        sample_perf_events(sample_perf_events const&) = delete;
+        sample_perf_events(sample_perf_events&&) = delete;
+        sample_perf_events& operator=(sample_perf_events const&) = delete;
+        sample_perf_events& operator=(sample_perf_events&&) = delete;
+
+        ~sample_perf_events()
+        {
+            if (counters_ != nullptr)
+            {
+                counters_->stop_task();
+            }
+        }
+
+        perf_event_counters* counters_;
+    };
+#endif
+
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+    ///////////////////////////////////////////////////////////////////////////
+    // Attribute the samples taken by the sampling profiler to the running
+    // HPX-thread phase (if enabled).
+    struct sampled_thread
+    {
+        explicit sampled_thread(thread_data const* thrdptr)
+          : enabled_(hpx::tracing::sampling_profiler_enabled())
+        {
+            if (enabled_)
+            {
+                // only annotations refer to strings which stay valid
+                threads::thread_description const desc =
+                    thrdptr->get_description();
+                bool const annotated = desc.kind() ==
+                    threads::thread_description::data_type::description;
+                hpx::tracing::set_sampled_task(
+                    reinterpret_cast<std::uint64_t>(thrdptr),
+                    annotated ? desc.get_description() : nullptr);
+            }
+        }
+
+        sampled_thread(sampled_thread const&) = delete;
+        sampled_thread(sampled_thread&&) = delete;
+        sampled_thread& operator=(sampled_thread const&) = delete;
+        sampled_thread& operator=(sampled_thread&&) = delete;
+
+        ~sampled_thread()
+        {
+            if (enabled_)
+            {
+                hpx::tracing::set_sampled_task(0);
+            }
+        }
+
+        bool enabled_;
+    };
+#endif
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename SchedulingPolicy>
     void scheduling_loop(std::size_t num_thread, SchedulingPolicy& scheduler,
@@ -109,6 +221,13 @@ namespace hpx::threads::detail {
             [&idle_rate] { idle_rate.take_snapshot(); });
 #endif
 
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+        // start counting the hardware events of this worker thread
+        perf_event_counters& perf_events =
+            scheduler.get_perf_event_counters(num_thread);
+        perf_events.open();
+#endif
+
         // spin for some time after queues have become empty
         bool may_exit = false;
 
@@ -201,6 +320,29 @@ namespace hpx::threads::detail {
                                 thrd_stat.get_previous(),
                                 thread_schedule_state::active);
 
+#if defined(HPX_HAVE_TASK_TRACE)
+                            if (hpx::tracing::task_trace_enabled())
+                            {
+                                // threads report phase zero before their
+                                // first activation (or if phase information
+                                // is not available)
+                                hpx::tracing::record_task_event(
+                                    thrdptr->get_thread_phase() == 0 ?
+                                        hpx::tracing::task_trace_event::start :
+                                        hpx::tracing::task_trace_event::resume,
+                                    num_thread,
+                                    reinterpret_cast<std::uint64_t>(thrdptr));
+                            }
+#endif
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+                            annotation_counters& annotations =
+                                scheduler.get_annotation_counters(num_thread);
+                            std::size_t const annotation =
+                                annotations.get_index(
+                                    thrdptr->get_description());
+                            std::uint64_t const annotation_start =
+                                hpx::chrono::high_resolution_clock::now();
+#endif
 #ifdef HPX_HAVE_THREAD_IDLE_RATES
                             auto tfunc_time_collector_inner =
                                 hpx::experimental::scope_exit([&idle_rate] {
@@ -264,6 +406,16 @@ namespace hpx::threads::detail {
                                             idle_rate.collect_exec_time(ts);
                                         });
 #endif
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+                                collect_thread_latencies latencies(
+                                    scheduler, num_thread, thrdptr);
+#endif
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+                                sample_perf_events perf_sample(perf_events);
+#endif
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+                                sampled_thread sampled(thrdptr);
+#endif
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are
                                 // resuming the thread and have to restore any
@@ -298,6 +450,36 @@ namespace hpx::threads::detail {
                                 thread_schedule_state::active,
                                 thrd_stat.get_previous());
 
+#if defined(HPX_HAVE_TASK_TRACE)
+                            if (hpx::tracing::task_trace_enabled())
+                            {
+                                thread_schedule_state const s =
+                                    thrd_stat.get_previous();
+                                bool const finished =
+                                    s == thread_schedule_state::terminated ||
+                                    s == thread_schedule_state::deleted;
+                                hpx::tracing::record_task_event(finished ?
+                                        hpx::tracing::task_trace_event::finish :
+                                        hpx::tracing::task_trace_event::suspend,
+                                    num_thread,
+                                    reinterpret_cast<std::uint64_t>(thrdptr));
+                            }
+#endif
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+                            {
+                                thread_schedule_state const s =
+                                    thrd_stat.get_previous();
+                                annotations.record(annotation,
+                                    static_cast<std::int64_t>(
+                                        hpx::chrono::high_resolution_clock::
+                                            now() -
+                                        annotation_start),
+                                    s == thread_schedule_state::terminated ||
+                                        s == thread_schedule_state::deleted);
+                            }
+#endif
+
 #ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
                             ++counters.executed_thread_phases_;
 #endif
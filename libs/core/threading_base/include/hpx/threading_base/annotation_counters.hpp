@@ -0,0 +1,139 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace hpx::threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The values accumulated per annotation (thread description) if
+    /// HPX_WITH_THREAD_ANNOTATION_COUNTERS is enabled.
+    HPX_CXX_CORE_EXPORT enum class annotation_counter_kind : std::uint8_t
+    {
+        /// time spent executing HPX-threads with the annotation (in ns)
+        time = 0,
+
+        /// number of terminated HPX-threads with the annotation
+        count = 1,
+
+        /// number of times HPX-threads with the annotation were suspended
+        suspensions = 2
+    };
+
+    HPX_CXX_CORE_EXPORT inline constexpr std::size_t
+        num_annotation_counter_kinds = 3;
+
+    /// The maximal number of distinct annotations which are tracked. All
+    /// further annotations are accounted for as "<other>".
+    HPX_CXX_CORE_EXPORT inline constexpr std::size_t max_annotations = 512;
+
+    /// Return the (process wide) index of the given annotation, the name is
+    /// interned if it was not seen before. Returns 0 (the index of "<other>")
+    /// if max_annotations distinct names have already been registered.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::size_t get_annotation_index(
+        std::string_view name);
+
+    /// Return the name of the annotation with the given index
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::string get_annotation_name(
+        std::size_t index);
+
+    /// Return the number of annotations registered so far
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::size_t
+    get_annotation_count() noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Per annotation accumulated values of a single worker thread. The
+    /// values are written by the owning worker thread only but may be read
+    /// (and reset) concurrently.
+    HPX_CXX_CORE_EXPORT class annotation_counters
+    {
+    public:
+        annotation_counters() noexcept
+        {
+            for (auto& values : values_)
+            {
+                for (auto& value : values)
+                {
+                    value.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        annotation_counters(annotation_counters const&) = delete;
+        annotation_counters(annotation_counters&&) = delete;
+        annotation_counters& operator=(annotation_counters const&) = delete;
+        annotation_counters& operator=(annotation_counters&&) = delete;
+
+        // Return the index of the given thread description. Must be called
+        // on the owning worker thread only.
+        std::size_t get_index(thread_description const& desc)
+        {
+            if (desc.kind() != thread_description::data_type::description)
+            {
+                return get_index("<address>");
+            }
+            return get_index(desc.get_description());
+        }
+
+        // Descriptions refer to string literals or interned strings, which
+        // allows to cache the index of a name based on its address.
+        std::size_t get_index(char const* name)
+        {
+            auto& entry = cache_[(reinterpret_cast<std::size_t>(name) >> 3) %
+                cache_.size()];
+            if (entry.name != name)
+            {
+                entry.index = get_annotation_index(name);
+                entry.name = name;
+            }
+            return entry.index;
+        }
+
+        // Account for one executed HPX-thread phase
+        void record(std::size_t index, std::int64_t time,
+            bool terminated) noexcept
+        {
+            auto& values = values_[index];
+            values[static_cast<std::size_t>(annotation_counter_kind::time)]
+                .fetch_add(time < 0 ? 0 : time, std::memory_order_relaxed);
+            values[static_cast<std::size_t>(
+                       terminated ? annotation_counter_kind::count :
+                                    annotation_counter_kind::suspensions)]
+                .fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::int64_t get(annotation_counter_kind kind, std::size_t index,
+            bool reset) noexcept
+        {
+            auto& value = values_[index][static_cast<std::size_t>(kind)];
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct cache_entry
+        {
+            char const* name = nullptr;
+            std::size_t index = 0;
+        };
+
+        std::array<cache_entry, 64> cache_;
+        std::array<
+            std::array<std::atomic<std::int64_t>, num_annotation_counter_kinds>,
+            max_annotations>
+            values_;
+    };
+}    // namespace hpx::threads
@@ -0,0 +1,196 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/thread_support.hpp>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx::threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The kinds of latencies collected per worker thread if
+    /// HPX_WITH_THREAD_LATENCY_HISTOGRAMS is enabled.
+    HPX_CXX_CORE_EXPORT enum class latency_histogram_kind : std::uint8_t
+    {
+        /// time spent executing one HPX-thread phase
+        execution = 0,
+
+        /// time a pending HPX-thread spent in the queues before being run
+        queue_wait = 1,
+
+        /// time a pending HPX-thread spent in the queue of another worker
+        /// thread before being stolen
+        steal = 2
+    };
+
+    HPX_CXX_CORE_EXPORT inline constexpr std::size_t
+        num_latency_histogram_kinds = 3;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A log-linear bucketed histogram of durations (in nanoseconds). Every
+    /// power of two range is subdivided into 2^sub_bucket_bits linear
+    /// buckets, which limits the relative error of the reported percentiles
+    /// to 1/2^sub_bucket_bits while covering the full 64 bit range.
+    ///
+    /// Each histogram is written by a single worker thread but may be read
+    /// (and reset) concurrently. All buckets of a histogram have the same
+    /// layout, the collected counts can therefore be merged by adding them.
+    HPX_CXX_CORE_EXPORT class latency_histogram
+    {
+    public:
+        static constexpr std::size_t sub_bucket_bits = 3;
+        static constexpr std::size_t sub_buckets = std::size_t(1)
+            << sub_bucket_bits;
+        static constexpr std::size_t num_buckets =
+            (64 - sub_bucket_bits + 1) * sub_buckets;
+
+        using counts_type = std::array<std::uint64_t, num_buckets>;
+
+        latency_histogram() noexcept
+        {
+            for (auto& count : counts_)
+            {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        latency_histogram(latency_histogram const&) = delete;
+        latency_histogram(latency_histogram&&) = delete;
+        latency_histogram& operator=(latency_histogram const&) = delete;
+        latency_histogram& operator=(latency_histogram&&) = delete;
+
+        // Values below sub_buckets are mapped onto their own bucket, larger
+        // values use the sub_bucket_bits bits following the most significant
+        // one as the index inside the power of two range.
+        static constexpr std::size_t bucket_index(std::uint64_t value) noexcept
+        {
+            if (value < sub_buckets)
+            {
+                return static_cast<std::size_t>(value);
+            }
+
+            std::size_t const shift =
+                static_cast<std::size_t>(std::bit_width(value)) -
+                sub_bucket_bits - 1;
+            return (shift + 1) * sub_buckets +
+                static_cast<std::size_t>((value >> shift) & (sub_buckets - 1));
+        }
+
+        // Return the largest value which is mapped onto the given bucket.
+        static constexpr std::uint64_t bucket_upper_bound(
+            std::size_t index) noexcept
+        {
+            if (index < sub_buckets)
+            {
+                return index;
+            }
+
+            std::size_t const shift = index / sub_buckets - 1;
+            std::uint64_t const lower = (sub_buckets + index % sub_buckets)
+                << shift;
+            return lower + ((std::uint64_t(1) << shift) - 1);
+        }
+
+        void record(std::int64_t value) noexcept
+        {
+            auto const index =
+                bucket_index(static_cast<std::uint64_t>(value < 0 ? 0 : value));
+            counts_[index].fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Add the current counts to the given ones, optionally resetting
+        // this histogram.
+        void collect(counts_type& counts, bool reset) noexcept
+        {
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                counts[i] += reset ?
+                    counts_[i].exchange(0, std::memory_order_relaxed) :
+                    counts_[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        // Return the value below which the given percentage (0..100) of the
+        // recorded values fall (the upper bound of the corresponding bucket).
+        static std::int64_t percentile(
+            counts_type const& counts, double percentage) noexcept
+        {
+            std::uint64_t total = 0;
+            for (std::uint64_t const count : counts)
+            {
+                total += count;
+            }
+            if (total == 0)
+            {
+                return 0;
+            }
+
+            if (percentage < 0.)
+                percentage = 0.;
+            if (percentage > 100.)
+                percentage = 100.;
+
+            // rank of the requested value, at least the first one
+            auto rank = static_cast<std::uint64_t>(
+                percentage / 100. * static_cast<double>(total) + 0.5);
+            if (rank == 0)
+                rank = 1;
+
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i != num_buckets; ++i)
+            {
+                seen += counts[i];
+                if (seen >= rank)
+                {
+                    return static_cast<std::int64_t>(bucket_upper_bound(i));
+                }
+            }
+            return static_cast<std::int64_t>(
+                bucket_upper_bound(num_buckets - 1));
+        }
+
+    private:
+        std::array<std::atomic<std::uint64_t>, num_buckets> counts_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The counts of a latency histogram at the last reset of one of its
+    /// readers. The histograms are shared by all readers (e.g. performance
+    /// counters), resetting them would affect all others. Instead, every
+    /// reader keeps its own baseline and reports the difference to it.
+    HPX_CXX_CORE_EXPORT class latency_histogram_baseline
+    {
+    public:
+        // Replace the given counts by the counts recorded since the last
+        // reset, make the given counts the new baseline if requested.
+        void since_last_reset(
+            latency_histogram::counts_type& counts, bool reset) noexcept
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+            for (std::size_t i = 0; i != latency_histogram::num_buckets; ++i)
+            {
+                std::uint64_t const total = counts[i];
+                counts[i] = total >= baseline_[i] ? total - baseline_[i] : 0;
+                if (reset)
+                {
+                    baseline_[i] = total;
+                }
+            }
+        }
+
+    private:
+        hpx::util::detail::spinlock mtx_;
+        latency_histogram::counts_type baseline_{};
+    };
+}    // namespace hpx::threads
@@ -0,0 +1,127 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+#include <hpx/modules/thread_support.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The hardware events counted per worker thread if
+    /// HPX_WITH_PERF_EVENT_COUNTERS is enabled.
+    HPX_CXX_CORE_EXPORT enum class perf_event_kind : std::uint8_t
+    {
+        cycles = 0,
+        instructions = 1,
+        llc_misses = 2,
+        branch_misses = 3
+    };
+
+    HPX_CXX_CORE_EXPORT inline constexpr std::size_t num_perf_event_kinds = 4;
+
+    namespace detail {
+
+        // number of requests to sample the events around each HPX-thread
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT extern std::atomic<std::size_t>
+            perf_event_task_sampling;
+    }    // namespace detail
+
+    /// Return whether the hardware events are sampled around the execution
+    /// of each HPX-thread phase.
+    HPX_CXX_CORE_EXPORT inline bool perf_event_task_sampling() noexcept
+    {
+        return detail::perf_event_task_sampling.load(
+                   std::memory_order_relaxed) != 0;
+    }
+
+    /// Request (or release a request for) sampling the hardware events
+    /// around the execution of each HPX-thread phase. This requires two
+    /// additional system calls per phase. The requests are counted, the
+    /// events are sampled as long as at least one request is active.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void set_perf_event_task_sampling(
+        bool enable) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The hardware event counters of a single worker thread, based on the
+    /// Linux perf_event_open interface. The counters are opened by the worker
+    /// thread itself and may be read from any thread, a spinlock prevents
+    /// them from being closed or reopened while being read. Events which are
+    /// not supported (or not permitted, see
+    /// /proc/sys/kernel/perf_event_paranoid) are reported as zero.
+    HPX_CXX_CORE_EXPORT class HPX_CORE_EXPORT perf_event_counters
+    {
+    public:
+        using values_type = std::array<std::uint64_t, num_perf_event_kinds>;
+
+        perf_event_counters() noexcept;
+        ~perf_event_counters();
+
+        perf_event_counters(perf_event_counters const&) = delete;
+        perf_event_counters(perf_event_counters&&) = delete;
+        perf_event_counters& operator=(perf_event_counters const&) = delete;
+        perf_event_counters& operator=(perf_event_counters&&) = delete;
+
+        // Start counting the events of the calling OS thread. Counters which
+        // were opened by a different OS thread before are reopened. Returns
+        // whether at least one of the events is being counted.
+        bool open();
+        void close() noexcept;
+
+        // Read the current event counts (scaled if the kernel had to
+        // multiplex the hardware counters).
+        bool read(values_type& values) const noexcept;
+
+        // Accumulate the events occurring while running an HPX-thread phase,
+        // must be called on the owning worker thread.
+        void start_task() noexcept
+        {
+            task_running_ = read(task_start_);
+        }
+
+        void stop_task() noexcept;
+
+        // Return the events counted since the last reset, either overall or
+        // only while executing HPX-threads.
+        std::int64_t get(
+            perf_event_kind kind, bool tasks_only, bool reset) noexcept;
+
+    private:
+        void close_locked() noexcept;
+        bool read_locked(values_type& values) const noexcept;
+
+        mutable hpx::util::detail::spinlock mtx_;
+
+        // file descriptor of the group leader (-1 if not open)
+        int leader_;
+
+        // file descriptors of the events, and their position in the group
+        std::array<int, num_perf_event_kinds> fds_;
+        std::array<int, num_perf_event_kinds> slots_;
+        std::size_t num_slots_;
+
+        // Linux thread id of the OS thread the counters were opened for
+        long tid_;
+
+        bool task_running_;
+        values_type task_start_;
+
+        std::array<std::atomic<std::uint64_t>, num_perf_event_kinds>
+            task_values_;
+        std::array<std::atomic<std::uint64_t>, num_perf_event_kinds>
+            reset_values_;
+    };
+}    // namespace hpx::threads
+
+#endif
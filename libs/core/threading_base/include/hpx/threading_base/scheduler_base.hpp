@@ -12,8 +12,20 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+#include <hpx/threading_base/annotation_counters.hpp>
+#endif
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+#include <hpx/threading_base/latency_histogram.hpp>
+#endif
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+#include <hpx/threading_base/perf_event_counters.hpp>
+#endif
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+#include <hpx/threading_base/steal_statistics.hpp>
+#endif
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/threading_base/thread_pool_base.hpp>
@@ -23,6 +35,7 @@
 #include <hpx/modules/coroutines.hpp>
 #endif
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
@@ -189,6 +202,73 @@ namespace hpx::threads::policies {
             std::size_t num_thread, bool reset) = 0;
         virtual std::int64_t get_num_stolen_to_staged(
             std::size_t num_thread, bool reset) = 0;
+
+        steal_statistics& get_steal_statistics(std::size_t num_thread) noexcept
+        {
+            HPX_ASSERT(num_thread < steal_statistics_.size());
+            return steal_statistics_[num_thread].data_;
+        }
+
+        // Return the number of steal attempts of the given kind of the given
+        // worker thread (all worker threads if num_thread == -1) which are
+        // located in the given NUMA domain (all NUMA domains if thief_domain
+        // == -1) from victims in the given NUMA domain (all NUMA domains if
+        // victim_domain == -1).
+        std::int64_t get_steal_count(steal_count_kind kind,
+            std::size_t thief_domain, std::size_t victim_domain,
+            std::size_t num_thread, bool reset) noexcept;
+
+        // Return the time (in nanoseconds) the given worker thread (all
+        // worker threads if num_thread == -1) spent searching for work to
+        // steal without finding any.
+        std::int64_t get_failed_steal_time(
+            std::size_t num_thread, bool reset) noexcept;
+#endif
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        latency_histogram& get_latency_histogram(
+            latency_histogram_kind kind, std::size_t num_thread) noexcept
+        {
+            HPX_ASSERT(num_thread < latency_histograms_.size());
+            return latency_histograms_[num_thread]
+                .data_[static_cast<std::size_t>(kind)];
+        }
+
+        // Add the counts of the latency histogram of the given kind of the
+        // given worker thread (all worker threads if num_thread == -1).
+        void collect_latency_histogram(latency_histogram_kind kind,
+            std::size_t num_thread, bool reset,
+            latency_histogram::counts_type& counts) noexcept;
+#endif
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+        annotation_counters& get_annotation_counters(
+            std::size_t num_thread) noexcept
+        {
+            HPX_ASSERT(num_thread < annotation_counters_.size());
+            return annotation_counters_[num_thread].data_;
+        }
+
+        // Return the accumulated value of the given kind for the annotation
+        // with the given index of the given worker thread (all worker
+        // threads if num_thread == -1).
+        std::int64_t get_annotation_counter(annotation_counter_kind kind,
+            std::size_t index, std::size_t num_thread, bool reset) noexcept;
+#endif
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+        perf_event_counters& get_perf_event_counters(
+            std::size_t num_thread) noexcept
+        {
+            HPX_ASSERT(num_thread < perf_event_counters_.size());
+            return perf_event_counters_[num_thread].data_;
+        }
+
+        // Return the number of hardware events of the given kind counted by
+        // the given worker thread (all worker threads if num_thread == -1),
+        // optionally only while executing HPX-threads.
+        std::int64_t get_perf_event_counter(perf_event_kind kind,
+            bool tasks_only, std::size_t num_thread, bool reset) noexcept;
 #endif
 
         virtual std::int64_t get_queue_length(
@@ -307,6 +387,30 @@ namespace hpx::threads::policies {
         std::vector<pu_mutex_type> pu_mtxs_;
 
         std::vector<util::cache_line_data<std::atomic<hpx::state>>> states_;
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+        // per worker thread steal attempts, one count per victim NUMA domain
+        std::vector<util::cache_line_data<steal_statistics>> steal_statistics_;
+#endif
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        // per worker thread latency histograms, one for each kind
+        std::vector<util::cache_line_data<
+            std::array<latency_histogram, num_latency_histogram_kinds>>>
+            latency_histograms_;
+#endif
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+        // per worker thread values accumulated per annotation
+        std::vector<util::cache_line_data<annotation_counters>>
+            annotation_counters_;
+#endif
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+        // per worker thread hardware event counters
+        std::vector<util::cache_line_data<perf_event_counters>>
+            perf_event_counters_;
+#endif
         char const* description_;
 
         thread_queue_init_parameters thread_queue_init_;
@@ -0,0 +1,133 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The kinds of steal counts collected per worker thread and per NUMA
+    /// domain of the victim if HPX_WITH_THREAD_STEALING_COUNTS is enabled.
+    HPX_CXX_CORE_EXPORT enum class steal_count_kind : std::uint8_t
+    {
+        /// the number of attempts to steal work from another queue
+        attempts = 0,
+
+        /// the number of attempts which found work to steal
+        successes = 1
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The steal attempts of one worker thread, counted separately for every
+    /// NUMA domain the victims belong to, and the time the worker thread
+    /// spent searching for work to steal without finding any. The NUMA domain
+    /// of the worker thread itself is recorded as well, which allows to
+    /// combine the statistics of all worker threads into a matrix of steals
+    /// between NUMA domains.
+    ///
+    /// The statistics are written by the owning worker thread only but may be
+    /// read (and reset) concurrently.
+    HPX_CXX_CORE_EXPORT class steal_statistics
+    {
+    public:
+        static constexpr std::size_t max_numa_domains =
+            HPX_HAVE_MAX_NUMA_DOMAIN_COUNT;
+
+        steal_statistics() noexcept
+        {
+            for (std::size_t i = 0; i != max_numa_domains; ++i)
+            {
+                attempts_[i].store(0, std::memory_order_relaxed);
+                successes_[i].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        steal_statistics(steal_statistics const&) = delete;
+        steal_statistics(steal_statistics&&) = delete;
+        steal_statistics& operator=(steal_statistics const&) = delete;
+        steal_statistics& operator=(steal_statistics&&) = delete;
+
+        // Domains beyond the supported number are folded onto the last one.
+        static constexpr std::size_t domain_index(std::size_t domain) noexcept
+        {
+            return (std::min) (domain, max_numa_domains - 1);
+        }
+
+        void set_numa_domain(std::size_t domain) noexcept
+        {
+            numa_domain_.store(
+                domain_index(domain), std::memory_order_relaxed);
+        }
+
+        std::size_t get_numa_domain() const noexcept
+        {
+            return numa_domain_.load(std::memory_order_relaxed);
+        }
+
+        void record_attempt(std::size_t victim_domain, bool success) noexcept
+        {
+            std::size_t const index = domain_index(victim_domain);
+            attempts_[index].fetch_add(1, std::memory_order_relaxed);
+            if (success)
+            {
+                successes_[index].fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        void record_failed_steal_time(std::int64_t duration) noexcept
+        {
+            failed_steal_time_.fetch_add(duration, std::memory_order_relaxed);
+        }
+
+        // Return the count of the given kind for the victims in the given
+        // NUMA domain (all NUMA domains if victim_domain == -1).
+        std::int64_t get(steal_count_kind kind, std::size_t victim_domain,
+            bool reset) noexcept
+        {
+            auto& counts = kind == steal_count_kind::attempts ? attempts_ :
+                                                                successes_;
+            if (victim_domain != static_cast<std::size_t>(-1))
+            {
+                return read(counts[domain_index(victim_domain)], reset);
+            }
+
+            std::int64_t result = 0;
+            for (auto& count : counts)
+            {
+                result += read(count, reset);
+            }
+            return result;
+        }
+
+        // Return the time (in nanoseconds) spent in unsuccessful searches for
+        // work to steal.
+        std::int64_t get_failed_steal_time(bool reset) noexcept
+        {
+            return read(failed_steal_time_, reset);
+        }
+
+    private:
+        static std::int64_t read(
+            std::atomic<std::int64_t>& value, bool reset) noexcept
+        {
+            return reset ? value.exchange(0, std::memory_order_relaxed) :
+                           value.load(std::memory_order_relaxed);
+        }
+
+        std::atomic<std::size_t> numa_domain_{0};
+        std::array<std::atomic<std::int64_t>, max_numa_domains> attempts_;
+        std::array<std::atomic<std::int64_t>, max_numa_domains> successes_;
+        std::atomic<std::int64_t> failed_steal_time_{0};
+    };
+}    // namespace hpx::threads
@@ -24,6 +24,9 @@
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
 #endif
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+#include <hpx/modules/timing.hpp>
+#endif
 
 #include <atomic>
 #include <cstddef>
@@ -136,6 +139,7 @@ namespace hpx::threads {
                 if (HPX_LIKELY(current_state_.compare_exchange_strong(tmp,
                         thread_state(state, state_ex, tag), exchange_order)))
                 {
+                    update_ready_time(state);
                     return prev_state;
                 }
 
@@ -152,8 +156,13 @@ namespace hpx::threads {
                 newstate, prev_state.state_ex(), prev_state.tag() + 1);
 
             thread_state tmp = prev_state;
-            return current_state_.compare_exchange_strong(
-                tmp, new_tagged_state, exchange_order);
+            if (current_state_.compare_exchange_strong(
+                    tmp, new_tagged_state, exchange_order))
+            {
+                update_ready_time(newstate);
+                return true;
+            }
+            return false;
         }
 
         /// The restore_state function changes the state of this thread
@@ -197,8 +206,13 @@ namespace hpx::threads {
             thread_state old_tmp(old_state.state(), state_ex, old_state.tag());
             thread_state const new_tmp(new_state.state(), state_ex, tag);
 
-            return current_state_.compare_exchange_strong(
-                old_tmp, new_tmp, load_exchange);
+            if (current_state_.compare_exchange_strong(
+                    old_tmp, new_tmp, load_exchange))
+            {
+                update_ready_time(new_state.state());
+                return true;
+            }
+            return false;
         }
 
         bool restore_state(thread_schedule_state new_state,
@@ -211,11 +225,39 @@ namespace hpx::threads {
             if (new_state != old_state.state())
                 ++tag;
 
-            return current_state_.compare_exchange_strong(old_state,
-                thread_state(new_state, state_ex, tag), load_exchange);
+            if (current_state_.compare_exchange_strong(old_state,
+                    thread_state(new_state, state_ex, tag), load_exchange))
+            {
+                update_ready_time(new_state);
+                return true;
+            }
+            return false;
         }
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        /// Return the time stamp (in nanoseconds) of the last time this
+        /// thread was made pending.
+        std::uint64_t get_ready_time() const noexcept
+        {
+            return ready_time_.load(std::memory_order_relaxed);
+        }
+#endif
+
     protected:
+        // remember when the thread was made pending to be able to measure
+        // the time it spends in the queues
+        void update_ready_time(
+            [[maybe_unused]] thread_schedule_state state) const noexcept
+        {
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+            if (state == thread_schedule_state::pending)
+            {
+                ready_time_.store(hpx::chrono::high_resolution_clock::now(),
+                    std::memory_order_relaxed);
+            }
+#endif
+        }
+
         /// The set_state function changes the extended state of this
         /// thread instance.
         ///
@@ -620,6 +662,10 @@ namespace hpx::threads {
 
         mutable std::atomic<thread_state> current_state_;
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        mutable std::atomic<std::uint64_t> ready_time_;
+#endif
+
         // Singly linked list (heap-allocated)
         std::forward_list<hpx::function<void()>> exit_funcs_;
 
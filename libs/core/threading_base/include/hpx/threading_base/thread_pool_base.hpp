@@ -13,11 +13,23 @@
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/timing.hpp>
 #include <hpx/modules/topology.hpp>
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+#include <hpx/threading_base/annotation_counters.hpp>
+#endif
 #include <hpx/threading_base/callback_notifier.hpp>
 #include <hpx/threading_base/detail/get_default_pool.hpp>
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+#include <hpx/threading_base/latency_histogram.hpp>
+#endif
 #include <hpx/threading_base/network_background_callback.hpp>
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+#include <hpx/threading_base/perf_event_counters.hpp>
+#endif
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+#include <hpx/threading_base/steal_statistics.hpp>
+#endif
 #include <hpx/threading_base/thread_init_data.hpp>
 
 #include <cstddef>
@@ -396,6 +408,41 @@ namespace hpx::threads {
         {
             return 0;
         }
+
+        // Return the number of steal attempts of the given kind of the worker
+        // threads in the NUMA domain thief_domain from victims in the NUMA
+        // domain victim_domain (all worker threads if thread_num == -1, all
+        // NUMA domains if a domain is -1).
+        std::int64_t get_steal_count(steal_count_kind kind,
+            std::size_t thief_domain, std::size_t victim_domain,
+            std::size_t thread_num, bool reset) const;
+
+        // Return the time spent in unsuccessful searches for work to steal
+        // (all worker threads if thread_num == -1).
+        std::int64_t get_failed_steal_time(
+            std::size_t thread_num, bool reset);
+#endif
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        // Add the counts of the latency histogram of the given kind of the
+        // given worker thread (all worker threads if thread_num == -1).
+        void collect_latency_histogram(latency_histogram_kind kind,
+            std::size_t thread_num, bool reset,
+            latency_histogram::counts_type& counts) const;
+#endif
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+        // Return the accumulated value of the given kind for the annotation
+        // with the given index (all worker threads if thread_num == -1).
+        std::int64_t get_annotation_counter(annotation_counter_kind kind,
+            std::size_t index, std::size_t thread_num, bool reset) const;
+#endif
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+        // Return the number of hardware events of the given kind (all worker
+        // threads if thread_num == -1).
+        std::int64_t get_perf_event_counter(perf_event_kind kind,
+            bool tasks_only, std::size_t thread_num, bool reset) const;
 #endif
         virtual std::int64_t get_thread_count(thread_schedule_state /*state*/,
             thread_priority /*priority*/, std::size_t /*num_thread*/,
@@ -0,0 +1,144 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/annotation_counters.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace hpx::threads {
+
+    namespace {
+
+        struct annotation_entry
+        {
+            std::string name;
+            std::size_t hash;
+            std::size_t index;
+        };
+
+        // process wide registry of the interned annotations
+        //
+        // Names are looked up without locking in an open addressing hash
+        // table which is never more than half full. Only the registration
+        // of a new name takes the lock, which happens at most
+        // max_annotations times.
+        struct annotation_registry
+        {
+            static constexpr std::size_t table_size = 2 * max_annotations;
+
+            annotation_registry()
+            {
+                add("<other>", std::hash<std::string_view>()("<other>"));
+            }
+
+            annotation_entry const* find(
+                std::string_view name, std::size_t hash) const noexcept
+            {
+                for (std::size_t i = hash % table_size; /**/;
+                    i = (i + 1) % table_size)
+                {
+                    annotation_entry const* entry =
+                        table_[i].load(std::memory_order_acquire);
+                    if (entry == nullptr)
+                    {
+                        return nullptr;
+                    }
+                    if (entry->hash == hash && entry->name == name)
+                    {
+                        return entry;
+                    }
+                }
+            }
+
+            // must be called with mtx_ held
+            std::size_t add(std::string_view name, std::size_t hash)
+            {
+                std::size_t const index = entries_.size();
+                entries_.push_back(
+                    annotation_entry{std::string(name), hash, index});
+
+                std::size_t i = hash % table_size;
+                while (table_[i].load(std::memory_order_relaxed) != nullptr)
+                {
+                    i = (i + 1) % table_size;
+                }
+                table_[i].store(&entries_.back(), std::memory_order_release);
+
+                count_.store(index + 1, std::memory_order_release);
+                return index;
+            }
+
+            std::mutex mtx_;
+
+            // the deque keeps the entries in place, they are referred to by
+            // the hash table
+            std::deque<annotation_entry> entries_;
+            std::array<std::atomic<annotation_entry const*>, table_size>
+                table_{};
+            std::atomic<std::size_t> count_{0};
+        };
+
+        annotation_registry& get_annotation_registry()
+        {
+            static annotation_registry registry;
+            return registry;
+        }
+    }    // namespace
+
+    std::size_t get_annotation_index(std::string_view name)
+    {
+        auto& registry = get_annotation_registry();
+
+        std::size_t const hash = std::hash<std::string_view>()(name);
+        if (auto const* entry = registry.find(name, hash); entry != nullptr)
+        {
+            return entry->index;
+        }
+
+        if (registry.count_.load(std::memory_order_acquire) ==
+            max_annotations)
+        {
+            return 0;
+        }
+
+        // the name was not seen before, register it
+        std::lock_guard<std::mutex> l(registry.mtx_);
+        if (auto const* entry = registry.find(name, hash); entry != nullptr)
+        {
+            return entry->index;
+        }
+
+        if (registry.entries_.size() == max_annotations)
+        {
+            return 0;
+        }
+        return registry.add(name, hash);
+    }
+
+    std::string get_annotation_name(std::size_t index)
+    {
+        auto& registry = get_annotation_registry();
+
+        std::lock_guard<std::mutex> l(registry.mtx_);
+        return index < registry.entries_.size() ?
+            registry.entries_[index].name :
+            std::string();
+    }
+
+    std::size_t get_annotation_count() noexcept
+    {
+        return get_annotation_registry().count_.load(
+            std::memory_order_acquire);
+    }
+}    // namespace hpx::threads
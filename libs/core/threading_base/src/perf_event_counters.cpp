@@ -0,0 +1,293 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+#include <hpx/threading_base/perf_event_counters.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#error "The perf_event counters can only be used on Linux"
+#endif
+
+namespace hpx::threads {
+
+    namespace detail {
+
+        std::atomic<std::size_t> perf_event_task_sampling(0);
+    }    // namespace detail
+
+    void set_perf_event_task_sampling(bool enable) noexcept
+    {
+        if (enable)
+        {
+            detail::perf_event_task_sampling.fetch_add(
+                1, std::memory_order_relaxed);
+            return;
+        }
+
+        // ignore releasing more requests than were made
+        std::size_t requests =
+            detail::perf_event_task_sampling.load(std::memory_order_relaxed);
+        while (requests != 0 &&
+            !detail::perf_event_task_sampling.compare_exchange_weak(
+                requests, requests - 1, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    namespace {
+
+        // type and configuration of the events, in the order of
+        // perf_event_kind
+        constexpr std::array<std::pair<std::uint32_t, std::uint64_t>,
+            num_perf_event_kinds>
+            perf_events = {{
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                {PERF_TYPE_HW_CACHE,
+                    PERF_COUNT_HW_CACHE_LL |
+                        (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            }};
+
+        int perf_event_open(std::uint32_t type, std::uint64_t config,
+            int group_fd) noexcept
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = type;
+            attr.config = config;
+            attr.read_format = PERF_FORMAT_GROUP |
+                PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+
+            // the group leader starts disabled, all others follow the leader
+            attr.disabled = group_fd == -1 ? 1 : 0;
+
+            // count the calling thread on any CPU
+            return static_cast<int>(syscall(
+                __NR_perf_event_open, &attr, 0, -1, group_fd, 0UL));
+        }
+
+        long get_tid() noexcept
+        {
+            return static_cast<long>(syscall(SYS_gettid));
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    perf_event_counters::perf_event_counters() noexcept
+      : leader_(-1)
+      , num_slots_(0)
+      , tid_(-1)
+      , task_running_(false)
+      , task_start_()
+    {
+        fds_.fill(-1);
+        slots_.fill(-1);
+        for (std::size_t i = 0; i != num_perf_event_kinds; ++i)
+        {
+            task_values_[i].store(0, std::memory_order_relaxed);
+            reset_values_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    perf_event_counters::~perf_event_counters()
+    {
+        close();
+    }
+
+    bool perf_event_counters::open()
+    {
+        long const tid = get_tid();
+
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+        if (leader_ != -1 && tid == tid_)
+        {
+            return true;
+        }
+
+        // the counters belong to an OS thread which is not running this
+        // worker anymore
+        close_locked();
+
+        for (std::size_t i = 0; i != num_perf_event_kinds; ++i)
+        {
+            fds_[i] = perf_event_open(
+                perf_events[i].first, perf_events[i].second, leader_);
+            if (fds_[i] == -1)
+            {
+                continue;    // event not supported
+            }
+
+            if (leader_ == -1)
+            {
+                leader_ = fds_[i];
+            }
+            slots_[i] = static_cast<int>(num_slots_++);
+        }
+
+        if (leader_ == -1)
+        {
+            return false;
+        }
+
+        tid_ = tid;
+        ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        return true;
+    }
+
+    void perf_event_counters::close() noexcept
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+        close_locked();
+    }
+
+    void perf_event_counters::close_locked() noexcept
+    {
+        for (std::size_t i = 0; i != num_perf_event_kinds; ++i)
+        {
+            if (fds_[i] != -1)
+            {
+                ::close(fds_[i]);
+            }
+            fds_[i] = -1;
+            slots_[i] = -1;
+        }
+
+        leader_ = -1;
+        num_slots_ = 0;
+        tid_ = -1;
+        task_running_ = false;
+
+        // the counts of newly opened counters start at zero
+        for (std::size_t i = 0; i != num_perf_event_kinds; ++i)
+        {
+            reset_values_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    bool perf_event_counters::read(values_type& values) const noexcept
+    {
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+        return read_locked(values);
+    }
+
+    bool perf_event_counters::read_locked(values_type& values) const noexcept
+    {
+        values.fill(0);
+        if (leader_ == -1)
+        {
+            return false;
+        }
+
+        // layout of the data read for PERF_FORMAT_GROUP: the number of events,
+        // the time enabled and running, followed by one value per event
+        std::array<std::uint64_t, 3 + num_perf_event_kinds> data;
+        auto const expected =
+            static_cast<ssize_t>((3 + num_slots_) * sizeof(std::uint64_t));
+        if (::read(leader_, data.data(), sizeof(data)) != expected)
+        {
+            return false;
+        }
+
+        std::uint64_t const enabled = data[1];
+        std::uint64_t const running = data[2];
+        for (std::size_t i = 0; i != num_perf_event_kinds; ++i)
+        {
+            if (slots_[i] == -1)
+            {
+                continue;
+            }
+
+            std::uint64_t value = data[3 + static_cast<std::size_t>(slots_[i])];
+            if (running != 0 && running < enabled)
+            {
+                // the hardware counters were multiplexed, extrapolate
+                value = static_cast<std::uint64_t>(static_cast<double>(value) *
+                    static_cast<double>(enabled) /
+                    static_cast<double>(running));
+            }
+            values[i] = value;
+        }
+        return true;
+    }
+
+    void perf_event_counters::stop_task() noexcept
+    {
+        if (!task_running_)
+        {
+            return;
+        }
+        task_running_ = false;
+
+        values_type values;
+        if (!read(values))
+        {
+            return;
+        }
+
+        for (std::size_t i = 0; i != num_perf_event_kinds; ++i)
+        {
+            if (values[i] > task_start_[i])
+            {
+                task_values_[i].fetch_add(
+                    values[i] - task_start_[i], std::memory_order_relaxed);
+            }
+        }
+    }
+
+    std::int64_t perf_event_counters::get(
+        perf_event_kind kind, bool tasks_only, bool reset) noexcept
+    {
+        auto const index = static_cast<std::size_t>(kind);
+        if (tasks_only)
+        {
+            auto& value = task_values_[index];
+            return static_cast<std::int64_t>(reset ?
+                    value.exchange(0, std::memory_order_relaxed) :
+                    value.load(std::memory_order_relaxed));
+        }
+
+        // the counters must not be reopened between reading them and
+        // updating the reset values
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+        values_type values;
+        if (!read_locked(values))
+        {
+            return 0;
+        }
+
+        auto& base = reset_values_[index];
+        std::uint64_t const previous = reset ?
+            base.exchange(values[index], std::memory_order_relaxed) :
+            base.load(std::memory_order_relaxed);
+        return values[index] > previous ?
+            static_cast<std::int64_t>(values[index] - previous) :
+            0;
+    }
+}    // namespace hpx::threads
+
+#endif
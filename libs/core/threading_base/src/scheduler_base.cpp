@@ -50,6 +50,18 @@ namespace hpx::threads::policies {
       , suspend_conds_(num_threads)
       , pu_mtxs_(num_threads)
       , states_(num_threads)
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+      , steal_statistics_(num_threads)
+#endif
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+      , latency_histograms_(num_threads)
+#endif
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+      , annotation_counters_(num_threads)
+#endif
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+      , perf_event_counters_(num_threads)
+#endif
       , description_(description)
       , thread_queue_init_(thread_queue_init)
       , parent_pool_(nullptr)
@@ -69,6 +81,106 @@ namespace hpx::threads::policies {
         }
     }
 
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    std::int64_t scheduler_base::get_steal_count(steal_count_kind kind,
+        std::size_t thief_domain, std::size_t victim_domain,
+        std::size_t num_thread, bool reset) noexcept
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            steal_statistics& stats = get_steal_statistics(num_thread);
+            if (thief_domain != static_cast<std::size_t>(-1) &&
+                stats.get_numa_domain() !=
+                    steal_statistics::domain_index(thief_domain))
+            {
+                return 0;
+            }
+            return stats.get(kind, victim_domain, reset);
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != steal_statistics_.size(); ++i)
+        {
+            result +=
+                get_steal_count(kind, thief_domain, victim_domain, i, reset);
+        }
+        return result;
+    }
+
+    std::int64_t scheduler_base::get_failed_steal_time(
+        std::size_t num_thread, bool reset) noexcept
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            return get_steal_statistics(num_thread).get_failed_steal_time(
+                reset);
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != steal_statistics_.size(); ++i)
+        {
+            result += get_steal_statistics(i).get_failed_steal_time(reset);
+        }
+        return result;
+    }
+#endif
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+    void scheduler_base::collect_latency_histogram(latency_histogram_kind kind,
+        std::size_t num_thread, bool reset,
+        latency_histogram::counts_type& counts) noexcept
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            get_latency_histogram(kind, num_thread).collect(counts, reset);
+            return;
+        }
+
+        for (std::size_t i = 0; i != latency_histograms_.size(); ++i)
+        {
+            get_latency_histogram(kind, i).collect(counts, reset);
+        }
+    }
+#endif
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+    std::int64_t scheduler_base::get_annotation_counter(
+        annotation_counter_kind kind, std::size_t index,
+        std::size_t num_thread, bool reset) noexcept
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            return get_annotation_counters(num_thread).get(kind, index, reset);
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != annotation_counters_.size(); ++i)
+        {
+            result += get_annotation_counters(i).get(kind, index, reset);
+        }
+        return result;
+    }
+#endif
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+    std::int64_t scheduler_base::get_perf_event_counter(perf_event_kind kind,
+        bool tasks_only, std::size_t num_thread, bool reset) noexcept
+    {
+        if (num_thread != static_cast<std::size_t>(-1))
+        {
+            return get_perf_event_counters(num_thread).get(
+                kind, tasks_only, reset);
+        }
+
+        std::int64_t result = 0;
+        for (std::size_t i = 0; i != perf_event_counters_.size(); ++i)
+        {
+            result += get_perf_event_counters(i).get(kind, tasks_only, reset);
+        }
+        return result;
+    }
+#endif
+
     bool scheduler_base::idle_callback([[maybe_unused]] std::size_t num_thread)
     {
 #if defined(HPX_HAVE_THREAD_MANAGER_IDLE_BACKOFF)
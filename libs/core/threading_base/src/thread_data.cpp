@@ -16,6 +16,7 @@
 #include <hpx/modules/tracing.hpp>
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
 #endif
@@ -55,6 +56,28 @@ namespace hpx::threads {
             // same as naming::invalid_locality_id
             return ~static_cast<std::uint32_t>(0);
         }
+
+#if defined(HPX_HAVE_TASK_TRACE)
+        namespace {
+
+            void record_create_event(thread_data const* thrd,
+                thread_description const& desc) noexcept
+            {
+                if (hpx::tracing::task_trace_enabled())
+                {
+                    std::uint64_t const name = desc.kind() ==
+                            thread_description::data_type::description ?
+                        reinterpret_cast<std::uint64_t>(
+                            desc.get_description()) :
+                        0;
+                    hpx::tracing::record_task_event(
+                        hpx::tracing::task_trace_event::create,
+                        hpx::get_worker_thread_num(),
+                        reinterpret_cast<std::uint64_t>(thrd), name);
+                }
+            }
+        }    // namespace
+#endif
     }    // namespace detail
 
     thread_data::thread_data(thread_init_data& init_data, void* queue,
@@ -78,6 +101,9 @@ namespace hpx::threads {
                 static_cast<std::int32_t>(stacksize))
       , current_state_(thread_state(
             init_data.initial_state, thread_restart_state::signaled))
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+      , ready_time_(0)
+#endif
       , scheduler_base_(init_data.scheduler_base)
       , queue_(queue)
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
@@ -119,6 +145,10 @@ namespace hpx::threads {
 #if defined(HPX_HAVE_MODULE_TRACY)
         tracy_fiber_name_[0] = '\0';
 #endif
+#if defined(HPX_HAVE_TASK_TRACE)
+        detail::record_create_event(this, init_data.description);
+#endif
+        update_ready_time(init_data.initial_state);
     }
 
     thread_data::~thread_data()
@@ -243,6 +273,7 @@ namespace hpx::threads {
 
         current_state_.store(thread_state(
             init_data.initial_state, thread_restart_state::signaled));
+        update_ready_time(init_data.initial_state);
 
 #ifdef HPX_HAVE_THREAD_DESCRIPTION
         description_ = init_data.description;
@@ -263,6 +294,9 @@ namespace hpx::threads {
 #if defined(HPX_HAVE_MODULE_TRACY)
         tracy_fiber_name_[0] = '\0';
 #endif
+#if defined(HPX_HAVE_TASK_TRACE)
+        detail::record_create_event(this, init_data.description);
+#endif
 
         LTM_(debug).format("thread::thread({}), description({}), rebind", this,
             get_description());
@@ -129,6 +129,69 @@ namespace hpx::threads {
             thread_priority::default_, num_thread, reset);
     }
 
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    std::int64_t thread_pool_base::get_steal_count(steal_count_kind kind,
+        std::size_t thief_domain, std::size_t victim_domain,
+        std::size_t thread_num, bool reset) const
+    {
+        if (policies::scheduler_base* sched = get_scheduler())
+        {
+            return sched->get_steal_count(
+                kind, thief_domain, victim_domain, thread_num, reset);
+        }
+        return 0;
+    }
+
+    std::int64_t thread_pool_base::get_failed_steal_time(
+        std::size_t thread_num, bool reset)
+    {
+        if (policies::scheduler_base* sched = get_scheduler())
+        {
+            return sched->get_failed_steal_time(thread_num, reset);
+        }
+        return 0;
+    }
+#endif
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+    void thread_pool_base::collect_latency_histogram(
+        latency_histogram_kind kind, std::size_t thread_num, bool reset,
+        latency_histogram::counts_type& counts) const
+    {
+        if (policies::scheduler_base* sched = get_scheduler())
+        {
+            sched->collect_latency_histogram(kind, thread_num, reset, counts);
+        }
+    }
+#endif
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+    std::int64_t thread_pool_base::get_annotation_counter(
+        annotation_counter_kind kind, std::size_t index,
+        std::size_t thread_num, bool reset) const
+    {
+        if (policies::scheduler_base* sched = get_scheduler())
+        {
+            return sched->get_annotation_counter(
+                kind, index, thread_num, reset);
+        }
+        return 0;
+    }
+#endif
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+    std::int64_t thread_pool_base::get_perf_event_counter(perf_event_kind kind,
+        bool tasks_only, std::size_t thread_num, bool reset) const
+    {
+        if (policies::scheduler_base* sched = get_scheduler())
+        {
+            return sched->get_perf_event_counter(
+                kind, tasks_only, thread_num, reset);
+        }
+        return 0;
+    }
+#endif
+
     std::size_t thread_pool_base::get_active_os_thread_count() const
     {
         std::size_t active_os_thread_count = 0;
@@ -0,0 +1,127 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/thread.hpp>
+#include <hpx/threading_base/annotation_counters.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace threads = hpx::threads;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_registry()
+{
+    std::cerr << "test_registry\n";
+
+    HPX_TEST_EQ(threads::get_annotation_name(0), std::string("<other>"));
+
+    std::size_t const index =
+        threads::get_annotation_index("annotation_counters_test");
+    HPX_TEST_NEQ(index, static_cast<std::size_t>(0));
+    HPX_TEST_LT(index, threads::get_annotation_count());
+    HPX_TEST_EQ(threads::get_annotation_name(index),
+        std::string("annotation_counters_test"));
+
+    // names are interned by their contents
+    std::string const name("annotation_counters_test");
+    HPX_TEST_EQ(threads::get_annotation_index(name), index);
+}
+
+void test_accumulation()
+{
+    std::cerr << "test_accumulation\n";
+
+    threads::annotation_counters counters;
+
+    std::string const name("annotation_counters_accumulate");
+    std::size_t const index = counters.get_index(name.c_str());
+    HPX_TEST_EQ(index, threads::get_annotation_index(name));
+
+    // a cached lookup yields the same index
+    HPX_TEST_EQ(counters.get_index(name.c_str()), index);
+
+    counters.record(index, 100, false);
+    counters.record(index, 200, false);
+    counters.record(index, 300, true);
+
+    HPX_TEST_EQ(
+        counters.get(threads::annotation_counter_kind::time, index, false),
+        static_cast<std::int64_t>(600));
+    HPX_TEST_EQ(
+        counters.get(threads::annotation_counter_kind::count, index, false),
+        static_cast<std::int64_t>(1));
+    HPX_TEST_EQ(counters.get(threads::annotation_counter_kind::suspensions,
+                    index, true),
+        static_cast<std::int64_t>(2));
+    HPX_TEST_EQ(counters.get(threads::annotation_counter_kind::suspensions,
+                    index, false),
+        static_cast<std::int64_t>(0));
+}
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+void test_collection()
+{
+    std::cerr << "test_collection\n";
+
+    constexpr std::size_t all_threads = static_cast<std::size_t>(-1);
+    constexpr std::size_t num_tasks = 100;
+
+    auto& pool = hpx::threads::detail::get_self_or_default_pool();
+    std::size_t const index =
+        threads::get_annotation_index("annotation_counters_collect");
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(hpx::annotated_function(
+            [] { hpx::this_thread::yield(); }, "annotation_counters_collect")));
+    }
+    hpx::wait_all(tasks);
+
+    // give the last tasks the chance to terminate
+    hpx::this_thread::yield();
+
+    HPX_TEST_LTE(static_cast<std::int64_t>(num_tasks),
+        pool.get_annotation_counter(
+            threads::annotation_counter_kind::suspensions, index, all_threads,
+            false));
+    HPX_TEST_LT(static_cast<std::int64_t>(0),
+        pool.get_annotation_counter(
+            threads::annotation_counter_kind::time, index, all_threads, false));
+    HPX_TEST_LTE(pool.get_annotation_counter(
+                     threads::annotation_counter_kind::count, index,
+                     all_threads, false),
+        static_cast<std::int64_t>(num_tasks));
+}
+#endif
+
+int hpx_main()
+{
+    test_registry();
+    test_accumulation();
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+    test_collection();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
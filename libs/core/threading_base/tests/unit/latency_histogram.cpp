@@ -0,0 +1,226 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/latency_histogram.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using hpx::threads::latency_histogram;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t total_count(latency_histogram::counts_type const& counts)
+{
+    std::uint64_t total = 0;
+    for (std::uint64_t const count : counts)
+    {
+        total += count;
+    }
+    return total;
+}
+
+void test_buckets()
+{
+    std::cerr << "test_buckets\n";
+
+    // all values fall into a bucket whose upper bound is not smaller than
+    // the value and whose predecessor's upper bound is smaller
+    for (std::uint64_t value : {std::uint64_t(0), std::uint64_t(1),
+             std::uint64_t(7), std::uint64_t(8), std::uint64_t(15),
+             std::uint64_t(16), std::uint64_t(1000),
+             std::uint64_t(123456789), ~std::uint64_t(0)})
+    {
+        std::size_t const index = latency_histogram::bucket_index(value);
+        HPX_TEST_LT(index, latency_histogram::num_buckets);
+        HPX_TEST_LTE(value, latency_histogram::bucket_upper_bound(index));
+        if (index != 0)
+        {
+            HPX_TEST_LT(
+                latency_histogram::bucket_upper_bound(index - 1), value);
+        }
+    }
+
+    // buckets are contiguous
+    for (std::size_t i = 1; i != latency_histogram::num_buckets; ++i)
+    {
+        HPX_TEST_EQ(latency_histogram::bucket_index(
+                        latency_histogram::bucket_upper_bound(i - 1) + 1),
+            i);
+    }
+}
+
+void test_percentiles()
+{
+    std::cerr << "test_percentiles\n";
+
+    latency_histogram h;
+    for (std::int64_t i = 1; i <= 1000; ++i)
+    {
+        h.record(i * 1000);
+    }
+
+    latency_histogram::counts_type counts{};
+    h.collect(counts, false);
+    HPX_TEST_EQ(total_count(counts), static_cast<std::uint64_t>(1000));
+
+    // the reported values are at most one bucket width (12.5%) too large
+    for (double const p : {50., 90., 99., 100.})
+    {
+        auto const expected = static_cast<std::int64_t>(p * 10) * 1000;
+        std::int64_t const value = latency_histogram::percentile(counts, p);
+        HPX_TEST_LTE(expected, value);
+        HPX_TEST_LTE(value, expected + expected / 8);
+    }
+
+    // negative durations are recorded as zero
+    latency_histogram h2;
+    h2.record(-1);
+    latency_histogram::counts_type counts2{};
+    h2.collect(counts2, false);
+    HPX_TEST_EQ(counts2[0], static_cast<std::uint64_t>(1));
+}
+
+void test_merge_and_reset()
+{
+    std::cerr << "test_merge_and_reset\n";
+
+    latency_histogram h1;
+    latency_histogram h2;
+    for (int i = 0; i != 90; ++i)
+    {
+        h1.record(100);
+    }
+    for (int i = 0; i != 10; ++i)
+    {
+        h2.record(1000000);
+    }
+
+    latency_histogram::counts_type counts{};
+    h1.collect(counts, true);
+    h2.collect(counts, true);
+    HPX_TEST_EQ(total_count(counts), static_cast<std::uint64_t>(100));
+
+    HPX_TEST_LTE(latency_histogram::percentile(counts, 50.),
+        static_cast<std::int64_t>(100 + 100 / 8));
+    HPX_TEST_LTE(static_cast<std::int64_t>(1000000),
+        latency_histogram::percentile(counts, 99.));
+
+    // both histograms were reset while collecting
+    latency_histogram::counts_type empty{};
+    h1.collect(empty, false);
+    h2.collect(empty, false);
+    HPX_TEST_EQ(total_count(empty), static_cast<std::uint64_t>(0));
+    HPX_TEST_EQ(latency_histogram::percentile(empty, 50.),
+        static_cast<std::int64_t>(0));
+}
+
+void test_baseline()
+{
+    std::cerr << "test_baseline\n";
+
+    // two readers of the same histogram, each resetting independently
+    latency_histogram h;
+    hpx::threads::latency_histogram_baseline b1;
+    hpx::threads::latency_histogram_baseline b2;
+
+    for (int i = 0; i != 10; ++i)
+    {
+        h.record(100);
+    }
+
+    latency_histogram::counts_type counts1{};
+    h.collect(counts1, false);
+    b1.since_last_reset(counts1, true);
+    HPX_TEST_EQ(total_count(counts1), static_cast<std::uint64_t>(10));
+
+    // the reset of the first reader doesn't affect the second one
+    latency_histogram::counts_type counts2{};
+    h.collect(counts2, false);
+    b2.since_last_reset(counts2, true);
+    HPX_TEST_EQ(total_count(counts2), static_cast<std::uint64_t>(10));
+    HPX_TEST_LTE(static_cast<std::int64_t>(100),
+        latency_histogram::percentile(counts2, 50.));
+
+    // both readers report only the values recorded after their reset
+    h.record(1000);
+
+    counts1 = {};
+    h.collect(counts1, false);
+    b1.since_last_reset(counts1, false);
+    HPX_TEST_EQ(total_count(counts1), static_cast<std::uint64_t>(1));
+    HPX_TEST_LTE(static_cast<std::int64_t>(1000),
+        latency_histogram::percentile(counts1, 50.));
+
+    counts2 = {};
+    h.collect(counts2, false);
+    b2.since_last_reset(counts2, false);
+    HPX_TEST_EQ(total_count(counts2), static_cast<std::uint64_t>(1));
+}
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+void test_collection()
+{
+    std::cerr << "test_collection\n";
+
+    using hpx::threads::latency_histogram_kind;
+
+    auto& pool = hpx::threads::detail::get_self_or_default_pool();
+    constexpr std::size_t all_threads = static_cast<std::size_t>(-1);
+
+    latency_histogram::counts_type reset{};
+    pool.collect_latency_histogram(
+        latency_histogram_kind::execution, all_threads, true, reset);
+    pool.collect_latency_histogram(
+        latency_histogram_kind::queue_wait, all_threads, true, reset);
+
+    constexpr std::size_t num_tasks = 100;
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([] {}));
+    }
+    hpx::wait_all(tasks);
+
+    latency_histogram::counts_type execution{};
+    pool.collect_latency_histogram(
+        latency_histogram_kind::execution, all_threads, false, execution);
+    HPX_TEST_LTE(static_cast<std::uint64_t>(num_tasks), total_count(execution));
+
+    latency_histogram::counts_type queue_wait{};
+    pool.collect_latency_histogram(
+        latency_histogram_kind::queue_wait, all_threads, false, queue_wait);
+    HPX_TEST_LTE(
+        static_cast<std::uint64_t>(num_tasks), total_count(queue_wait));
+}
+#endif
+
+int hpx_main()
+{
+    test_buckets();
+    test_percentiles();
+    test_merge_and_reset();
+    test_baseline();
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+    test_collection();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
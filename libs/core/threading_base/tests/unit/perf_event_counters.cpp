@@ -0,0 +1,139 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+#include <hpx/threading_base/perf_event_counters.hpp>
+
+namespace threads = hpx::threads;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t do_work()
+{
+    std::uint64_t result = 0;
+    for (std::uint64_t i = 0; i != 1000000; ++i)
+    {
+        result += i * i;
+    }
+    return result;
+}
+
+void test_counters()
+{
+    std::cerr << "test_counters\n";
+
+    threads::perf_event_counters counters;
+    if (!counters.open())
+    {
+        // the hardware events may not be available (for instance in virtual
+        // machines), all values are reported as zero in this case
+        std::cerr << "hardware events are not available\n";
+        HPX_TEST_EQ(
+            counters.get(threads::perf_event_kind::cycles, false, false),
+            static_cast<std::int64_t>(0));
+        return;
+    }
+
+    // opening the counters again on the same thread does nothing
+    HPX_TEST(counters.open());
+
+    counters.start_task();
+    HPX_TEST_NEQ(do_work(), static_cast<std::uint64_t>(0));
+    counters.stop_task();
+
+    threads::perf_event_counters::values_type values;
+    HPX_TEST(counters.read(values));
+
+    for (std::size_t i = 0; i != threads::num_perf_event_kinds; ++i)
+    {
+        auto const kind = static_cast<threads::perf_event_kind>(i);
+
+        std::int64_t const total = counters.get(kind, false, true);
+        std::int64_t const tasks = counters.get(kind, true, true);
+        HPX_TEST_LTE(static_cast<std::int64_t>(0), tasks);
+        HPX_TEST_LTE(tasks, total);
+
+        // the task values were reset
+        HPX_TEST_EQ(
+            counters.get(kind, true, false), static_cast<std::int64_t>(0));
+    }
+
+    counters.close();
+    HPX_TEST(!counters.read(values));
+}
+
+void test_task_sampling()
+{
+    std::cerr << "test_task_sampling\n";
+
+    auto& pool = hpx::threads::detail::get_self_or_default_pool();
+    constexpr std::size_t all_threads = static_cast<std::size_t>(-1);
+    constexpr auto instructions = threads::perf_event_kind::instructions;
+
+    // the requests to sample the events are counted
+    HPX_TEST(!threads::perf_event_task_sampling());
+    threads::set_perf_event_task_sampling(true);
+    threads::set_perf_event_task_sampling(true);
+    threads::set_perf_event_task_sampling(false);
+    HPX_TEST(threads::perf_event_task_sampling());
+
+    std::int64_t const before =
+        pool.get_perf_event_counter(instructions, true, all_threads, false);
+
+    std::vector<hpx::future<std::uint64_t>> tasks;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        tasks.push_back(hpx::async(&do_work));
+    }
+    hpx::wait_all(tasks);
+
+    // the events occurring while running the tasks were accumulated, if
+    // the hardware events are available at all
+    if (pool.get_perf_event_counter(instructions, false, all_threads, false) !=
+        0)
+    {
+        HPX_TEST_LT(before,
+            pool.get_perf_event_counter(
+                instructions, true, all_threads, false));
+    }
+
+    threads::set_perf_event_task_sampling(false);
+    HPX_TEST(!threads::perf_event_task_sampling());
+
+    // releasing more requests than were made has no effect
+    threads::set_perf_event_task_sampling(false);
+    threads::set_perf_event_task_sampling(true);
+    HPX_TEST(threads::perf_event_task_sampling());
+    threads::set_perf_event_task_sampling(false);
+}
+#endif
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+    test_counters();
+    test_task_sampling();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,137 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/threading_base/steal_statistics.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using hpx::threads::steal_count_kind;
+using hpx::threads::steal_statistics;
+
+constexpr std::size_t all_domains = static_cast<std::size_t>(-1);
+
+///////////////////////////////////////////////////////////////////////////////
+void test_counts()
+{
+    std::cerr << "test_counts\n";
+
+    steal_statistics stats;
+    stats.set_numa_domain(1);
+    HPX_TEST_EQ(stats.get_numa_domain(),
+        steal_statistics::domain_index(static_cast<std::size_t>(1)));
+
+    stats.record_attempt(0, true);
+    stats.record_attempt(0, false);
+    stats.record_attempt(1, false);
+
+    HPX_TEST_EQ(stats.get(steal_count_kind::attempts, 0, false),
+        static_cast<std::int64_t>(2));
+    HPX_TEST_EQ(stats.get(steal_count_kind::successes, 0, false),
+        static_cast<std::int64_t>(1));
+    HPX_TEST_EQ(stats.get(steal_count_kind::attempts, all_domains, false),
+        static_cast<std::int64_t>(3));
+    HPX_TEST_EQ(stats.get(steal_count_kind::successes, all_domains, false),
+        static_cast<std::int64_t>(1));
+
+    // domains beyond the supported number are folded onto the last one
+    stats.record_attempt(steal_statistics::max_numa_domains + 5, true);
+    HPX_TEST_EQ(stats.get(steal_count_kind::successes,
+                    steal_statistics::max_numa_domains - 1, false),
+        static_cast<std::int64_t>(1));
+
+    stats.record_failed_steal_time(100);
+    stats.record_failed_steal_time(50);
+    HPX_TEST_EQ(stats.get_failed_steal_time(true),
+        static_cast<std::int64_t>(150));
+    HPX_TEST_EQ(
+        stats.get_failed_steal_time(false), static_cast<std::int64_t>(0));
+
+    // resetting clears the counts of all domains
+    stats.get(steal_count_kind::attempts, all_domains, true);
+    HPX_TEST_EQ(stats.get(steal_count_kind::attempts, all_domains, false),
+        static_cast<std::int64_t>(0));
+}
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+void test_collection()
+{
+    std::cerr << "test_collection\n";
+
+    auto& pool = hpx::threads::detail::get_self_or_default_pool();
+    constexpr std::size_t all_threads = static_cast<std::size_t>(-1);
+
+    // the tasks are created by one worker thread, the idle worker threads
+    // try to steal them
+    constexpr std::size_t num_tasks = 1000;
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([] {}));
+    }
+    hpx::wait_all(tasks);
+
+    // the idle worker threads keep counting, read the successes first
+    std::int64_t const successes = pool.get_steal_count(
+        steal_count_kind::successes, all_domains, all_domains, all_threads,
+        false);
+    std::int64_t const attempts = pool.get_steal_count(
+        steal_count_kind::attempts, all_domains, all_domains, all_threads,
+        false);
+
+    HPX_TEST_LTE(successes, attempts);
+    if (pool.get_os_thread_count() > 1)
+    {
+        HPX_TEST_LT(static_cast<std::int64_t>(0), attempts);
+    }
+
+    // the steal matrix covers all steal attempts
+    std::int64_t matrix_attempts = 0;
+    for (std::size_t thief = 0; thief != steal_statistics::max_numa_domains;
+        ++thief)
+    {
+        for (std::size_t victim = 0;
+            victim != steal_statistics::max_numa_domains; ++victim)
+        {
+            matrix_attempts += pool.get_steal_count(
+                steal_count_kind::attempts, thief, victim, all_threads, false);
+        }
+    }
+    HPX_TEST_LTE(attempts, matrix_attempts);
+
+    // every failed search for work to steal takes some time
+    if (attempts != successes)
+    {
+        HPX_TEST_LT(static_cast<std::int64_t>(0),
+            pool.get_failed_steal_time(all_threads, false));
+    }
+}
+#endif
+
+int hpx_main()
+{
+    test_counts();
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    test_collection();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
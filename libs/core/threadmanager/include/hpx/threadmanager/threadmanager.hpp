@@ -289,6 +289,39 @@ namespace hpx::threads {
         std::int64_t get_num_stolen_from_staged(bool reset) const;
         std::int64_t get_num_stolen_to_pending(bool reset) const;
         std::int64_t get_num_stolen_to_staged(bool reset) const;
+
+        // Return the number of steal attempts of the given kind of the worker
+        // threads of all thread pools in the NUMA domain thief_domain from
+        // victims in the NUMA domain victim_domain (all NUMA domains if a
+        // domain is -1).
+        std::int64_t get_steal_count(steal_count_kind kind,
+            std::size_t thief_domain, std::size_t victim_domain,
+            bool reset) const;
+
+        // Return the time the worker threads of all thread pools spent in
+        // unsuccessful searches for work to steal.
+        std::int64_t get_failed_steal_time(bool reset) const;
+#endif
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+        // Add the counts of the latency histograms of the given kind of all
+        // worker threads of all thread pools.
+        void collect_latency_histogram(latency_histogram_kind kind,
+            bool reset, latency_histogram::counts_type& counts) const;
+#endif
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+        // Return the accumulated value of the given kind for the annotation
+        // with the given index over all worker threads of all thread pools.
+        std::int64_t get_annotation_counter(annotation_counter_kind kind,
+            std::size_t index, bool reset) const;
+#endif
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+        // Return the number of hardware events of the given kind counted by
+        // all worker threads of all thread pools.
+        std::int64_t get_perf_event_counter(
+            perf_event_kind kind, bool tasks_only, bool reset) const;
 #endif
 
     private:
@@ -1516,6 +1516,69 @@ namespace hpx::threads {
             result += pool_iter->get_num_stolen_to_staged(all_threads, reset);
         return result;
     }
+
+    std::int64_t threadmanager::get_steal_count(steal_count_kind kind,
+        std::size_t thief_domain, std::size_t victim_domain,
+        bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            result += pool_iter->get_steal_count(
+                kind, thief_domain, victim_domain, all_threads, reset);
+        }
+        return result;
+    }
+
+    std::int64_t threadmanager::get_failed_steal_time(bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            result += pool_iter->get_failed_steal_time(all_threads, reset);
+        }
+        return result;
+    }
+#endif
+
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+    void threadmanager::collect_latency_histogram(latency_histogram_kind kind,
+        bool reset, latency_histogram::counts_type& counts) const
+    {
+        for (auto const& pool_iter : pools_)
+        {
+            pool_iter->collect_latency_histogram(
+                kind, all_threads, reset, counts);
+        }
+    }
+#endif
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+    std::int64_t threadmanager::get_annotation_counter(
+        annotation_counter_kind kind, std::size_t index, bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            result += pool_iter->get_annotation_counter(
+                kind, index, all_threads, reset);
+        }
+        return result;
+    }
+#endif
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+    std::int64_t threadmanager::get_perf_event_counter(
+        perf_event_kind kind, bool tasks_only, bool reset) const
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+        {
+            result += pool_iter->get_perf_event_counter(
+                kind, tasks_only, all_threads, reset);
+        }
+        return result;
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
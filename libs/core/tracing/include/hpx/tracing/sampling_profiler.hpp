@@ -0,0 +1,108 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file sampling_profiler.hpp
+/// \brief Built-in statistical profiler for HPX-threads.
+///
+/// The sampling profiler periodically interrupts all threads consuming CPU
+/// time (using SIGPROF). Every sample records the HPX-thread currently running
+/// on the interrupted OS thread, its annotation, and the call stack of the
+/// interrupted code found by walking the frame pointers of the (coroutine)
+/// stack. A background thread aggregates the samples, they are written as
+/// folded stacks (one line per distinct stack, rooted at the annotation of the
+/// HPX-thread) suitable for flamegraph.pl or speedscope when the profiler is
+/// stopped. The profiler is available only on Linux and if HPX was configured
+/// with HPX_WITH_SAMPLING_PROFILER=ON.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx::tracing {
+
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+    namespace detail {
+
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT extern std::atomic<bool>
+            sampling_profiler_enabled;
+
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void set_sampled_task(
+            std::uint64_t id, char const* annotation) noexcept;
+    }    // namespace detail
+
+    /// Return whether the sampling profiler is currently active.
+    HPX_CXX_CORE_EXPORT inline bool sampling_profiler_enabled() noexcept
+    {
+        return detail::sampling_profiler_enabled.load(
+            std::memory_order_relaxed);
+    }
+
+    /// Attribute all samples taken on the calling OS thread to the given
+    /// HPX-thread (an \a id of zero denotes that no HPX-thread is running).
+    /// The \a annotation has to stay valid until the profiler is stopped.
+    HPX_CXX_CORE_EXPORT inline void set_sampled_task(
+        std::uint64_t id, char const* annotation = nullptr) noexcept
+    {
+        detail::set_sampled_task(id, annotation);
+    }
+
+    /// Start sampling all threads \a frequency times per second of consumed
+    /// CPU time. If \a per_task is true, the samples of different HPX-threads
+    /// are kept apart in the output. Returns false if the file could not be
+    /// opened or the profiler is already active.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT bool start_sampling_profiler(
+        std::string const& filename, std::size_t frequency = 100,
+        bool per_task = false);
+
+    /// Stop sampling, write the folded stacks and close the file.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void stop_sampling_profiler();
+
+    /// Return the number of samples taken since the profiler was last
+    /// started.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::uint64_t
+    get_sampling_profiler_samples() noexcept;
+
+    /// Return the number of samples dropped because the aggregating thread
+    /// could not keep up since the profiler was last started.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::uint64_t
+    get_sampling_profiler_dropped_samples() noexcept;
+#else
+    HPX_CXX_CORE_EXPORT constexpr bool sampling_profiler_enabled() noexcept
+    {
+        return false;
+    }
+
+    HPX_CXX_CORE_EXPORT constexpr void set_sampled_task(
+        std::uint64_t, char const* = nullptr) noexcept
+    {
+    }
+
+    HPX_CXX_CORE_EXPORT inline bool start_sampling_profiler(
+        std::string const&, std::size_t = 100, bool = false)
+    {
+        return false;
+    }
+
+    HPX_CXX_CORE_EXPORT inline void stop_sampling_profiler() {}
+
+    HPX_CXX_CORE_EXPORT constexpr std::uint64_t
+    get_sampling_profiler_samples() noexcept
+    {
+        return 0;
+    }
+
+    HPX_CXX_CORE_EXPORT constexpr std::uint64_t
+    get_sampling_profiler_dropped_samples() noexcept
+    {
+        return 0;
+    }
+#endif
+}    // namespace hpx::tracing
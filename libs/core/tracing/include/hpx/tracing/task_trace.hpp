@@ -0,0 +1,131 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file task_trace.hpp
+/// \brief Built-in recorder for task scheduling events.
+///
+/// The task trace recorder writes task create/start/suspend/resume/finish,
+/// steal and parcel send/receive events into per-OS-thread lock-free ring
+/// buffers. A background thread periodically drains the buffers into a compact
+/// binary file that can be converted into the Chrome/Perfetto trace format
+/// using tools/hpx_trace_to_json.py. The recorder is available only if HPX was
+/// configured with HPX_WITH_TASK_TRACE=ON.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx::tracing {
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// The kinds of events recorded by the task trace recorder.
+    HPX_CXX_CORE_EXPORT enum class task_trace_event : std::uint8_t
+    {
+        create = 0,            ///< a task was created, data: description
+        start = 1,             ///< a task started running for the first time
+        suspend = 2,           ///< a task yielded or was suspended
+        resume = 3,            ///< a suspended task continued running
+        finish = 4,            ///< a task ran to completion
+        steal = 5,             ///< a task was stolen, data: victim queue
+        parcel_send = 6,       ///< a parcel was sent, data: destination
+        parcel_receive = 7,    ///< a parcel was received, data: source
+
+        // records written to the trace file only
+        name = 0x80,    ///< defines the string referenced by 'data'
+        end = 0x81      ///< the last record of a trace file
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// A single entry of the trace, this is also the on-disk format (in native
+    /// byte order) of every record following the file header.
+    HPX_CXX_CORE_EXPORT struct task_trace_record
+    {
+        std::uint64_t timestamp;    ///< hardware time stamp (ticks)
+        std::uint64_t id;           ///< task (or parcel) identifier
+        std::uint64_t data;         ///< event specific data
+        std::uint16_t worker;       ///< sequence number of the worker thread
+        task_trace_event event;
+        std::uint8_t reserved[5];
+    };
+
+    static_assert(sizeof(task_trace_record) == 32,
+        "the size of the trace records is part of the file format");
+
+#if defined(HPX_HAVE_TASK_TRACE)
+    namespace detail {
+
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT extern std::atomic<bool>
+            task_trace_enabled;
+
+        HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void record_task_event(
+            task_trace_event event, std::size_t worker, std::uint64_t id,
+            std::uint64_t data) noexcept;
+    }    // namespace detail
+
+    /// Return whether the task trace recorder is currently active.
+    HPX_CXX_CORE_EXPORT inline bool task_trace_enabled() noexcept
+    {
+        return detail::task_trace_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Record an event. This does nothing if the recorder is not active. If
+    /// the ring buffer of the calling thread is full, the event is dropped.
+    HPX_CXX_CORE_EXPORT inline void record_task_event(task_trace_event event,
+        std::size_t worker, std::uint64_t id, std::uint64_t data = 0) noexcept
+    {
+        if (task_trace_enabled())
+        {
+            detail::record_task_event(event, worker, id, data);
+        }
+    }
+
+    /// Start recording events into the given file. \a buffer_size is the
+    /// number of records each thread can buffer (rounded up to a power of
+    /// two), \a flush_interval is the time in milliseconds between two
+    /// flushes of the buffers. Returns false if the file could not be opened
+    /// or the recorder is already active.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT bool start_task_trace(
+        std::string const& filename, std::size_t buffer_size = 65536,
+        std::size_t flush_interval = 100);
+
+    /// Stop recording events, flush all buffered records and close the file.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT void stop_task_trace();
+
+    /// Return the number of events dropped because of full ring buffers
+    /// since the recorder was last started.
+    HPX_CXX_CORE_EXPORT HPX_CORE_EXPORT std::uint64_t
+    get_task_trace_dropped_events() noexcept;
+#else
+    HPX_CXX_CORE_EXPORT constexpr bool task_trace_enabled() noexcept
+    {
+        return false;
+    }
+
+    HPX_CXX_CORE_EXPORT constexpr void record_task_event(task_trace_event,
+        std::size_t, std::uint64_t, std::uint64_t = 0) noexcept
+    {
+    }
+
+    HPX_CXX_CORE_EXPORT inline bool start_task_trace(
+        std::string const&, std::size_t = 65536, std::size_t = 100)
+    {
+        return false;
+    }
+
+    HPX_CXX_CORE_EXPORT inline void stop_task_trace() {}
+
+    HPX_CXX_CORE_EXPORT constexpr std::uint64_t
+    get_task_trace_dropped_events() noexcept
+    {
+        return 0;
+    }
+#endif
+}    // namespace hpx::tracing
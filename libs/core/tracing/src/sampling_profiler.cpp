@@ -0,0 +1,582 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/tracing/sampling_profiler.hpp>
+
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <ucontext.h>
+#include <unistd.h>
+#else
+#error "The sampling profiler can only be used on Linux"
+#endif
+
+namespace hpx::tracing {
+
+    namespace {
+
+        // maximal number of frames recorded per sample
+        constexpr std::size_t max_frames = 32;
+
+        // maximal distance between two consecutive frames
+        constexpr std::uintptr_t max_frame_size = 16 * 1024 * 1024;
+
+        struct sample
+        {
+            std::uint64_t task;
+            char const* annotation;
+            std::size_t num_frames;
+            std::uintptr_t frames[max_frames];    // innermost frame first
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        // Bounded multi producer (the signal handlers), single consumer (the
+        // aggregating thread) queue. All operations are lock-free, which makes
+        // pushing samples async-signal-safe.
+        struct sample_queue
+        {
+            struct slot
+            {
+                std::atomic<std::uint64_t> sequence;
+                sample data;
+            };
+
+            explicit sample_queue(std::size_t capacity)
+              : slots(new slot[capacity])
+              , mask(capacity - 1)
+            {
+                for (std::size_t i = 0; i != capacity; ++i)
+                {
+                    slots[i].sequence.store(i, std::memory_order_relaxed);
+                }
+            }
+
+            bool push(sample const& s) noexcept
+            {
+                std::uint64_t pos = head.load(std::memory_order_relaxed);
+                slot* current = nullptr;
+                while (true)
+                {
+                    current = &slots[pos & mask];
+                    std::uint64_t const seq =
+                        current->sequence.load(std::memory_order_acquire);
+                    auto const diff = static_cast<std::int64_t>(seq - pos);
+                    if (diff == 0)
+                    {
+                        if (head.compare_exchange_weak(
+                                pos, pos + 1, std::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else if (diff < 0)
+                    {
+                        return false;    // full
+                    }
+                    else
+                    {
+                        pos = head.load(std::memory_order_relaxed);
+                    }
+                }
+
+                current->data = s;
+                current->sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+
+            bool pop(sample& s) noexcept
+            {
+                std::uint64_t const pos = tail.load(std::memory_order_relaxed);
+                slot& current = slots[pos & mask];
+                if (current.sequence.load(std::memory_order_acquire) !=
+                    pos + 1)
+                {
+                    return false;    // empty
+                }
+
+                s = current.data;
+                current.sequence.store(
+                    pos + mask + 1, std::memory_order_release);
+                tail.store(pos + 1, std::memory_order_relaxed);
+                return true;
+            }
+
+            std::unique_ptr<slot[]> slots;
+            std::uint64_t mask;
+
+            alignas(hpx::threads::get_cache_line_size())
+                std::atomic<std::uint64_t> head{0};
+            alignas(hpx::threads::get_cache_line_size())
+                std::atomic<std::uint64_t> tail{0};
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        // The HPX-thread running on an OS thread. This is accessed from the
+        // signal handler, thus it must not require any dynamic initialization
+        // and it must be allocated in the static TLS block.
+        struct sampled_task_context
+        {
+            std::uint64_t task;
+            char const* annotation;
+        };
+
+#if defined(__GNUC__)
+        [[gnu::tls_model("initial-exec")]]
+#endif
+        thread_local sampled_task_context current_task = {0, nullptr};
+
+        ////////////////////////////////////////////////////////////////////////
+        struct sampling_profiler
+        {
+            std::unique_ptr<sample_queue> queue;
+            std::atomic<std::uint64_t> samples{0};
+            std::atomic<std::uint64_t> dropped{0};
+
+            // reading the frames through process_vm_readv turns invalid frame
+            // pointers into errors instead of crashes
+            pid_t pid = 0;
+            bool safe_reads = false;
+
+            // state of the aggregating thread
+            std::mutex mtx;
+            std::thread aggregator;
+            std::condition_variable cond;
+            bool stop = false;
+
+            // the collected stacks: task, annotation, followed by the frames
+            bool per_task = false;
+            std::map<std::vector<std::uintptr_t>, std::uint64_t> stacks;
+
+            std::FILE* file = nullptr;
+
+            void aggregate()
+            {
+                sample s;
+                std::vector<std::uintptr_t> key;
+                while (queue->pop(s))
+                {
+                    key.clear();
+                    key.push_back(per_task ? s.task : (s.task != 0 ? 1 : 0));
+                    key.push_back(reinterpret_cast<std::uintptr_t>(
+                        s.task != 0 ? s.annotation : nullptr));
+                    key.insert(key.end(), s.frames, s.frames + s.num_frames);
+                    ++stacks[key];
+                }
+            }
+
+            void run_aggregator()
+            {
+                // samples of the aggregating thread itself are not of interest
+                sigset_t set;
+                sigemptyset(&set);
+                sigaddset(&set, SIGPROF);
+                pthread_sigmask(SIG_BLOCK, &set, nullptr);
+
+                std::unique_lock<std::mutex> l(mtx);
+                while (!stop)
+                {
+                    cond.wait_for(l, std::chrono::milliseconds(10));
+                    aggregate();
+                }
+            }
+
+            void write_folded_stacks();
+        };
+
+        sampling_profiler& get_profiler()
+        {
+            static sampling_profiler profiler;
+            return profiler;
+        }
+
+        std::mutex& get_start_stop_mutex()
+        {
+            static std::mutex mtx;
+            return mtx;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        bool read_frame(sampling_profiler const& profiler,
+            std::uintptr_t address, std::uintptr_t (&frame)[2]) noexcept
+        {
+            iovec local = {&frame, sizeof(frame)};
+            iovec remote = {reinterpret_cast<void*>(address), sizeof(frame)};
+            return process_vm_readv(profiler.pid, &local, 1, &remote, 1, 0) ==
+                static_cast<ssize_t>(sizeof(frame));
+        }
+
+        // Walk the frame pointer chain starting at the interrupted code. Both
+        // on x86-64 and AArch64 a frame record consists of the frame pointer
+        // of the caller followed by the return address.
+        std::size_t walk_stack(sampling_profiler const& profiler,
+            void const* context, std::uintptr_t* frames) noexcept
+        {
+            auto const* uc = static_cast<ucontext_t const*>(context);
+#if defined(__x86_64__)
+            auto const pc =
+                static_cast<std::uintptr_t>(uc->uc_mcontext.gregs[REG_RIP]);
+            auto fp =
+                static_cast<std::uintptr_t>(uc->uc_mcontext.gregs[REG_RBP]);
+            auto sp =
+                static_cast<std::uintptr_t>(uc->uc_mcontext.gregs[REG_RSP]);
+#elif defined(__aarch64__)
+            auto const pc = static_cast<std::uintptr_t>(uc->uc_mcontext.pc);
+            auto fp = static_cast<std::uintptr_t>(uc->uc_mcontext.regs[29]);
+            auto sp = static_cast<std::uintptr_t>(uc->uc_mcontext.sp);
+#else
+            std::uintptr_t const pc = 0;
+            std::uintptr_t fp = 0;
+            std::uintptr_t sp = 0;
+#endif
+            if (pc == 0)
+            {
+                return 0;
+            }
+
+            std::size_t num_frames = 0;
+            frames[num_frames++] = pc;
+            if (!profiler.safe_reads)
+            {
+                return num_frames;
+            }
+
+            while (num_frames != max_frames)
+            {
+                // frames are aligned and located just above the stack pointer
+                if (fp % sizeof(std::uintptr_t) != 0 || fp < sp ||
+                    fp - sp > max_frame_size)
+                {
+                    break;
+                }
+
+                std::uintptr_t frame[2];
+                if (!read_frame(profiler, fp, frame) || frame[1] == 0)
+                {
+                    break;
+                }
+
+                frames[num_frames++] = frame[1];
+                sp = fp;
+                fp = frame[0];
+            }
+            return num_frames;
+        }
+
+        void handle_sigprof(int, siginfo_t*, void* context) noexcept
+        {
+            // pairs with the release store in start_sampling_profiler, makes
+            // the profiler state set up before visible to this handler
+            if (!detail::sampling_profiler_enabled.load(
+                    std::memory_order_acquire))
+            {
+                return;
+            }
+
+            int const saved_errno = errno;
+
+            sampling_profiler& profiler = get_profiler();
+
+            sample s;
+            s.task = current_task.task;
+            s.annotation = current_task.annotation;
+            s.num_frames = walk_stack(profiler, context, s.frames);
+
+            if (profiler.queue->push(s))
+            {
+                profiler.samples.fetch_add(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                profiler.dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            errno = saved_errno;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Symbolize a code address, return addresses point behind the call
+        // instruction and are adjusted to refer to the call itself.
+        std::string symbolize(std::uintptr_t address, bool return_address)
+        {
+            if (return_address)
+            {
+                --address;
+            }
+
+            std::string name;
+            Dl_info info;
+            if (dladdr(reinterpret_cast<void*>(address), &info) != 0)
+            {
+                if (info.dli_sname != nullptr)
+                {
+                    int status = 0;
+                    char* demangled = abi::__cxa_demangle(
+                        info.dli_sname, nullptr, nullptr, &status);
+                    name = status == 0 ? demangled : info.dli_sname;
+                    std::free(demangled);
+                }
+                else if (info.dli_fname != nullptr)
+                {
+                    char const* module = std::strrchr(info.dli_fname, '/');
+                    char buffer[32];
+                    std::snprintf(buffer, sizeof(buffer), "+0x%zx",
+                        static_cast<std::size_t>(address -
+                            reinterpret_cast<std::uintptr_t>(
+                                info.dli_fbase)));
+                    name = module != nullptr ? module + 1 : info.dli_fname;
+                    name += buffer;
+                }
+            }
+
+            if (name.empty())
+            {
+                char buffer[32];
+                std::snprintf(buffer, sizeof(buffer), "0x%zx",
+                    static_cast<std::size_t>(address));
+                name = buffer;
+            }
+
+            // semicolons separate the frames of a folded stack
+            std::replace(name.begin(), name.end(), ';', ':');
+            return name;
+        }
+
+        void sampling_profiler::write_folded_stacks()
+        {
+            std::unordered_map<std::uintptr_t, std::string> symbols;
+            auto const lookup = [&](std::uintptr_t address,
+                                    bool return_address) -> std::string const& {
+                // leaf addresses and return addresses are symbolized
+                // differently, the lowest bit keeps them apart in the cache
+                std::uintptr_t const key = (address << 1) | return_address;
+                auto it = symbols.find(key);
+                if (it == symbols.end())
+                {
+                    it = symbols
+                             .emplace(key, symbolize(address, return_address))
+                             .first;
+                }
+                return it->second;
+            };
+
+            // different addresses within the same functions collapse into
+            // the same folded stack
+            std::map<std::string, std::uint64_t> folded;
+            std::string line;
+            for (auto const& [key, count] : stacks)
+            {
+                std::uintptr_t const task = key[0];
+                auto const* annotation = reinterpret_cast<char const*>(key[1]);
+
+                if (task == 0)
+                {
+                    line = "[os-thread]";
+                }
+                else
+                {
+                    line = annotation != nullptr ? annotation : "<unknown>";
+                    std::replace(line.begin(), line.end(), ';', ':');
+                    if (per_task)
+                    {
+                        char buffer[32];
+                        std::snprintf(buffer, sizeof(buffer), " [0x%zx]",
+                            static_cast<std::size_t>(task));
+                        line += buffer;
+                    }
+                }
+
+                // folded stacks start at the outermost frame
+                for (std::size_t i = key.size() - 1; i >= 2; --i)
+                {
+                    line += ';';
+                    line += lookup(key[i], i != 2);
+                }
+                folded[line] += count;
+            }
+
+            for (auto const& [stack, count] : folded)
+            {
+                std::fprintf(file, "%s %llu\n", stack.c_str(),
+                    static_cast<unsigned long long>(count));
+            }
+        }
+    }    // namespace
+
+    namespace detail {
+
+        std::atomic<bool> sampling_profiler_enabled(false);
+
+        void set_sampled_task(
+            std::uint64_t id, char const* annotation) noexcept
+        {
+            // the signal handler may interrupt this thread at any point,
+            // make sure it never sees a new id with a stale annotation
+            current_task.task = 0;
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            current_task.annotation = annotation;
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+            current_task.task = id;
+        }
+    }    // namespace detail
+
+    ////////////////////////////////////////////////////////////////////////////
+    bool start_sampling_profiler(
+        std::string const& filename, std::size_t frequency, bool per_task)
+    {
+        std::lock_guard<std::mutex> ll(get_start_stop_mutex());
+
+        sampling_profiler& profiler = get_profiler();
+        if (profiler.file != nullptr)
+        {
+            return false;    // already active
+        }
+
+        std::FILE* file = std::fopen(filename.c_str(), "w");
+        if (file == nullptr)
+        {
+            return false;
+        }
+
+        // process_vm_readv might be prohibited (e.g. by seccomp filters), in
+        // this case only the interrupted instruction is recorded
+        profiler.pid = getpid();
+        {
+            std::uintptr_t frame[2] = {0, 0};
+            profiler.safe_reads = read_frame(
+                profiler, reinterpret_cast<std::uintptr_t>(&frame), frame);
+        }
+
+        {
+            std::lock_guard<std::mutex> l(profiler.mtx);
+
+            // the queue holds the samples of 64 threads for one aggregation
+            // period at 1kHz
+            if (!profiler.queue)
+            {
+                profiler.queue = std::make_unique<sample_queue>(1024);
+            }
+
+            // discard samples taken while the profiler was being stopped
+            sample s;
+            while (profiler.queue->pop(s))
+            {
+            }
+            profiler.samples.store(0, std::memory_order_relaxed);
+            profiler.dropped.store(0, std::memory_order_relaxed);
+            profiler.per_task = per_task;
+            profiler.stacks.clear();
+            profiler.stop = false;
+            profiler.file = file;
+        }
+
+        // the handler is never uninstalled, a signal which is still pending
+        // when the profiler is stopped would otherwise terminate the process
+        static bool const handler_installed = [] {
+            struct sigaction action;
+            std::memset(&action, 0, sizeof(action));
+            action.sa_sigaction = &handle_sigprof;
+            action.sa_flags = SA_SIGINFO | SA_RESTART;
+            sigemptyset(&action.sa_mask);
+            return sigaction(SIGPROF, &action, nullptr) == 0;
+        }();
+
+        // signals arriving before the profiler is enabled are ignored
+        frequency = (std::clamp) (frequency, static_cast<std::size_t>(1),
+            static_cast<std::size_t>(1000000));
+        std::size_t const period = 1000000 / frequency;    // microseconds
+
+        itimerval timer;
+        timer.it_interval.tv_sec = static_cast<time_t>(period / 1000000);
+        timer.it_interval.tv_usec =
+            static_cast<suseconds_t>(period % 1000000);
+        timer.it_value = timer.it_interval;
+
+        if (!handler_installed || setitimer(ITIMER_PROF, &timer, nullptr) != 0)
+        {
+            std::fclose(file);
+            profiler.file = nullptr;
+            return false;
+        }
+
+        profiler.aggregator =
+            std::thread([&profiler] { profiler.run_aggregator(); });
+
+        // publish the profiler state to the signal handler
+        detail::sampling_profiler_enabled.store(
+            true, std::memory_order_release);
+
+        return true;
+    }
+
+    void stop_sampling_profiler()
+    {
+        std::lock_guard<std::mutex> ll(get_start_stop_mutex());
+
+        sampling_profiler& profiler = get_profiler();
+        if (profiler.file == nullptr)
+        {
+            return;
+        }
+
+        itimerval timer;
+        std::memset(&timer, 0, sizeof(timer));
+        setitimer(ITIMER_PROF, &timer, nullptr);
+
+        detail::sampling_profiler_enabled.store(
+            false, std::memory_order_release);
+
+        {
+            std::lock_guard<std::mutex> l(profiler.mtx);
+            profiler.stop = true;
+        }
+        profiler.cond.notify_all();
+        profiler.aggregator.join();
+
+        std::lock_guard<std::mutex> l(profiler.mtx);
+        profiler.aggregate();
+        profiler.write_folded_stacks();
+        profiler.stacks.clear();
+
+        std::fclose(profiler.file);
+        profiler.file = nullptr;
+    }
+
+    std::uint64_t get_sampling_profiler_samples() noexcept
+    {
+        return get_profiler().samples.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t get_sampling_profiler_dropped_samples() noexcept
+    {
+        return get_profiler().dropped.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::tracing
+#endif
@@ -0,0 +1,339 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/tracing/task_trace.hpp>
+
+#if defined(HPX_HAVE_TASK_TRACE)
+#include <hpx/hardware/timestamp.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace hpx::tracing {
+
+    namespace {
+
+        ////////////////////////////////////////////////////////////////////////
+        // Single producer (the owning OS thread), single consumer (the
+        // flushing thread) ring buffer.
+        struct ring_buffer
+        {
+            explicit ring_buffer(std::size_t capacity)
+              : records(capacity)
+              , mask(capacity - 1)
+            {
+            }
+
+            alignas(hpx::threads::get_cache_line_size())
+                std::atomic<std::uint64_t> head{0};
+            alignas(hpx::threads::get_cache_line_size())
+                std::atomic<std::uint64_t> tail{0};
+
+            std::vector<task_trace_record> records;
+            std::uint64_t mask;
+        };
+
+        struct file_header
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t record_size;
+            std::uint64_t timestamp_start;    // ticks
+            std::uint64_t time_start;         // nanoseconds
+        };
+
+        static_assert(sizeof(file_header) == 32);
+
+        std::uint64_t steady_time() noexcept
+        {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        struct task_trace_recorder
+        {
+            // registration of the ring buffers of the producing threads
+            std::mutex mtx;
+            std::vector<std::unique_ptr<ring_buffer>> rings;
+
+            // Ring buffers are never deallocated as producing threads might
+            // still refer to them after the recorder was stopped.
+            std::vector<std::unique_ptr<ring_buffer>> retired_rings;
+
+            std::atomic<std::size_t> generation{0};
+            std::size_t capacity = 0;
+            std::atomic<std::uint64_t> dropped{0};
+
+            // state of the flushing thread
+            std::thread flusher;
+            std::condition_variable cond;
+            bool stop = false;
+            std::chrono::milliseconds flush_interval{100};
+
+            std::FILE* file = nullptr;
+            std::unordered_set<std::uint64_t> names;
+            std::vector<task_trace_record> pending;
+            std::vector<ring_buffer*> flushed_rings;
+
+            ring_buffer* register_thread()
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                rings.push_back(std::make_unique<ring_buffer>(capacity));
+                return rings.back().get();
+            }
+
+            void write_name(std::uint64_t name)
+            {
+                if (name == 0 || !names.insert(name).second)
+                {
+                    return;
+                }
+
+                char const* str = reinterpret_cast<char const*>(name);
+                std::size_t const len = std::strlen(str);
+
+                task_trace_record rec{};
+                rec.id = name;
+                rec.data = len;
+                rec.event = task_trace_event::name;
+                std::fwrite(&rec, sizeof(rec), 1, file);
+
+                // the string is padded to a multiple of the record size
+                std::size_t const padded = (len + sizeof(rec) - 1) /
+                    sizeof(rec) * sizeof(rec);
+                std::vector<char> buffer(padded, '\0');
+                std::memcpy(buffer.data(), str, len);
+                std::fwrite(buffer.data(), 1, padded, file);
+            }
+
+            // The list of ring buffers is copied while holding mtx, the
+            // records are written without holding it to not block threads
+            // registering their ring buffers during the I/O.
+            void flush()
+            {
+                {
+                    std::lock_guard<std::mutex> l(mtx);
+                    flushed_rings.clear();
+                    for (auto& ring : rings)
+                    {
+                        flushed_rings.push_back(ring.get());
+                    }
+                }
+
+                for (ring_buffer* ring : flushed_rings)
+                {
+                    std::uint64_t const head =
+                        ring->head.load(std::memory_order_acquire);
+                    std::uint64_t const tail =
+                        ring->tail.load(std::memory_order_relaxed);
+
+                    pending.clear();
+                    for (std::uint64_t i = tail; i != head; ++i)
+                    {
+                        pending.push_back(ring->records[i & ring->mask]);
+                    }
+                    ring->tail.store(head, std::memory_order_release);
+
+                    for (task_trace_record const& rec : pending)
+                    {
+                        if (rec.event == task_trace_event::create)
+                        {
+                            write_name(rec.data);
+                        }
+                    }
+                    std::fwrite(pending.data(), sizeof(task_trace_record),
+                        pending.size(), file);
+                }
+                std::fflush(file);
+            }
+
+            void run_flusher()
+            {
+                std::unique_lock<std::mutex> l(mtx);
+                while (!stop)
+                {
+                    cond.wait_for(l, flush_interval);
+
+                    l.unlock();
+                    flush();
+                    l.lock();
+                }
+            }
+        };
+
+        task_trace_recorder& get_recorder()
+        {
+            static task_trace_recorder recorder;
+            return recorder;
+        }
+
+        std::mutex& get_start_stop_mutex()
+        {
+            static std::mutex mtx;
+            return mtx;
+        }
+    }    // namespace
+
+    namespace detail {
+
+        std::atomic<bool> task_trace_enabled(false);
+
+        void record_task_event(task_trace_event event, std::size_t worker,
+            std::uint64_t id, std::uint64_t data) noexcept
+        {
+            static thread_local ring_buffer* ring = nullptr;
+            static thread_local std::size_t generation = 0;
+
+            task_trace_recorder& recorder = get_recorder();
+            std::size_t const current =
+                recorder.generation.load(std::memory_order_acquire);
+            if (ring == nullptr || generation != current)
+            {
+                try
+                {
+                    ring = recorder.register_thread();
+                    generation = current;
+                }
+                catch (...)
+                {
+                    ring = nullptr;
+                    recorder.dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            std::uint64_t const head =
+                ring->head.load(std::memory_order_relaxed);
+            if (head - ring->tail.load(std::memory_order_acquire) >
+                ring->mask)
+            {
+                recorder.dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            task_trace_record& rec = ring->records[head & ring->mask];
+            rec.timestamp = hpx::util::hardware::timestamp();
+            rec.id = id;
+            rec.data = data;
+            rec.worker = static_cast<std::uint16_t>(worker);
+            rec.event = event;
+
+            ring->head.store(head + 1, std::memory_order_release);
+        }
+    }    // namespace detail
+
+    ////////////////////////////////////////////////////////////////////////////
+    bool start_task_trace(std::string const& filename,
+        std::size_t buffer_size, std::size_t flush_interval)
+    {
+        std::lock_guard<std::mutex> ll(get_start_stop_mutex());
+
+        task_trace_recorder& recorder = get_recorder();
+        if (recorder.file != nullptr)
+        {
+            return false;    // already active
+        }
+
+        std::FILE* file = std::fopen(filename.c_str(), "wb");
+        if (file == nullptr)
+        {
+            return false;
+        }
+
+        file_header header{};
+        std::memcpy(header.magic, "HPXTRC01", sizeof(header.magic));
+        header.version = 1;
+        header.record_size = sizeof(task_trace_record);
+        header.timestamp_start = hpx::util::hardware::timestamp();
+        header.time_start = steady_time();
+        std::fwrite(&header, sizeof(header), 1, file);
+
+        std::size_t capacity = 2;
+        while (capacity < buffer_size)
+        {
+            capacity *= 2;
+        }
+
+        {
+            std::lock_guard<std::mutex> l(recorder.mtx);
+
+            // let all threads register a new ring buffer
+            std::move(recorder.rings.begin(), recorder.rings.end(),
+                std::back_inserter(recorder.retired_rings));
+            recorder.rings.clear();
+            recorder.generation.fetch_add(1, std::memory_order_release);
+
+            recorder.capacity = capacity;
+            recorder.flush_interval = std::chrono::milliseconds(
+                (std::max) (flush_interval, static_cast<std::size_t>(1)));
+            recorder.dropped.store(0, std::memory_order_relaxed);
+            recorder.names.clear();
+            recorder.stop = false;
+            recorder.file = file;
+        }
+
+        recorder.flusher = std::thread([&recorder] { recorder.run_flusher(); });
+
+        detail::task_trace_enabled.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    void stop_task_trace()
+    {
+        std::lock_guard<std::mutex> ll(get_start_stop_mutex());
+
+        task_trace_recorder& recorder = get_recorder();
+        if (recorder.file == nullptr)
+        {
+            return;
+        }
+
+        detail::task_trace_enabled.store(false, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> l(recorder.mtx);
+            recorder.stop = true;
+        }
+        recorder.cond.notify_all();
+        recorder.flusher.join();
+
+        recorder.flush();
+
+        // the end record allows to convert the time stamps into nanoseconds
+        task_trace_record rec{};
+        rec.timestamp = hpx::util::hardware::timestamp();
+        rec.id = steady_time();
+        rec.data = recorder.dropped.load(std::memory_order_relaxed);
+        rec.event = task_trace_event::end;
+        std::fwrite(&rec, sizeof(rec), 1, recorder.file);
+
+        std::fclose(recorder.file);
+        recorder.file = nullptr;
+    }
+
+    std::uint64_t get_task_trace_dropped_events() noexcept
+    {
+        return get_recorder().dropped.load(std::memory_order_relaxed);
+    }
+}    // namespace hpx::tracing
+#endif
@@ -0,0 +1,133 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/functional.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/tracing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace tr = hpx::tracing;
+
+constexpr char const* profile_file = "sampling_profiler_test.folded";
+
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+///////////////////////////////////////////////////////////////////////////////
+// keep the worker threads busy until enough samples were taken
+double spin(std::chrono::steady_clock::time_point deadline)
+{
+    double volatile result = 0;
+    while (tr::get_sampling_profiler_samples() < 200 &&
+        std::chrono::steady_clock::now() < deadline)
+    {
+        for (int i = 0; i != 1000; ++i)
+        {
+            result = result + i * 0.5;
+        }
+    }
+    return result;
+}
+
+void test_sampling()
+{
+    std::cerr << "test_sampling\n";
+
+    HPX_TEST(!tr::sampling_profiler_enabled());
+    HPX_TEST(tr::start_sampling_profiler(profile_file, 1000));
+    HPX_TEST(tr::sampling_profiler_enabled());
+
+    // the profiler can't be started twice
+    HPX_TEST(!tr::start_sampling_profiler(profile_file));
+
+    auto const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    std::vector<hpx::future<double>> tasks;
+    for (std::size_t i = 0; i != 4; ++i)
+    {
+        tasks.push_back(hpx::async(hpx::annotated_function(
+            [deadline] { return spin(deadline); }, "sampling_profiler_test")));
+    }
+    hpx::wait_all(tasks);
+
+    tr::stop_sampling_profiler();
+    HPX_TEST(!tr::sampling_profiler_enabled());
+
+    std::uint64_t const samples = tr::get_sampling_profiler_samples();
+    HPX_TEST_LT(static_cast<std::uint64_t>(0), samples);
+
+    // every line holds a stack and the number of samples taken in it
+    std::ifstream in(profile_file);
+    HPX_TEST(in.good());
+
+    std::uint64_t total = 0;
+    std::uint64_t annotated = 0;
+    std::string line;
+    while (std::getline(in, line))
+    {
+        std::size_t const pos = line.rfind(' ');
+        HPX_TEST_NEQ(pos, std::string::npos);
+        if (pos == std::string::npos)
+            continue;
+
+        std::uint64_t const count = std::stoull(line.substr(pos + 1));
+        HPX_TEST_LT(static_cast<std::uint64_t>(0), count);
+        total += count;
+
+        if (line.rfind("sampling_profiler_test;", 0) == 0)
+            annotated += count;
+    }
+
+    HPX_TEST_LTE(total, samples);
+    HPX_TEST_LT(static_cast<std::uint64_t>(0), annotated);
+
+    std::remove(profile_file);
+}
+#else
+///////////////////////////////////////////////////////////////////////////////
+void test_disabled()
+{
+    std::cerr << "test_disabled\n";
+
+    HPX_TEST(!tr::start_sampling_profiler(profile_file));
+    HPX_TEST(!tr::sampling_profiler_enabled());
+
+    // attributing samples and stopping are no-ops
+    tr::set_sampled_task(1, "sampling_profiler_test");
+    tr::stop_sampling_profiler();
+    HPX_TEST_EQ(tr::get_sampling_profiler_samples(),
+        static_cast<std::uint64_t>(0));
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+#if defined(HPX_HAVE_SAMPLING_PROFILER)
+    test_sampling();
+#else
+    test_disabled();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
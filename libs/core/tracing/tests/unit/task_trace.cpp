@@ -0,0 +1,187 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/functional.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/tracing.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace tr = hpx::tracing;
+
+constexpr char const* trace_file = "task_trace_test.trace";
+constexpr std::size_t num_tasks = 100;
+
+#if defined(HPX_HAVE_TASK_TRACE)
+///////////////////////////////////////////////////////////////////////////////
+struct trace_contents
+{
+    std::vector<tr::task_trace_record> records;
+    std::vector<std::string> names;
+    bool has_end = false;
+};
+
+trace_contents read_trace()
+{
+    trace_contents result;
+
+    std::ifstream in(trace_file, std::ios::binary);
+    HPX_TEST(in.good());
+
+    char header[32];
+    in.read(header, sizeof(header));
+    HPX_TEST(in.good());
+    HPX_TEST(std::memcmp(header, "HPXTRC01", 8) == 0);
+
+    tr::task_trace_record rec;
+    while (in.read(reinterpret_cast<char*>(&rec), sizeof(rec)))
+    {
+        if (rec.event == tr::task_trace_event::name)
+        {
+            std::size_t const padded =
+                (rec.data + sizeof(rec) - 1) / sizeof(rec) * sizeof(rec);
+            std::vector<char> name(padded);
+            in.read(name.data(), static_cast<std::streamsize>(padded));
+            result.names.emplace_back(name.data(), rec.data);
+        }
+        else if (rec.event == tr::task_trace_event::end)
+        {
+            HPX_TEST_EQ(rec.data, static_cast<std::uint64_t>(0));
+            result.has_end = true;
+        }
+        else
+        {
+            result.records.push_back(rec);
+        }
+    }
+    return result;
+}
+
+std::size_t count_events(
+    trace_contents const& trace, tr::task_trace_event event)
+{
+    std::size_t count = 0;
+    for (auto const& rec : trace.records)
+    {
+        if (rec.event == event)
+            ++count;
+    }
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_recording()
+{
+    std::cerr << "test_recording\n";
+
+    HPX_TEST(!tr::task_trace_enabled());
+    HPX_TEST(tr::start_task_trace(trace_file));
+    HPX_TEST(tr::task_trace_enabled());
+
+    // the recorder can't be started twice
+    HPX_TEST(!tr::start_task_trace(trace_file));
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async(hpx::annotated_function(
+            [] { hpx::this_thread::yield(); }, "task_trace_test")));
+    }
+    hpx::wait_all(tasks);
+
+    tr::stop_task_trace();
+    HPX_TEST(!tr::task_trace_enabled());
+    HPX_TEST_EQ(tr::get_task_trace_dropped_events(),
+        static_cast<std::uint64_t>(0));
+
+    trace_contents const trace = read_trace();
+    HPX_TEST(trace.has_end);
+
+    HPX_TEST_LTE(num_tasks, count_events(trace, tr::task_trace_event::create));
+    HPX_TEST_LTE(num_tasks, count_events(trace, tr::task_trace_event::start));
+    HPX_TEST_LTE(num_tasks, count_events(trace, tr::task_trace_event::finish));
+
+    // every yield suspends and resumes the task
+    HPX_TEST_LTE(num_tasks, count_events(trace, tr::task_trace_event::suspend));
+    HPX_TEST_LTE(num_tasks, count_events(trace, tr::task_trace_event::resume));
+
+    bool found_name = false;
+    for (auto const& name : trace.names)
+    {
+        if (name == "task_trace_test")
+            found_name = true;
+    }
+    HPX_TEST(found_name);
+
+    std::remove(trace_file);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_dropped_events()
+{
+    std::cerr << "test_dropped_events\n";
+
+    // a tiny buffer which is flushed rarely has to drop events instead of
+    // blocking the recording threads
+    HPX_TEST(tr::start_task_trace(trace_file, 16, 10000));
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        tr::record_task_event(tr::task_trace_event::create, 0, i);
+    }
+    HPX_TEST_LT(static_cast<std::uint64_t>(0),
+        tr::get_task_trace_dropped_events());
+    tr::stop_task_trace();
+
+    std::remove(trace_file);
+}
+#else
+///////////////////////////////////////////////////////////////////////////////
+void test_disabled()
+{
+    std::cerr << "test_disabled\n";
+
+    HPX_TEST(!tr::start_task_trace(trace_file));
+    HPX_TEST(!tr::task_trace_enabled());
+
+    // recording and stopping are no-ops
+    tr::record_task_event(tr::task_trace_event::create, 0, 0);
+    tr::stop_task_trace();
+    HPX_TEST_EQ(tr::get_task_trace_dropped_events(),
+        static_cast<std::uint64_t>(0));
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+#if defined(HPX_HAVE_TASK_TRACE)
+    test_recording();
+    test_dropped_events();
+#else
+    test_disabled();
+#endif
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -19,6 +19,9 @@
 #include <hpx/modules/naming_base.hpp>
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/threading_base.hpp>
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+#include <hpx/parcelset_base/parcel_latency.hpp>
+#endif
 
 #include <chrono>
 #include <exception>
@@ -47,6 +50,10 @@ namespace hpx::detail {
                 target, lva, comptype, HPX_FORWARD(Ts, vs)...);
         }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        data.func = parcelset::detail::track_action_start(HPX_MOVE(data.func));
+#endif
+
         while (!threads::threadmanager_is_at_least(hpx::state::running))
         {
             std::this_thread::sleep_for(
@@ -69,6 +76,10 @@ namespace hpx::detail {
             HPX_FORWARD(Continuation, cont), lva, comptype,
             HPX_FORWARD(Ts, vs)...);
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        data.func = parcelset::detail::track_action_start(HPX_MOVE(data.func));
+#endif
+
         while (!threads::threadmanager_is_at_least(hpx::state::running))
         {
             std::this_thread::sleep_for(
@@ -82,6 +93,9 @@ namespace hpx::detail {
     HPX_FORCEINLINE void call_sync(naming::address::address_type lva,
         naming::address::component_type comptype, Ts&&... vs)
     {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        parcelset::detail::record_action_start();
+#endif
         Action::execute_function(lva, comptype, HPX_FORWARD(Ts, vs)...);
     }
 
@@ -90,6 +104,9 @@ namespace hpx::detail {
         naming::address::address_type lva,
         naming::address::component_type comptype, Ts&&... vs)
     {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        parcelset::detail::record_action_start();
+#endif
         try
         {
             cont.trigger_value(Action::execute_function(
@@ -397,7 +397,8 @@ namespace hpx::util {
                   "   'full' (prints all available counter infos)")
                 ("hpx:print-counter-format", value<std::string>(),
                   "print the performance counter(s) specified with --hpx:print-counter "
-                  "in a given format (default: normal)")
+                  "in a given format (default: normal, possible values: csv, "
+                  "csv-short, binary)")
                 ("hpx:csv-header",
                   "print the performance counter(s) specified with --hpx:print-counter "
                   "with header when format specified with --hpx:print-counter-format"
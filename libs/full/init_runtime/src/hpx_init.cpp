@@ -773,6 +773,10 @@ namespace hpx {
                 [](std::exception_ptr const& e) {
                     report_exception_and_terminate(e);
                 });
+            hpx::lcos::detail::set_continuation_inline_depth(
+                hpx::util::get_entry_as<std::size_t>(cfg,
+                    "hpx.continuation_inline_depth",
+                    HPX_CONTINUATION_INLINE_DEPTH));
 #if defined(HPX_HAVE_VERIFY_LOCKS)
             hpx::util::set_registered_locks_error_handler(
                 &detail::registered_locks_error_handler);
@@ -17,6 +17,7 @@
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/modules/tracing.hpp>
 
 #include <hpx/modules/components_base.hpp>
 #include <hpx/modules/parcelset_base.hpp>
@@ -315,6 +316,21 @@ namespace hpx::parcelset {
                     bool const migrated =
                         p.load_schedule(archive, num_thread, deferred_schedule);
 
+#if defined(HPX_HAVE_TASK_TRACE) && defined(HPX_HAVE_PARCEL_PROFILING)
+                    if (hpx::tracing::task_trace_enabled())
+                    {
+                        naming::gid_type const& parcel_id = p.parcel_id();
+                        std::uint32_t const source =
+                            naming::get_locality_id_from_gid(parcel_id);
+                        hpx::tracing::record_task_event(
+                            hpx::tracing::task_trace_event::parcel_receive,
+                            num_thread,
+                            (static_cast<std::uint64_t>(source) << 48) ^
+                                parcel_id.get_lsb(),
+                            source);
+                    }
+#endif
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                     std::int64_t const add_parcel_time =
                         timer.elapsed_nanoseconds();
@@ -16,6 +16,7 @@
 #include <hpx/modules/parcelset_base.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -43,8 +44,20 @@ namespace hpx::parcelset::detail {
         void operator()(std::error_code const& e)
         {
             HPX_ASSERT(parcels_.size() == handlers_.size());
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+            std::int64_t const send_time = parcel_timestamp_now();
+#endif
             for (std::size_t i = 0; i < parcels_.size(); ++i)
             {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                if (!e)
+                {
+                    parcels_[i].set_timestamp(
+                        parcel_timestamp::send, send_time);
+                    record_parcel_sent(parcels_[i].get_action_name(),
+                        parcels_[i].timestamps());
+                }
+#endif
                 handlers_[i](e, parcels_[i]);
                 handlers_[i].reset();
             }
@@ -237,8 +237,18 @@ namespace hpx::parcelset {
                             split_gids.set_split_gids(HPX_MOVE(split_gids_map));
                         }
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        ps[i].set_timestamp(
+                            parcel_timestamp::serialization_start,
+                            parcel_timestamp_now());
+#endif
                         archive << ps[i];
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+                        ps[i].set_timestamp(parcel_timestamp::serialization_end,
+                            parcel_timestamp_now());
+#endif
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                         parcelset::data_point action_data;
@@ -49,6 +49,7 @@ namespace hpx::parcelset::detail {
         naming::gid_type parcel_id_;
         double start_time_;
         double creation_time_;
+        parcel_timestamps timestamps_;
 #endif
 
         bool has_continuation_;
@@ -135,6 +136,9 @@ namespace hpx::parcelset::detail {
         // generate unique parcel id
         naming::gid_type const& parcel_id() const override;
         naming::gid_type& parcel_id() override;
+
+        parcel_timestamps const& timestamps() const override;
+        parcel_timestamps& timestamps() override;
 #endif
 
     private:
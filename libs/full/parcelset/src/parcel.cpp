@@ -36,6 +36,41 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::parcelset::detail {
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+    namespace {
+
+        // Make the timestamps of a received parcel available to the code
+        // scheduling its action while the guard is alive.
+        struct scheduled_parcel_guard
+        {
+            explicit scheduled_parcel_guard(parcel const& p)
+            {
+                // parcels delivered locally are not tracked
+                if (p.timestamps()[parcel_timestamp::receive] != 0)
+                {
+                    record_.action = p.get_action_name();
+                    record_.timestamps = p.timestamps();
+                    set_scheduled_parcel(&record_);
+                }
+            }
+
+            scheduled_parcel_guard(scheduled_parcel_guard const&) = delete;
+            scheduled_parcel_guard(scheduled_parcel_guard&&) = delete;
+            scheduled_parcel_guard& operator=(
+                scheduled_parcel_guard const&) = delete;
+            scheduled_parcel_guard& operator=(
+                scheduled_parcel_guard&&) = delete;
+
+            ~scheduled_parcel_guard()
+            {
+                set_scheduled_parcel(nullptr);
+            }
+
+            parcel_latency_record record_;
+        };
+    }    // namespace
+#endif
+
     parcel_data::parcel_data()
       : source_id_(naming::invalid_gid)
       , dest_(naming::invalid_gid)
@@ -69,6 +104,7 @@ namespace hpx::parcelset::detail {
       , parcel_id_(HPX_MOVE(rhs.parcel_id_))
       , start_time_(rhs.start_time_)
       , creation_time_(rhs.creation_time_)
+      , timestamps_(rhs.timestamps_)
 #endif
       , has_continuation_(rhs.has_continuation_)
     {
@@ -80,6 +116,7 @@ namespace hpx::parcelset::detail {
         rhs.parcel_id_ = naming::invalid_gid;
         rhs.start_time_ = 0;
         rhs.creation_time_ = 0;
+        rhs.timestamps_ = parcel_timestamps();
 #endif
     }
 
@@ -92,6 +129,7 @@ namespace hpx::parcelset::detail {
         parcel_id_ = HPX_MOVE(rhs.parcel_id_);
         start_time_ = rhs.start_time_;
         creation_time_ = rhs.creation_time_;
+        timestamps_ = rhs.timestamps_;
 #endif
         has_continuation_ = rhs.has_continuation_;
 
@@ -102,6 +140,7 @@ namespace hpx::parcelset::detail {
         rhs.parcel_id_ = naming::invalid_gid;
         rhs.start_time_ = 0;
         rhs.creation_time_ = 0;
+        rhs.timestamps_ = parcel_timestamps();
 #endif
         return *this;
     }
@@ -116,6 +155,11 @@ namespace hpx::parcelset::detail {
         ar >> parcel_id_;
         ar >> start_time_;
         ar >> creation_time_;
+
+        // only the timestamps taken before serialization are sent along
+        timestamps_ = parcel_timestamps();
+        ar >> timestamps_[parcel_timestamp::enqueue];
+        ar >> timestamps_[parcel_timestamp::serialization_start];
 #endif
 
         ar >> has_continuation_;
@@ -132,6 +176,9 @@ namespace hpx::parcelset::detail {
         ar << parcel_id_;
         ar << start_time_;
         ar << creation_time_;
+
+        ar << timestamps_[parcel_timestamp::enqueue];
+        ar << timestamps_[parcel_timestamp::serialization_start];
 #endif
 
         ar << has_continuation_;
@@ -324,6 +371,16 @@ namespace hpx::parcelset::detail {
     {
         return data_.parcel_id_;
     }
+
+    parcel_timestamps const& parcel::timestamps() const
+    {
+        return data_.timestamps_;
+    }
+
+    parcel_timestamps& parcel::timestamps()
+    {
+        return data_.timestamps_;
+    }
 #endif
 
 #if defined(HPX_HAVE_NETWORKING)
@@ -441,8 +498,15 @@ namespace hpx::parcelset::detail {
     bool parcel::load_schedule(serialization::input_archive& ar,
         std::size_t num_thread, bool& deferred_schedule)
     {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        std::int64_t const receive_time = parcel_timestamp_now();
+#endif
         load_data(ar);
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        data_.timestamps_[parcel_timestamp::receive] = receive_time;
+#endif
+
         // make sure this parcel destination matches the proper locality
         HPX_ASSERT(destination_locality() == data_.addr_.locality_);
 
@@ -467,6 +531,9 @@ namespace hpx::parcelset::detail {
         }
 
         // continuation support, this is handled in the transfer action
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        scheduled_parcel_guard const guard(*this);
+#endif
         action_->load_schedule(ar, HPX_MOVE(data_.dest_), p.first, p.second,
             num_thread, deferred_schedule);
 
@@ -504,6 +571,9 @@ namespace hpx::parcelset::detail {
 
         // dispatch action, register work item either with or without
         // continuation support, this is handled in the transfer action
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        scheduled_parcel_guard const guard(*this);
+#endif
         action_->schedule_thread(
             HPX_MOVE(data_.dest_), p.first, p.second, num_thread);
         return false;
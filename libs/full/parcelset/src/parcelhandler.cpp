@@ -27,6 +27,7 @@
 #include <hpx/modules/thread_support.hpp>
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/threadmanager.hpp>
+#include <hpx/modules/tracing.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/modules/util.hpp>
 
@@ -1446,6 +1447,7 @@ namespace hpx::parcelset {
 #if defined(HPX_HAVE_PARCEL_PROFILING)
         // set the current local time for this locality
         p.set_start_time(hpx::chrono::high_resolution_timer::now());
+        p.set_timestamp(parcel_timestamp::enqueue, parcel_timestamp_now());
 
         if (!p.parcel_id())
         {
@@ -1453,6 +1455,20 @@ namespace hpx::parcelset {
             std::uint32_t locality_id = agas::get_locality_id(ec);
             p.parcel_id() = parcelset::parcel::generate_unique_id(locality_id);
         }
+
+#if defined(HPX_HAVE_TASK_TRACE)
+        // the parcel id is unique only in conjunction with the id of the
+        // sending locality
+        naming::gid_type const& parcel_id = p.parcel_id();
+        hpx::tracing::record_task_event(
+            hpx::tracing::task_trace_event::parcel_send,
+            hpx::get_worker_thread_num(),
+            (static_cast<std::uint64_t>(
+                 naming::get_locality_id_from_gid(parcel_id))
+                << 48) ^
+                parcel_id.get_lsb(),
+            p.destination_locality_id());
+#endif
 #endif
     }
 }    // namespace hpx::parcelset
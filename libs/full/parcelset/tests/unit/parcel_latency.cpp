@@ -0,0 +1,119 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_calls = 100;
+
+std::size_t echo(std::size_t value)
+{
+    return value;
+}
+HPX_PLAIN_ACTION(echo, parcel_latency_echo_action)
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+using hpx::parcelset::parcel_latency_stage;
+
+std::int64_t received_latency(std::string const& action, int stage)
+{
+    return hpx::parcelset::get_parcel_latency_percentile(
+        action, static_cast<parcel_latency_stage>(stage), 100.);
+}
+HPX_PLAIN_ACTION(received_latency, parcel_latency_received_action)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void test_remote_calls(hpx::id_type const& id)
+{
+    std::vector<hpx::future<std::size_t>> results;
+    results.reserve(num_calls);
+
+    for (std::size_t i = 0; i != num_calls; ++i)
+    {
+        results.push_back(hpx::async<parcel_latency_echo_action>(id, i));
+    }
+
+    for (std::size_t i = 0; i != num_calls; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i);
+    }
+
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+    std::string const action =
+        hpx::actions::detail::get_action_name<parcel_latency_echo_action>();
+
+    // the sender side stages are collected on this locality
+    std::vector<std::string> const actions =
+        hpx::parcelset::get_parcel_latency_actions();
+    HPX_TEST(std::find(actions.begin(), actions.end(), action) !=
+        actions.end());
+
+    HPX_TEST_LT(static_cast<std::int64_t>(0),
+        hpx::parcelset::get_parcel_latency_percentile(
+            action, parcel_latency_stage::send, 100.));
+
+    // the histograms of all actions include the ones of the echo action
+    HPX_TEST_LTE(hpx::parcelset::get_parcel_latency_percentile(
+                     action, parcel_latency_stage::send, 100.),
+        hpx::parcelset::get_parcel_latency_percentile(
+            "", parcel_latency_stage::send, 100.));
+
+    // the receiver side stages are collected on the target locality, all
+    // localities of this test run on the same node, so the clocks agree
+    HPX_TEST_LT(static_cast<std::int64_t>(0),
+        hpx::async<parcel_latency_received_action>(id, action,
+            static_cast<int>(parcel_latency_stage::end_to_end))
+            .get());
+
+    // the same data is exposed through performance counters
+    std::uint32_t const locality_id = hpx::get_locality_id();
+    hpx::performance_counters::performance_counter counter(
+        "/parcels{locality#" + std::to_string(locality_id) +
+        "/total}/time/send-percentile@" + action + ",100");
+    HPX_TEST_LT(static_cast<std::int64_t>(0),
+        counter.get_value<std::int64_t>(hpx::launch::sync));
+
+    // resetting one counter doesn't affect the values of the others
+    hpx::performance_counters::performance_counter other(
+        "/parcels{locality#" + std::to_string(locality_id) +
+        "/total}/time/send-percentile@" + action + ",99");
+    counter.get_value<std::int64_t>(hpx::launch::sync, true);
+    HPX_TEST_LT(static_cast<std::int64_t>(0),
+        other.get_value<std::int64_t>(hpx::launch::sync));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_remote_calls(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
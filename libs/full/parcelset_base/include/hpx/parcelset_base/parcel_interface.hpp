@@ -19,6 +19,7 @@
 
 #include <hpx/modules/naming_base.hpp>
 #include <hpx/parcelset_base/locality.hpp>
+#include <hpx/parcelset_base/parcel_latency.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
 
 #include <cstddef>
@@ -105,6 +106,9 @@ namespace hpx::parcelset::detail {
 #if defined(HPX_HAVE_PARCEL_PROFILING)
         virtual naming::gid_type const& parcel_id() const = 0;
         virtual naming::gid_type& parcel_id() = 0;
+
+        virtual parcel_timestamps const& timestamps() const = 0;
+        virtual parcel_timestamps& timestamps() = 0;
 #endif
 
         HPX_SERIALIZATION_SPLIT_MEMBER()
@@ -189,6 +193,10 @@ namespace hpx::parcelset {
 #if defined(HPX_HAVE_PARCEL_PROFILING)
         // generate unique parcel id
         static naming::gid_type generate_unique_id(std::uint32_t locality_id);
+
+        // points in time this parcel passed on its way to the destination
+        [[nodiscard]] parcel_timestamps const& timestamps() const;
+        void set_timestamp(parcel_timestamp which, std::int64_t time) const;
 #endif
 
     private:
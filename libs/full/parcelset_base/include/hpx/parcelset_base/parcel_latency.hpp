@@ -0,0 +1,168 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parcel_latency.hpp
+/// \brief Per-action breakdown of the latency of remote invocations.
+///
+/// If HPX was configured with HPX_WITH_PARCEL_PROFILING=ON, every parcel
+/// records the points in time it passes through on its way from the sending
+/// to the receiving locality. The time spent between consecutive points is
+/// collected into one latency histogram per action name and stage, which
+/// allows to tell whether slow remote calls are due to queuing, serialization,
+/// or the network.
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_PROFILING)
+#include <hpx/modules/threading_base.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    /// The points in time recorded for each parcel.
+    HPX_CXX_EXPORT enum class parcel_timestamp : std::uint8_t
+    {
+        /// the parcel was handed to the parcel handler
+        enqueue = 0,
+
+        /// the parcelport started to serialize the parcel
+        serialization_start = 1,
+
+        /// the parcelport finished serializing the parcel
+        serialization_end = 2,
+
+        /// the parcelport reported the message holding the parcel as written
+        send = 3,
+
+        /// the receiving locality started decoding the parcel
+        receive = 4,
+
+        /// the action was decoded and is about to be scheduled
+        deserialization = 5,
+
+        /// the HPX-thread executing the action started running
+        action_start = 6
+    };
+
+    HPX_CXX_EXPORT inline constexpr std::size_t num_parcel_timestamps = 7;
+
+    /// The stages the latency of a parcel is broken down into. The first
+    /// three stages are collected on the sending locality, the remaining ones
+    /// on the receiving locality. The stages \a transfer and \a end_to_end
+    /// compare timestamps taken on different localities and are meaningful
+    /// only if the clocks of the involved nodes are synchronized.
+    HPX_CXX_EXPORT enum class parcel_latency_stage : std::uint8_t
+    {
+        /// enqueue -> serialization_start
+        queue = 0,
+
+        /// serialization_start -> serialization_end
+        serialization = 1,
+
+        /// serialization_end -> send
+        send = 2,
+
+        /// serialization_start (sender) -> receive (receiver), includes the
+        /// stages \a serialization and \a send
+        transfer = 3,
+
+        /// receive -> deserialization
+        deserialization = 4,
+
+        /// deserialization -> action_start
+        scheduling = 5,
+
+        /// enqueue (sender) -> action_start (receiver)
+        end_to_end = 6
+    };
+
+    HPX_CXX_EXPORT inline constexpr std::size_t num_parcel_latency_stages = 7;
+
+    /// The timestamps (nanoseconds since the epoch of the system clock)
+    /// recorded for a parcel, zero if the corresponding point was not
+    /// reached (yet). Only \a enqueue and \a serialization_start are sent
+    /// along with the parcel.
+    HPX_CXX_EXPORT struct parcel_timestamps
+    {
+        std::int64_t& operator[](parcel_timestamp t) noexcept
+        {
+            return values_[static_cast<std::size_t>(t)];
+        }
+
+        std::int64_t operator[](parcel_timestamp t) const noexcept
+        {
+            return values_[static_cast<std::size_t>(t)];
+        }
+
+        std::array<std::int64_t, num_parcel_timestamps> values_ = {};
+    };
+
+    /// Return the current time as used for the parcel timestamps.
+    HPX_CXX_EXPORT HPX_EXPORT std::int64_t parcel_timestamp_now() noexcept;
+
+    /// Add the sender side stages of a parcel which has been written to the
+    /// histograms of the given action.
+    HPX_CXX_EXPORT HPX_EXPORT void record_parcel_sent(
+        char const* action, parcel_timestamps const& timestamps);
+
+    /// Add the receiver side stages of a parcel whose action has started
+    /// executing to the histograms of the given action.
+    HPX_CXX_EXPORT HPX_EXPORT void record_parcel_received(
+        char const* action, parcel_timestamps const& timestamps);
+
+    /// Return the given percentile (0..100) of the time (in nanoseconds)
+    /// parcels of the given action spent in the given stage. An empty action
+    /// name combines the histograms of all actions.
+    HPX_CXX_EXPORT HPX_EXPORT std::int64_t get_parcel_latency_percentile(
+        std::string const& action, parcel_latency_stage stage,
+        double percentile);
+
+    /// Same as above, but take only the parcels into account which were
+    /// recorded since the last reset of the given baseline. The histograms
+    /// are shared by all readers and are never reset themselves.
+    HPX_CXX_EXPORT HPX_EXPORT std::int64_t get_parcel_latency_percentile(
+        std::string const& action, parcel_latency_stage stage,
+        double percentile, threads::latency_histogram_baseline& baseline,
+        bool reset);
+
+    /// Return the names of all actions latencies were recorded for.
+    HPX_CXX_EXPORT HPX_EXPORT std::vector<std::string>
+    get_parcel_latency_actions();
+
+    namespace detail {
+
+        // The action name and timestamps of a received parcel, handed from
+        // the parcel to the code scheduling its action.
+        struct parcel_latency_record
+        {
+            char const* action = nullptr;
+            parcel_timestamps timestamps;
+        };
+
+        // Attach the record of the parcel whose action is about to be
+        // scheduled to the calling OS thread (nullptr detaches it).
+        HPX_EXPORT void set_scheduled_parcel(
+            parcel_latency_record const* record) noexcept;
+
+        // Consume the attached record, if any, and wrap the thread function
+        // of the action such that the start of its execution is recorded.
+        HPX_EXPORT threads::thread_function_type track_action_start(
+            threads::thread_function_type&& f);
+
+        // Consume the attached record, if any, for an action which is about
+        // to be executed directly.
+        HPX_EXPORT void record_action_start();
+    }    // namespace detail
+}    // namespace hpx::parcelset
+
+#endif
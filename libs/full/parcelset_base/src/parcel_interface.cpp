@@ -229,6 +229,16 @@ namespace hpx::parcelset {
         result.set_lsb(++id);
         return result;
     }
+
+    parcel_timestamps const& parcel::timestamps() const
+    {
+        return data_->timestamps();
+    }
+
+    void parcel::set_timestamp(parcel_timestamp which, std::int64_t time) const
+    {
+        data_->timestamps()[which] = time;
+    }
 #else
     naming::gid_type const& parcel::parcel_id() const
     {
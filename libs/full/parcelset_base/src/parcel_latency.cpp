@@ -0,0 +1,242 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_PROFILING)
+#include <hpx/modules/hashing.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/threading_base.hpp>
+#include <hpx/parcelset_base/parcel_latency.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    namespace {
+
+        using histogram_type = threads::latency_histogram;
+        using stage_histograms =
+            std::array<histogram_type, num_parcel_latency_stages>;
+
+        // Histograms of all stages for every action parcels were recorded
+        // for. Entries are never removed, the histograms themselves are
+        // updated without holding the lock.
+        struct parcel_latency_registry
+        {
+            using mutex_type = hpx::spinlock;
+
+            stage_histograms& get(char const* action)
+            {
+                std::lock_guard l(mtx_);
+                auto& entry = data_[std::string(action)];
+                if (!entry)
+                {
+                    entry = std::make_unique<stage_histograms>();
+                }
+                return *entry;
+            }
+
+            histogram_type::counts_type collect(
+                std::string const& action, parcel_latency_stage stage)
+            {
+                histogram_type::counts_type counts = {};
+                auto const index = static_cast<std::size_t>(stage);
+
+                std::lock_guard l(mtx_);
+                if (action.empty())
+                {
+                    for (auto& entry : data_)
+                    {
+                        (*entry.second)[index].collect(counts, false);
+                    }
+                }
+                else if (auto const it = data_.find(action); it != data_.end())
+                {
+                    (*it->second)[index].collect(counts, false);
+                }
+                return counts;
+            }
+
+            std::vector<std::string> actions()
+            {
+                std::vector<std::string> result;
+
+                std::lock_guard l(mtx_);
+                result.reserve(data_.size());
+                for (auto const& entry : data_)
+                {
+                    result.push_back(entry.first);
+                }
+                return result;
+            }
+
+        private:
+            mutex_type mtx_;
+            std::unordered_map<std::string, std::unique_ptr<stage_histograms>,
+                hpx::util::jenkins_hash>
+                data_;
+        };
+
+        parcel_latency_registry& get_registry()
+        {
+            static parcel_latency_registry registry;
+            return registry;
+        }
+
+        // record the time between two timestamps, if both were taken
+        void record_stage(stage_histograms& histograms,
+            parcel_latency_stage stage, parcel_timestamps const& timestamps,
+            parcel_timestamp from, parcel_timestamp to) noexcept
+        {
+            if (timestamps[from] != 0 && timestamps[to] != 0)
+            {
+                histograms[static_cast<std::size_t>(stage)].record(
+                    timestamps[to] - timestamps[from]);
+            }
+        }
+    }    // namespace
+
+    std::int64_t parcel_timestamp_now() noexcept
+    {
+        // the timestamps are compared across localities, use the wall clock
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    }
+
+    void record_parcel_sent(
+        char const* action, parcel_timestamps const& timestamps)
+    {
+        // parcels delivered locally are never serialized
+        if (action == nullptr ||
+            timestamps[parcel_timestamp::serialization_start] == 0)
+        {
+            return;
+        }
+
+        auto& histograms = get_registry().get(action);
+        record_stage(histograms, parcel_latency_stage::queue, timestamps,
+            parcel_timestamp::enqueue, parcel_timestamp::serialization_start);
+        record_stage(histograms, parcel_latency_stage::serialization,
+            timestamps, parcel_timestamp::serialization_start,
+            parcel_timestamp::serialization_end);
+        record_stage(histograms, parcel_latency_stage::send, timestamps,
+            parcel_timestamp::serialization_end, parcel_timestamp::send);
+    }
+
+    void record_parcel_received(
+        char const* action, parcel_timestamps const& timestamps)
+    {
+        if (action == nullptr)
+        {
+            return;
+        }
+
+        auto& histograms = get_registry().get(action);
+        record_stage(histograms, parcel_latency_stage::transfer, timestamps,
+            parcel_timestamp::serialization_start, parcel_timestamp::receive);
+        record_stage(histograms, parcel_latency_stage::deserialization,
+            timestamps, parcel_timestamp::receive,
+            parcel_timestamp::deserialization);
+        record_stage(histograms, parcel_latency_stage::scheduling, timestamps,
+            parcel_timestamp::deserialization, parcel_timestamp::action_start);
+        record_stage(histograms, parcel_latency_stage::end_to_end, timestamps,
+            parcel_timestamp::enqueue, parcel_timestamp::action_start);
+    }
+
+    std::int64_t get_parcel_latency_percentile(std::string const& action,
+        parcel_latency_stage stage, double percentile)
+    {
+        auto const counts = get_registry().collect(action, stage);
+        return histogram_type::percentile(counts, percentile);
+    }
+
+    std::int64_t get_parcel_latency_percentile(std::string const& action,
+        parcel_latency_stage stage, double percentile,
+        threads::latency_histogram_baseline& baseline, bool reset)
+    {
+        auto counts = get_registry().collect(action, stage);
+        baseline.since_last_reset(counts, reset);
+        return histogram_type::percentile(counts, percentile);
+    }
+
+    std::vector<std::string> get_parcel_latency_actions()
+    {
+        return get_registry().actions();
+    }
+
+    namespace detail {
+
+        namespace {
+
+            thread_local parcel_latency_record const* scheduled_parcel =
+                nullptr;
+
+            parcel_latency_record const* consume_scheduled_parcel() noexcept
+            {
+                parcel_latency_record const* record = scheduled_parcel;
+                scheduled_parcel = nullptr;
+                return record;
+            }
+        }    // namespace
+
+        void set_scheduled_parcel(parcel_latency_record const* record) noexcept
+        {
+            scheduled_parcel = record;
+        }
+
+        threads::thread_function_type track_action_start(
+            threads::thread_function_type&& f)
+        {
+            parcel_latency_record const* record = consume_scheduled_parcel();
+            if (record == nullptr)
+            {
+                return HPX_MOVE(f);
+            }
+
+            parcel_latency_record started = *record;
+            started.timestamps[parcel_timestamp::deserialization] =
+                parcel_timestamp_now();
+
+            // the thread function is invoked once, when the HPX-thread runs
+            // for the first time
+            return [f = HPX_MOVE(f), started](
+                       threads::thread_restart_state state) mutable {
+                started.timestamps[parcel_timestamp::action_start] =
+                    parcel_timestamp_now();
+                record_parcel_received(started.action, started.timestamps);
+                return f(state);
+            };
+        }
+
+        void record_action_start()
+        {
+            parcel_latency_record const* record = consume_scheduled_parcel();
+            if (record == nullptr)
+            {
+                return;
+            }
+
+            parcel_latency_record started = *record;
+            std::int64_t const now = parcel_timestamp_now();
+            started.timestamps[parcel_timestamp::deserialization] = now;
+            started.timestamps[parcel_timestamp::action_start] = now;
+            record_parcel_received(started.action, started.timestamps);
+        }
+    }    // namespace detail
+}    // namespace hpx::parcelset
+
+#endif
@@ -16,7 +16,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <fstream>
 #include <string>
+#include <utility>
 #include <vector>
 #if !defined(HPX_HAVE_APEX)
 #if HPX_HAVE_ITTNOTIFY != 0
@@ -107,6 +109,12 @@ namespace hpx::util {
         template <typename Stream>
         void print_name_csv_short(Stream& out, std::string const& name);
 
+        // write the counter values in the binary, delta encoded format
+        bool stream_counters(bool destination_is_cout, bool reset,
+            bool no_output,
+            std::vector<performance_counters::counter_info> const& infos,
+            error_code& ec);
+
     private:
         using mutex_type = hpx::mutex;
         mutex_type mtx_;
@@ -124,6 +132,15 @@ namespace hpx::util {
 
         interval_timer timer_;
 
+        // state of the binary counter stream (format 'binary'), the counter
+        // values are encoded relative to the previously written sample
+        std::ofstream stream_;
+        bool stream_names_written_ = false;
+        std::int64_t stream_time_ = 0;
+        std::vector<std::int64_t> stream_values_;
+        std::vector<std::vector<std::int64_t>> stream_arrays_;
+        std::vector<std::pair<std::int64_t, bool>> stream_scaling_;
+
 #if !defined(HPX_HAVE_APEX)
 #if HPX_HAVE_ITTNOTIFY != 0
         std::map<std::string, util::itt::counter> itt_counters_;
@@ -7,6 +7,7 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
@@ -15,11 +16,142 @@
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/performance_counters/parcelhandler_counter_types.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <exception>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace hpx::performance_counters {
 
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+    ///////////////////////////////////////////////////////////////////////////
+    // parcel latency percentile counter creation function
+    // /parcels{locality#%d/total}/time/queue-percentile@99
+    // /parcels{locality#%d/total}/time/queue-percentile@<action>,99
+    static naming::gid_type parcel_latency_counter_creator(
+        parcelset::parcel_latency_stage stage, counter_info const& info,
+        error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "parcel_latency_counter_creator",
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        // the counter parameter is the requested percentile, e.g. 99.9,
+        // optionally preceded by the name of an action
+        std::string action;
+        std::string percentile_str = paths.parameters_;
+        if (std::size_t const pos = percentile_str.rfind(',');
+            pos != std::string::npos)
+        {
+            action = percentile_str.substr(0, pos);
+            percentile_str.erase(0, pos + 1);
+        }
+
+        double percentile = 50.;
+        if (!percentile_str.empty())
+        {
+            try
+            {
+                percentile = std::stod(percentile_str);
+            }
+            catch (std::exception const&)
+            {
+                percentile = -1.;
+            }
+
+            if (!(percentile >= 0. && percentile <= 100.))
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "parcel_latency_counter_creator",
+                    "invalid percentile (should be in [0, 100]): {}",
+                    paths.parameters_);
+                return naming::invalid_gid;
+            }
+        }
+
+        // the histograms are never reset, every counter reports the parcels
+        // recorded since its own last reset
+        auto baseline = std::make_shared<threads::latency_histogram_baseline>();
+        hpx::function<std::int64_t(bool)> f =
+            [action = HPX_MOVE(action), stage, percentile, baseline](
+                bool reset) {
+                return parcelset::get_parcel_latency_percentile(
+                    action, stage, percentile, *baseline, reset);
+            };
+
+        return locality_raw_counter_creator(info, HPX_MOVE(f), ec);
+    }
+
+    static void register_parcel_latency_counter_types()
+    {
+        using parcelset::parcel_latency_stage;
+
+        struct stage_info
+        {
+            parcel_latency_stage stage;
+            char const* name;
+            char const* help;
+        };
+
+        static constexpr stage_info stages[] = {
+            {parcel_latency_stage::queue, "queue",
+                "parcels spent in the parcel queues before being serialized"},
+            {parcel_latency_stage::serialization, "serialization",
+                "it took to serialize a parcel"},
+            {parcel_latency_stage::send, "send",
+                "it took to write a serialized parcel to the network"},
+            {parcel_latency_stage::transfer, "transfer",
+                "passed between starting to serialize a parcel on the "
+                "sending locality and starting to decode it on this locality, "
+                "including its serialization and sending (requires "
+                "synchronized clocks)"},
+            {parcel_latency_stage::deserialization, "deserialization",
+                "it took to decode a received parcel"},
+            {parcel_latency_stage::scheduling, "scheduling",
+                "passed between decoding a received parcel and its action "
+                "starting to run"},
+            {parcel_latency_stage::end_to_end, "end-to-end",
+                "passed between handing a parcel to the parcel handler on the "
+                "sending locality and its action starting to run on this "
+                "locality (requires synchronized clocks)"},
+        };
+
+        std::vector<generic_counter_type_data> counter_types;
+        counter_types.reserve(std::size(stages));
+        for (stage_info const& s : stages)
+        {
+            counter_types.push_back(generic_counter_type_data{
+                hpx::util::format("/parcels/time/{}-percentile", s.name),
+                counter_type::raw,
+                hpx::util::format(
+                    "returns the given percentile (counter parameter: "
+                    "[<action>,]<percentile>, default: 50) of the time {}",
+                    s.help),
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&parcel_latency_counter_creator, s.stage),
+                &locality_counter_discoverer, "ns"});
+        }
+
+        install_counter_types(counter_types.data(), counter_types.size());
+    }
+#endif
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
     ///////////////////////////////////////////////////////////////////////////
     static void register_parcelhandler_counter_types(
@@ -623,6 +755,13 @@ namespace hpx::performance_counters {
     void register_parcelhandler_counter_types(
         [[maybe_unused]] parcelset::parcelhandler& ph)
     {
+#if defined(HPX_HAVE_PARCEL_PROFILING)
+        if (ph.is_networking_enabled())
+        {
+            register_parcel_latency_counter_types();
+        }
+#endif
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
         if (!ph.is_networking_enabled())
         {
@@ -134,6 +134,22 @@ namespace hpx::util {
 #pragma GCC diagnostic pop
 #endif
 
+        // the binary stream is opened only once, restarting the evaluation
+        // continues the existing (delta encoded) stream, the counters found
+        // again are appended to the stream as new counters
+        if (format_ == "binary" && destination_ != "cout" &&
+            destination_ != "none" && !stream_.is_open())
+        {
+            stream_.open(destination_.c_str(),
+                std::ofstream::binary | std::ofstream::trunc);
+            if (!stream_.is_open())
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "query_counters::start",
+                    "could not open counter destination: {}", destination_);
+            }
+        }
+
         find_counters();
 
         counters_.start(launch::sync);
@@ -176,6 +192,82 @@ namespace hpx::util {
         return strings::counter_type_short_names[static_cast<int>(type)];
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The binary counter stream starts with a 16 byte header ("HPXCTR01",
+    // followed by the 32 bit format version and 32 reserved bits), followed
+    // by a sequence of records. Every record starts with a tag byte, all
+    // integers are LEB128 encoded, signed integers are zigzag encoded first:
+    //
+    //  define:  tag, id, kind (0: value, 1: array), name length, name,
+    //           unit of measure length, unit of measure
+    //  scaling: tag, id, scaling (signed), scale_inverse (0 or 1)
+    //  invalid: tag, id
+    //  sample:  tag, time delta (signed, [ns]), number of values, value
+    //           deltas (signed), number of arrays, for each array: size,
+    //           element deltas (signed)
+    //
+    // Counter ids are the indices of the counters as listed in the define
+    // records. The values of a sample are ordered by id, all deltas are
+    // relative to the previous sample (or zero).
+    namespace {
+
+        namespace stream {
+
+            enum class record : std::uint8_t
+            {
+                define = 1,
+                sample = 2,
+                scaling = 3,
+                invalid = 4
+            };
+
+            void put_tag(std::string& buffer, record tag)
+            {
+                buffer.push_back(static_cast<char>(tag));
+            }
+
+            void put_unsigned(std::string& buffer, std::uint64_t value)
+            {
+                while (value >= 0x80)
+                {
+                    buffer.push_back(static_cast<char>((value & 0x7f) | 0x80));
+                    value >>= 7;
+                }
+                buffer.push_back(static_cast<char>(value));
+            }
+
+            void put_signed(std::string& buffer, std::int64_t value)
+            {
+                put_unsigned(buffer,
+                    (static_cast<std::uint64_t>(value) << 1) ^
+                        static_cast<std::uint64_t>(value >> 63));
+            }
+
+            void put_string(std::string& buffer, std::string const& value)
+            {
+                put_unsigned(buffer, value.size());
+                buffer.append(value);
+            }
+
+            template <typename Value>
+            void put_scaling(std::string& buffer, std::size_t id,
+                Value const& value, std::pair<std::int64_t, bool>& scaling)
+            {
+                if (scaling.first != value.scaling_ ||
+                    scaling.second != value.scale_inverse_)
+                {
+                    scaling.first = value.scaling_;
+                    scaling.second = value.scale_inverse_;
+
+                    put_tag(buffer, record::scaling);
+                    put_unsigned(buffer, id);
+                    put_signed(buffer, scaling.first);
+                    buffer.push_back(scaling.second ? 1 : 0);
+                }
+            }
+        }    // namespace stream
+    }    // namespace
+
     template <typename Stream>
     void query_counters::print_name_csv(Stream& out, std::string const& name)
     {
@@ -665,6 +757,160 @@ namespace hpx::util {
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    bool query_counters::stream_counters(bool destination_is_cout, bool reset,
+        bool no_output,
+        std::vector<performance_counters::counter_info> const& infos,
+        error_code& ec)
+    {
+        using performance_counters::counter_type;
+        auto const is_array = [](counter_type type) {
+            return type == counter_type::histogram ||
+                type == counter_type::raw_values;
+        };
+
+        std::vector<std::size_t> value_ids;
+        std::vector<std::size_t> array_ids;
+        for (std::size_t i = 0; i != infos.size(); ++i)
+        {
+            if (is_array(infos[i].type_))
+                array_ids.push_back(i);
+            else
+                value_ids.push_back(i);
+        }
+
+        // query all counters before encoding anything
+        std::vector<performance_counters::counter_value> values;
+        if (!value_ids.empty())
+        {
+            values = counters_.get_counter_values(launch::sync, reset, ec);
+            if (ec)
+                return false;
+        }
+
+        std::vector<performance_counters::counter_values_array> arrays;
+        if (!array_ids.empty())
+        {
+            arrays =
+                counters_.get_counter_values_array(launch::sync, reset, ec);
+            if (ec)
+                return false;
+        }
+
+        HPX_ASSERT(values.size() == value_ids.size());
+        HPX_ASSERT(arrays.size() == array_ids.size());
+
+        auto const now = static_cast<std::int64_t>(
+            hpx::chrono::high_resolution_clock::now());
+
+        if (no_output)
+            return !infos.empty();
+
+        std::string buffer;
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        // the header is written only once
+        if (!stream_names_written_)
+        {
+            buffer.append("HPXCTR01");
+            std::uint32_t const header[2] = {1, 0};
+            buffer.append(reinterpret_cast<char const*>(header),
+                sizeof(header));
+            stream_names_written_ = true;
+        }
+
+        // every counter is defined once, restarting the evaluation adds the
+        // counters found again to the existing ones
+        if (std::size_t const defined = stream_values_.size();
+            defined < infos.size())
+        {
+            for (std::size_t i = defined; i != infos.size(); ++i)
+            {
+                stream::put_tag(buffer, stream::record::define);
+                stream::put_unsigned(buffer, i);
+                buffer.push_back(is_array(infos[i].type_) ? 1 : 0);
+                stream::put_string(buffer, infos[i].fullname_);
+                stream::put_string(buffer, infos[i].unit_of_measure_);
+            }
+
+            stream_values_.resize(infos.size(), 0);
+            stream_arrays_.resize(infos.size());
+            stream_scaling_.resize(
+                infos.size(), std::pair<std::int64_t, bool>(1, false));
+        }
+
+        // scaling and validity are written only if needed
+        for (std::size_t i = 0; i != values.size(); ++i)
+        {
+            std::size_t const id = value_ids[i];
+            stream::put_scaling(
+                buffer, id, values[i], stream_scaling_[id]);
+            if (values[i].status_ != performance_counters::status_valid_data &&
+                values[i].status_ != performance_counters::status_new_data)
+            {
+                stream::put_tag(buffer, stream::record::invalid);
+                stream::put_unsigned(buffer, id);
+                values[i].value_ = stream_values_[id];
+            }
+        }
+        for (std::size_t i = 0; i != arrays.size(); ++i)
+        {
+            std::size_t const id = array_ids[i];
+            stream::put_scaling(
+                buffer, id, arrays[i], stream_scaling_[id]);
+            if (arrays[i].status_ != performance_counters::status_valid_data &&
+                arrays[i].status_ != performance_counters::status_new_data)
+            {
+                stream::put_tag(buffer, stream::record::invalid);
+                stream::put_unsigned(buffer, id);
+                arrays[i].values_ = stream_arrays_[id];
+            }
+        }
+
+        // the sample itself
+        stream::put_tag(buffer, stream::record::sample);
+        stream::put_signed(buffer, now - stream_time_);
+        stream_time_ = now;
+
+        stream::put_unsigned(buffer, values.size());
+        for (std::size_t i = 0; i != values.size(); ++i)
+        {
+            std::int64_t& prev = stream_values_[value_ids[i]];
+            stream::put_signed(buffer, values[i].value_ - prev);
+            prev = values[i].value_;
+        }
+
+        stream::put_unsigned(buffer, arrays.size());
+        for (std::size_t i = 0; i != arrays.size(); ++i)
+        {
+            std::vector<std::int64_t>& prev = stream_arrays_[array_ids[i]];
+            std::vector<std::int64_t> const& current = arrays[i].values_;
+
+            stream::put_unsigned(buffer, current.size());
+            for (std::size_t j = 0; j != current.size(); ++j)
+            {
+                stream::put_signed(
+                    buffer, current[j] - (j < prev.size() ? prev[j] : 0));
+            }
+            prev = current;
+        }
+
+        if (destination_is_cout)
+        {
+            std::cout.write(
+                buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            std::cout.flush();
+        }
+        else
+        {
+            stream_.write(
+                buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            stream_.flush();
+        }
+        return true;
+    }
+
     bool query_counters::evaluate_counters(
         bool reset, char const* description, bool force, error_code& ec)
     {
@@ -708,6 +954,19 @@ namespace hpx::util {
         std::vector<performance_counters::counter_info> const infos =
             counters_.get_counter_infos();
 
+        if (format_ == "binary")
+        {
+            bool const result = stream_counters(
+                destination_is_cout, reset, no_output, infos, ec);
+            if (ec)
+                return false;
+
+            if (&ec != &throws)
+                ec = make_success_code();
+
+            return result;
+        }
+
         bool result = print_raw_counters(
             destination_is_cout, reset, no_output, description, infos, ec);
         if (ec)
@@ -11,7 +11,9 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/modules/executors.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/modules/lock_registration.hpp>
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/threadmanager.hpp>
 #include <hpx/performance_counters/counter_creators.hpp>
@@ -22,8 +24,16 @@
 #include <hpx/modules/schedulers.hpp>
 #endif
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS) ||                            \
+    defined(HPX_HAVE_THREAD_STEALING_COUNTS) ||                                \
+    defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+#include <exception>
+#include <string>
+#endif
+#include <memory>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -122,6 +132,499 @@ namespace hpx::performance_counters::detail {
         return naming::invalid_gid;
     }
 
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+    ///////////////////////////////////////////////////////////////////////////
+    // latency percentile counter creation function
+    // /threads{locality#%d/total}/time/execution-percentile@99
+    // /threads{locality#%d/pool#%s/worker-thread#%d}/time/...-percentile@99
+    naming::gid_type latency_percentile_counter_creator(
+        threads::threadmanager* tm, threads::latency_histogram_kind kind,
+        counter_info const& info, error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "latency_percentile_counter_creator",
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        // the counter parameter is the requested percentile, e.g. 99.9
+        double percentile = 50.;
+        if (!paths.parameters_.empty())
+        {
+            try
+            {
+                percentile = std::stod(paths.parameters_);
+            }
+            catch (std::exception const&)
+            {
+                percentile = -1.;
+            }
+
+            if (!(percentile >= 0. && percentile <= 100.))
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "latency_percentile_counter_creator",
+                    "invalid percentile (should be in [0, 100]): {}",
+                    paths.parameters_);
+                return naming::invalid_gid;
+            }
+        }
+
+        using histogram_type = threads::latency_histogram;
+        hpx::function<std::int64_t(bool)> f;
+
+        // the histograms are never reset, every counter reports the values
+        // recorded since its own last reset
+        auto baseline = std::make_shared<threads::latency_histogram_baseline>();
+
+        threads::thread_pool_base& pool = tm->default_pool();
+        if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+        {
+            // overall counter
+            f = [tm, kind, percentile, baseline](bool reset) {
+                histogram_type::counts_type counts{};
+                tm->collect_latency_histogram(kind, false, counts);
+                baseline->since_last_reset(counts, reset);
+                return histogram_type::percentile(counts, percentile);
+            };
+        }
+        else if (paths.instancename_ == "pool")
+        {
+            if (paths.instanceindex_ >= 0 &&
+                static_cast<std::size_t>(paths.instanceindex_) <
+                    hpx::resource::get_num_thread_pools())
+            {
+                // specific for given pool counter
+                threads::thread_pool_base* pool_instance =
+                    &hpx::resource::get_thread_pool(paths.instanceindex_);
+                auto const num_thread =
+                    static_cast<std::size_t>(paths.subinstanceindex_);
+
+                f = [pool_instance, num_thread, kind, percentile, baseline](
+                        bool reset) {
+                    histogram_type::counts_type counts{};
+                    pool_instance->collect_latency_histogram(
+                        kind, num_thread, false, counts);
+                    baseline->since_last_reset(counts, reset);
+                    return histogram_type::percentile(counts, percentile);
+                };
+            }
+        }
+        else if (paths.instancename_ == "worker-thread" &&
+            paths.instanceindex_ >= 0 &&
+            static_cast<std::size_t>(paths.instanceindex_) <
+                pool.get_os_thread_count())
+        {
+            // specific counter from default pool
+            auto const num_thread =
+                static_cast<std::size_t>(paths.instanceindex_);
+
+            f = [pool_ptr = &pool, num_thread, kind, percentile, baseline](
+                    bool reset) {
+                histogram_type::counts_type counts{};
+                pool_ptr->collect_latency_histogram(
+                    kind, num_thread, false, counts);
+                baseline->since_last_reset(counts, reset);
+                return histogram_type::percentile(counts, percentile);
+            };
+        }
+
+        if (f.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "latency_percentile_counter_creator",
+                "invalid counter instance name: {}", paths.instancename_);
+            return naming::invalid_gid;
+        }
+
+        using detail::create_raw_counter;
+        return create_raw_counter(info, HPX_MOVE(f), ec);
+    }
+#endif
+
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+    ///////////////////////////////////////////////////////////////////////////
+    // steal matrix counter creation function
+    // /threads{locality#%d/total}/count/steal-attempts@<thief>,<victim>
+    // /threads{locality#%d/pool#%s/worker-thread#%d}/count/...@<victim>
+    naming::gid_type steal_count_counter_creator(threads::threadmanager* tm,
+        threads::steal_count_kind kind, counter_info const& info,
+        error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "steal_count_counter_creator",
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        // the counter parameter is either empty (all NUMA domains), the NUMA
+        // domain of the victims, or the NUMA domains of the thieves and the
+        // victims separated by a comma
+        auto thief_domain = static_cast<std::size_t>(-1);
+        auto victim_domain = static_cast<std::size_t>(-1);
+        if (!paths.parameters_.empty())
+        {
+            auto const parse_domain = [](std::string const& value,
+                                          std::size_t& domain) {
+                try
+                {
+                    std::size_t pos = 0;
+                    domain = std::stoul(value, &pos);
+                    return pos == value.size() &&
+                        domain < threads::steal_statistics::max_numa_domains;
+                }
+                catch (std::exception const&)
+                {
+                    return false;
+                }
+            };
+
+            std::string::size_type const comma = paths.parameters_.find(',');
+            bool const valid = comma == std::string::npos ?
+                parse_domain(paths.parameters_, victim_domain) :
+                parse_domain(paths.parameters_.substr(0, comma),
+                    thief_domain) &&
+                    parse_domain(
+                        paths.parameters_.substr(comma + 1), victim_domain);
+
+            if (!valid)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "steal_count_counter_creator",
+                    "invalid NUMA domains (should be <victim> or "
+                    "<thief>,<victim>): {}",
+                    paths.parameters_);
+                return naming::invalid_gid;
+            }
+        }
+
+        hpx::function<std::int64_t(bool)> f;
+
+        threads::thread_pool_base& pool = tm->default_pool();
+        if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+        {
+            // overall counter
+            f = [tm, kind, thief_domain, victim_domain](bool reset) {
+                return tm->get_steal_count(
+                    kind, thief_domain, victim_domain, reset);
+            };
+        }
+        else if (paths.instancename_ == "pool")
+        {
+            if (paths.instanceindex_ >= 0 &&
+                static_cast<std::size_t>(paths.instanceindex_) <
+                    hpx::resource::get_num_thread_pools())
+            {
+                // specific for given pool counter
+                threads::thread_pool_base* pool_instance =
+                    &hpx::resource::get_thread_pool(paths.instanceindex_);
+                auto const num_thread =
+                    static_cast<std::size_t>(paths.subinstanceindex_);
+
+                f = [pool_instance, num_thread, kind, thief_domain,
+                        victim_domain](bool reset) {
+                    return pool_instance->get_steal_count(
+                        kind, thief_domain, victim_domain, num_thread, reset);
+                };
+            }
+        }
+        else if (paths.instancename_ == "worker-thread" &&
+            paths.instanceindex_ >= 0 &&
+            static_cast<std::size_t>(paths.instanceindex_) <
+                pool.get_os_thread_count())
+        {
+            // specific counter from default pool
+            auto const num_thread =
+                static_cast<std::size_t>(paths.instanceindex_);
+
+            f = [pool_ptr = &pool, num_thread, kind, thief_domain,
+                    victim_domain](bool reset) {
+                return pool_ptr->get_steal_count(
+                    kind, thief_domain, victim_domain, num_thread, reset);
+            };
+        }
+
+        if (f.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "steal_count_counter_creator",
+                "invalid counter instance name: {}", paths.instancename_);
+            return naming::invalid_gid;
+        }
+
+        using detail::create_raw_counter;
+        return create_raw_counter(info, HPX_MOVE(f), ec);
+    }
+#endif
+
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+    ///////////////////////////////////////////////////////////////////////////
+    // per annotation counter creation function
+    // /threads{locality#%d/total}/annotation/time@<annotation>
+    // /threads{locality#%d/pool#%s/worker-thread#%d}/annotation/...@<name>
+    naming::gid_type annotation_counter_creator(threads::threadmanager* tm,
+        threads::annotation_counter_kind kind, counter_info const& info,
+        error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "annotation_counter_creator",
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        // the counter parameter is the name of the annotation
+        if (paths.parameters_.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "annotation_counter_creator",
+                "missing annotation name (counter parameter): {}",
+                info.fullname_);
+            return naming::invalid_gid;
+        }
+        std::size_t const index =
+            threads::get_annotation_index(paths.parameters_);
+
+        hpx::function<std::int64_t(bool)> f;
+
+        threads::thread_pool_base& pool = tm->default_pool();
+        if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+        {
+            // overall counter
+            f = [tm, kind, index](bool reset) {
+                return tm->get_annotation_counter(kind, index, reset);
+            };
+        }
+        else if (paths.instancename_ == "pool")
+        {
+            if (paths.instanceindex_ >= 0 &&
+                static_cast<std::size_t>(paths.instanceindex_) <
+                    hpx::resource::get_num_thread_pools())
+            {
+                // specific for given pool counter
+                threads::thread_pool_base* pool_instance =
+                    &hpx::resource::get_thread_pool(paths.instanceindex_);
+                auto const num_thread =
+                    static_cast<std::size_t>(paths.subinstanceindex_);
+
+                f = [pool_instance, num_thread, kind, index](bool reset) {
+                    return pool_instance->get_annotation_counter(
+                        kind, index, num_thread, reset);
+                };
+            }
+        }
+        else if (paths.instancename_ == "worker-thread" &&
+            paths.instanceindex_ >= 0 &&
+            static_cast<std::size_t>(paths.instanceindex_) <
+                pool.get_os_thread_count())
+        {
+            // specific counter from default pool
+            auto const num_thread =
+                static_cast<std::size_t>(paths.instanceindex_);
+
+            f = [pool_ptr = &pool, num_thread, kind, index](bool reset) {
+                return pool_ptr->get_annotation_counter(
+                    kind, index, num_thread, reset);
+            };
+        }
+
+        if (f.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "annotation_counter_creator",
+                "invalid counter instance name: {}", paths.instancename_);
+            return naming::invalid_gid;
+        }
+
+        using detail::create_raw_counter;
+        return create_raw_counter(info, HPX_MOVE(f), ec);
+    }
+#endif
+
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+    ///////////////////////////////////////////////////////////////////////////
+    // keeps the sampling of the hardware events around each HPX-thread phase
+    // enabled while alive
+    struct perf_event_sampling_request
+    {
+        perf_event_sampling_request() noexcept
+        {
+            threads::set_perf_event_task_sampling(true);
+        }
+
+        perf_event_sampling_request(perf_event_sampling_request const&) =
+            delete;
+        perf_event_sampling_request(perf_event_sampling_request&&) = delete;
+        perf_event_sampling_request& operator=(
+            perf_event_sampling_request const&) = delete;
+        perf_event_sampling_request& operator=(
+            perf_event_sampling_request&&) = delete;
+
+        ~perf_event_sampling_request()
+        {
+            threads::set_perf_event_task_sampling(false);
+        }
+    };
+
+    // hardware event counter creation function
+    // /threads{locality#%d/total}/hardware/cycles[@tasks]
+    // /threads{locality#%d/pool#%s/worker-thread#%d}/hardware/...[@tasks]
+    naming::gid_type perf_event_counter_creator(threads::threadmanager* tm,
+        threads::perf_event_kind kind, counter_info const& info,
+        error_code& ec)
+    {
+        // verify the validity of the counter instance name
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+        {
+            return naming::invalid_gid;
+        }
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "perf_event_counter_creator",
+                "invalid counter instance parent name: {}",
+                paths.parentinstancename_);
+            return naming::invalid_gid;
+        }
+
+        // the counter parameter 'tasks' restricts the counts to the events
+        // occurring while executing HPX-threads
+        bool const tasks_only = paths.parameters_ == "tasks";
+        if (!tasks_only && !paths.parameters_.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "perf_event_counter_creator",
+                "invalid counter parameter (should be empty or 'tasks'): {}",
+                paths.parameters_);
+            return naming::invalid_gid;
+        }
+
+        hpx::function<std::int64_t(bool)> f;
+
+        threads::thread_pool_base& pool = tm->default_pool();
+        if (paths.instancename_ == "total" && paths.instanceindex_ == -1)
+        {
+            // overall counter
+            f = [tm, kind, tasks_only](bool reset) {
+                return tm->get_perf_event_counter(kind, tasks_only, reset);
+            };
+        }
+        else if (paths.instancename_ == "pool")
+        {
+            if (paths.instanceindex_ >= 0 &&
+                static_cast<std::size_t>(paths.instanceindex_) <
+                    hpx::resource::get_num_thread_pools())
+            {
+                // specific for given pool counter
+                threads::thread_pool_base* pool_instance =
+                    &hpx::resource::get_thread_pool(paths.instanceindex_);
+                auto const num_thread =
+                    static_cast<std::size_t>(paths.subinstanceindex_);
+
+                f = [pool_instance, num_thread, kind, tasks_only](
+                        bool reset) {
+                    return pool_instance->get_perf_event_counter(
+                        kind, tasks_only, num_thread, reset);
+                };
+            }
+        }
+        else if (paths.instancename_ == "worker-thread" &&
+            paths.instanceindex_ >= 0 &&
+            static_cast<std::size_t>(paths.instanceindex_) <
+                pool.get_os_thread_count())
+        {
+            // specific counter from default pool
+            auto const num_thread =
+                static_cast<std::size_t>(paths.instanceindex_);
+
+            f = [pool_ptr = &pool, num_thread, kind, tasks_only](bool reset) {
+                return pool_ptr->get_perf_event_counter(
+                    kind, tasks_only, num_thread, reset);
+            };
+        }
+
+        if (f.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "perf_event_counter_creator",
+                "invalid counter instance name: {}", paths.instancename_);
+            return naming::invalid_gid;
+        }
+
+        // the events are sampled around each HPX-thread phase only as long
+        // as a counter requesting them exists
+        if (tasks_only)
+        {
+            f = [counter = HPX_MOVE(f),
+                    request = std::make_shared<perf_event_sampling_request>()](
+                    bool reset) { return counter(reset); };
+        }
+
+        using detail::create_raw_counter;
+        return create_raw_counter(info, HPX_MOVE(f), ec);
+    }
+#endif
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+    ///////////////////////////////////////////////////////////////////////////
+    // lock contention counter creation function
+    // /threads{locality#%d/total}/lock/...
+    naming::gid_type lock_contention_counter_creator(
+        util::lock_contention_kind kind, counter_info const& info,
+        error_code& ec)
+    {
+        // the lock sites are shared with the report and the other counters
+        // and are never reset, every counter reports the values recorded
+        // since its own last reset
+        auto baseline = std::make_shared<std::atomic<std::int64_t>>(0);
+
+        hpx::function<std::int64_t(bool)> f = [kind, baseline](bool reset) {
+            std::int64_t const total = util::get_lock_contention_total(kind);
+            std::int64_t const base = reset ?
+                baseline->exchange(total, std::memory_order_relaxed) :
+                baseline->load(std::memory_order_relaxed);
+            return total - base;
+        };
+
+        return locality_raw_counter_creator(info, f, ec);
+    }
+#endif
+
     // scheduler utilization counter creation function
     naming::gid_type scheduler_utilization_counter_creator(
         threads::threadmanager const* tm, counter_info const& info,
@@ -358,6 +861,9 @@ namespace hpx::performance_counters {
             hpx::bind_front(&detail::thread_counts_counter_creator));
 #endif
 
+        using placeholders::_1;
+        using placeholders::_2;
+
         generic_counter_type_data const counter_types[] = {
             // length of thread queue(s)
             {"/threadqueue/length", counter_type::raw,
@@ -676,7 +1182,154 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_num_stolen_to_staged,
                     &threads::thread_pool_base::get_num_stolen_to_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-attempts",
+                counter_type::monotonically_increasing,
+                "returns the number of attempts of the referenced worker "
+                "threads to steal work from other queues, optionally only "
+                "those from the worker threads in the given NUMA domain to "
+                "the given NUMA domain (counter parameter: <victim-domain> "
+                "or <thief-domain>,<victim-domain>)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::steal_count_counter_creator, &tm,
+                    threads::steal_count_kind::attempts),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/steal-successes",
+                counter_type::monotonically_increasing,
+                "returns the number of attempts of the referenced worker "
+                "threads to steal work from other queues which found work, "
+                "optionally only those from the worker threads in the given "
+                "NUMA domain to the given NUMA domain (counter parameter: "
+                "<victim-domain> or <thief-domain>,<victim-domain>)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::steal_count_counter_creator, &tm,
+                    threads::steal_count_kind::successes),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/time/failed-steal-duration",
+                counter_type::elapsed_time,
+                "returns the overall time the referenced worker threads "
+                "spent searching the queues of other worker threads for "
+                "work without finding any",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_failed_steal_time,
+                    &threads::thread_pool_base::get_failed_steal_time),
+                &locality_pool_thread_counter_discoverer, "ns"},
+#endif
+#if defined(HPX_HAVE_THREAD_LATENCY_HISTOGRAMS)
+            {"/threads/time/execution-percentile", counter_type::raw,
+                "returns the given percentile (counter parameter, default: "
+                "50) of the time spent executing one HPX-thread phase",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::latency_percentile_counter_creator,
+                    &tm, threads::latency_histogram_kind::execution),
+                &locality_pool_thread_counter_discoverer, "ns"},
+            {"/threads/time/queue-wait-percentile", counter_type::raw,
+                "returns the given percentile (counter parameter, default: "
+                "50) of the time pending HPX-threads spent in the queues "
+                "before being run",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::latency_percentile_counter_creator,
+                    &tm, threads::latency_histogram_kind::queue_wait),
+                &locality_pool_thread_counter_discoverer, "ns"},
+            {"/threads/time/steal-latency-percentile", counter_type::raw,
+                "returns the given percentile (counter parameter, default: "
+                "50) of the time pending HPX-threads spent in the queue of "
+                "another worker thread before being stolen",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::latency_percentile_counter_creator,
+                    &tm, threads::latency_histogram_kind::steal),
+                &locality_pool_thread_counter_discoverer, "ns"},
+#endif
+#if defined(HPX_HAVE_THREAD_ANNOTATION_COUNTERS)
+            {"/threads/annotation/time", counter_type::monotonically_increasing,
+                "returns the overall time spent executing HPX-threads with "
+                "the given annotation (counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::annotation_counter_creator, &tm,
+                    threads::annotation_counter_kind::time),
+                &locality_pool_thread_counter_discoverer, "ns"},
+            {"/threads/annotation/count",
+                counter_type::monotonically_increasing,
+                "returns the overall number of terminated HPX-threads with "
+                "the given annotation (counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::annotation_counter_creator, &tm,
+                    threads::annotation_counter_kind::count),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/annotation/suspensions",
+                counter_type::monotonically_increasing,
+                "returns the overall number of times HPX-threads with the "
+                "given annotation (counter parameter) were suspended",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::annotation_counter_creator, &tm,
+                    threads::annotation_counter_kind::suspensions),
+                &locality_pool_thread_counter_discoverer, ""},
 #endif
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            {"/threads/lock/count/acquisitions",
+                counter_type::monotonically_increasing,
+                "returns the overall number of times HPX locks were acquired "
+                "on the referenced locality while the lock contention "
+                "profiling was active",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_contention_counter_creator,
+                    util::lock_contention_kind::acquisitions),
+                &locality_counter_discoverer, ""},
+            {"/threads/lock/count/contended",
+                counter_type::monotonically_increasing,
+                "returns the overall number of times HPX locks on the "
+                "referenced locality had to be waited for while the lock "
+                "contention profiling was active",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_contention_counter_creator,
+                    util::lock_contention_kind::contended),
+                &locality_counter_discoverer, ""},
+            {"/threads/lock/time/wait", counter_type::monotonically_increasing,
+                "returns the overall time spent waiting for HPX locks on the "
+                "referenced locality while the lock contention profiling was "
+                "active",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::lock_contention_counter_creator,
+                    util::lock_contention_kind::wait_time),
+                &locality_counter_discoverer, "ns"},
+#endif
+#if defined(HPX_HAVE_PERF_EVENT_COUNTERS)
+            {"/threads/hardware/cycles",
+                counter_type::monotonically_increasing,
+                "returns the number of CPU cycles spent by the worker threads "
+                "(counter parameter 'tasks': only while executing "
+                "HPX-threads)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::perf_event_counter_creator, &tm,
+                    threads::perf_event_kind::cycles),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/hardware/instructions",
+                counter_type::monotonically_increasing,
+                "returns the number of instructions retired by the worker "
+                "threads (counter parameter 'tasks': only while executing "
+                "HPX-threads)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::perf_event_counter_creator, &tm,
+                    threads::perf_event_kind::instructions),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/hardware/llc-misses",
+                counter_type::monotonically_increasing,
+                "returns the number of last level cache read misses caused by "
+                "the worker threads (counter parameter 'tasks': only while "
+                "executing HPX-threads)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::perf_event_counter_creator, &tm,
+                    threads::perf_event_kind::llc_misses),
+                &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/hardware/branch-misses",
+                counter_type::monotonically_increasing,
+                "returns the number of mispredicted branches executed by the "
+                "worker threads (counter parameter 'tasks': only while "
+                "executing HPX-threads)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::perf_event_counter_creator, &tm,
+                    threads::perf_event_kind::branch_misses),
+                &locality_pool_thread_counter_discoverer, ""},
             // scheduler utilization
             {"/scheduler/utilization/instantaneous", counter_type::raw,
                 "returns the current scheduler utilization",
@@ -699,7 +1352,41 @@ namespace hpx::performance_counters {
                 hpx::bind_front(
                     &detail::locality_pool_thread_no_total_counter_creator, &tm,
                     &threads::thread_pool_base::get_busy_loop_count),
-                &locality_pool_thread_no_total_counter_discoverer, ""}};
+                &locality_pool_thread_no_total_counter_discoverer, ""},
+            // tasks run by deadline executors
+            {"/threads/count/deadline-tasks",
+                counter_type::monotonically_increasing,
+                "returns the overall number of tasks with a deadline that "
+                "have been run by deadline executors on the referenced "
+                "locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    hpx::function<std::int64_t(bool)>(&hpx::execution::
+                            experimental::get_deadline_tasks_count),
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/threads/count/deadline-misses",
+                counter_type::monotonically_increasing,
+                "returns the overall number of tasks run by deadline "
+                "executors on the referenced locality that have finished "
+                "after their deadline",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    hpx::function<std::int64_t(bool)>(&hpx::execution::
+                            experimental::get_deadline_misses_count),
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/threads/count/deadline-steals",
+                counter_type::monotonically_increasing,
+                "returns the overall number of tasks run by deadline "
+                "executors on the referenced locality that have been taken "
+                "from the queue of another worker thread",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&locality_raw_counter_creator, _1,
+                    hpx::function<std::int64_t(bool)>(&hpx::execution::
+                            experimental::get_deadline_steals_count),
+                    _2),
+                &locality_counter_discoverer, ""}};
 
         install_counter_types(
             counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
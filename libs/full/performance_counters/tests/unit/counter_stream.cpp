@@ -0,0 +1,242 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the binary, delta encoded performance counter stream written by
+// query_counters when using --hpx:print-counter-format=binary.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/performance_counters/query_counters.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+constexpr char const* stream_file = "counter_stream_test.bin";
+constexpr std::size_t num_samples = 5;
+
+///////////////////////////////////////////////////////////////////////////////
+struct decoder
+{
+    explicit decoder(std::string data)
+      : data_(std::move(data))
+    {
+    }
+
+    bool at_end() const
+    {
+        return pos_ >= data_.size();
+    }
+
+    std::uint8_t byte()
+    {
+        HPX_TEST(!at_end());
+        return static_cast<std::uint8_t>(data_[pos_++]);
+    }
+
+    std::uint64_t get_unsigned()
+    {
+        std::uint64_t result = 0;
+        for (int shift = 0;; shift += 7)
+        {
+            std::uint8_t const b = byte();
+            result |= static_cast<std::uint64_t>(b & 0x7f) << shift;
+            if (b < 0x80)
+                return result;
+        }
+    }
+
+    std::int64_t get_signed()
+    {
+        std::uint64_t const value = get_unsigned();
+        return static_cast<std::int64_t>(value >> 1) ^
+            -static_cast<std::int64_t>(value & 1);
+    }
+
+    std::string get_string()
+    {
+        std::size_t const size = get_unsigned();
+        std::string result = data_.substr(pos_, size);
+        pos_ += size;
+        return result;
+    }
+
+    std::string data_;
+    std::size_t pos_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+struct stream_contents
+{
+    std::vector<std::string> defined;
+    std::size_t samples = 0;
+    std::int64_t time = 0;
+};
+
+// decode the stream, every sample holds the values of all counters defined
+// so far, all of which are monotonically increasing
+stream_contents decode_stream()
+{
+    std::ifstream in(stream_file, std::ios::binary);
+    HPX_TEST(in.good());
+
+    decoder d(std::string(std::istreambuf_iterator<char>(in),
+        std::istreambuf_iterator<char>()));
+    in.close();
+
+    // header
+    HPX_TEST(d.data_.size() > 16);
+    HPX_TEST_EQ(d.data_.substr(0, 8), std::string("HPXCTR01"));
+    d.pos_ = 16;
+
+    stream_contents result;
+    std::vector<std::int64_t> values;
+
+    while (!d.at_end())
+    {
+        switch (d.byte())
+        {
+        case 1:    // define
+        {
+            HPX_TEST_EQ(d.get_unsigned(), result.defined.size());
+            // no array counters
+            HPX_TEST_EQ(d.byte(), static_cast<std::uint8_t>(0));
+            result.defined.push_back(d.get_string());
+            d.get_string();    // unit of measure
+            values.push_back(0);
+            break;
+        }
+
+        case 2:    // sample
+        {
+            std::int64_t const delta = d.get_signed();
+            HPX_TEST_LTE(static_cast<std::int64_t>(0), delta);
+            result.time += delta;
+
+            HPX_TEST_EQ(d.get_unsigned(), values.size());
+            for (std::int64_t& value : values)
+            {
+                std::int64_t const previous = value;
+                value += d.get_signed();
+                HPX_TEST_LTE(previous, value);
+            }
+            HPX_TEST_EQ(d.get_unsigned(), static_cast<std::uint64_t>(0));
+            ++result.samples;
+            break;
+        }
+
+        case 3:    // scaling
+            d.get_unsigned();
+            d.get_signed();
+            d.byte();
+            break;
+
+        case 4:    // invalid
+            HPX_TEST(false);
+            d.get_unsigned();
+            break;
+
+        default:
+            HPX_TEST(false);
+            d.pos_ = d.data_.size();
+            break;
+        }
+    }
+
+    std::remove(stream_file);
+    return result;
+}
+
+std::vector<std::string> const names = {"/runtime{locality#0/total}/uptime",
+    "/threads{locality#0/total}/count/cumulative"};
+
+void evaluate(hpx::util::query_counters& qc)
+{
+    for (std::size_t i = 0; i != num_samples; ++i)
+    {
+        hpx::this_thread::yield();
+        HPX_TEST(qc.evaluate_counters());
+    }
+}
+
+void test_stream()
+{
+    {
+        auto qc = std::make_shared<hpx::util::query_counters>(names,
+            std::vector<std::string>(), 0, stream_file, "binary",
+            std::vector<std::string>(), false, false, false);
+
+        // an interval of zero disables the periodic evaluation, all samples
+        // are written explicitly
+        qc->start();
+        evaluate(*qc);
+        qc->stop_evaluating_counters();
+    }
+
+    stream_contents const contents = decode_stream();
+
+    // the names are written exactly once
+    HPX_TEST(contents.defined == names);
+    HPX_TEST_EQ(contents.samples, num_samples);
+    HPX_TEST_LT(static_cast<std::int64_t>(0), contents.time);
+}
+
+void test_restart()
+{
+    {
+        auto qc = std::make_shared<hpx::util::query_counters>(names,
+            std::vector<std::string>(), 0, stream_file, "binary",
+            std::vector<std::string>(), false, false, false);
+
+        qc->start();
+        evaluate(*qc);
+        qc->stop_evaluating_counters();
+
+        // restarting continues the stream, the counters found again are
+        // defined as new counters
+        qc->start();
+        evaluate(*qc);
+        qc->stop_evaluating_counters();
+    }
+
+    stream_contents const contents = decode_stream();
+
+    std::vector<std::string> expected = names;
+    expected.insert(expected.end(), names.begin(), names.end());
+
+    HPX_TEST(contents.defined == expected);
+    HPX_TEST_EQ(contents.samples, 2 * num_samples);
+    HPX_TEST_LT(static_cast<std::int64_t>(0), contents.time);
+}
+
+int hpx_main()
+{
+    test_stream();
+    test_restart();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=1"};
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
+#endif
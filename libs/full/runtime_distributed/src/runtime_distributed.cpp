@@ -428,6 +428,12 @@ namespace hpx {
         util::external_timer::init(
             nullptr, hpx::get_locality_id(), hpx::get_initial_num_localities());
 #endif
+        start_task_trace(
+            hpx::get_locality_id(), hpx::get_initial_num_localities());
+        start_sampling_profiler(
+            hpx::get_locality_id(), hpx::get_initial_num_localities());
+        start_lock_contention_profiling(
+            hpx::get_locality_id(), hpx::get_initial_num_localities());
 
         LRT_(info).format("cmd_line: {}", get_config().get_cmd_line());
 
@@ -657,6 +663,10 @@ namespace hpx {
             io_pool_->clear();
         }
 #endif
+
+        stop_lock_contention_profiling();
+        stop_sampling_profiler();
+        stop_task_trace();
     }
 
     int runtime_distributed::finalize(double shutdown_timeout)
@@ -4,7 +4,6 @@
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
-#include <hpx/chrono.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
 #include <hpx/modules/testing.hpp>
@@ -14,7 +13,6 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <iostream>
 #include <utility>
 #include <vector>
 
@@ -71,55 +69,40 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (vm.count("tasks"))
         num_tasks = vm["tasks"].as<std::size_t>();
 
-    double seqential_time_per_task = 0;
+    std::size_t const repetitions = vm["repetitions"].as<std::size_t>();
 
-    {
-        std::vector<hpx::future<void>> tasks;
-        tasks.reserve(num_tasks);
-
-        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
-
-        for (std::size_t i = 0; i != num_tasks; ++i)
-            tasks.push_back(hpx::async(&test_func));
-
-        hpx::wait_all(tasks);
-
-        std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+    hpx::util::perftests_init(vm);
 
-        seqential_time_per_task = static_cast<double>(end - start) / 1e9 /
-            static_cast<double>(num_tasks);
-        std::cout << "Elapsed sequential time: "
-                  << static_cast<double>(end - start) / 1e9 << " [s], ("
-                  << seqential_time_per_task << " [s])" << std::endl;
-        hpx::util::print_cdash_timing(
-            "AsyncSequential", seqential_time_per_task);
-    }
+    double const sequential_time = hpx::util::perftests_report(
+        "async overheads - sequential", "no-executor", repetitions, [&]() {
+            std::vector<hpx::future<void>> tasks;
+            tasks.reserve(num_tasks);
 
-    double hierarchical_time_per_task = 0;
+            for (std::size_t i = 0; i != num_tasks; ++i)
+                tasks.push_back(hpx::async(&test_func));
 
-    {
-        std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+            hpx::wait_all(tasks);
+        });
 
-        hpx::future<void> f = hpx::async(&spawn_level, num_tasks);
-        hpx::wait_all(f);
+    double const hierarchical_time = hpx::util::perftests_report(
+        "async overheads - hierarchical", "no-executor", repetitions, [&]() {
+            hpx::future<void> f = hpx::async(&spawn_level, num_tasks);
+            hpx::wait_all(f);
+        });
 
-        std::uint64_t end = hpx::chrono::high_resolution_clock::now();
+    hpx::util::perftests_print_times();
 
-        hierarchical_time_per_task = static_cast<double>(end - start) / 1e9 /
-            static_cast<double>(num_tasks);
-        std::cout << "Elapsed hierarchical time: "
-                  << static_cast<double>(end - start) / 1e9 << " [s], ("
-                  << hierarchical_time_per_task << " [s])" << std::endl;
-        hpx::util::print_cdash_timing(
-            "AsyncHierarchical", hierarchical_time_per_task);
-    }
-
-    std::cout << "Ratio (speedup): "
-              << seqential_time_per_task / hierarchical_time_per_task
-              << std::endl;
+    // the median times per task
+    double const sequential_time_per_task =
+        sequential_time / static_cast<double>(num_tasks);
+    double const hierarchical_time_per_task =
+        hierarchical_time / static_cast<double>(num_tasks);
 
+    hpx::util::print_cdash_timing("AsyncSequential", sequential_time_per_task);
+    hpx::util::print_cdash_timing(
+        "AsyncHierarchical", hierarchical_time_per_task);
     hpx::util::print_cdash_timing(
-        "AsyncSpeedup", seqential_time_per_task / hierarchical_time_per_task);
+        "AsyncSpeedup", sequential_time_per_task / hierarchical_time_per_task);
 
     return hpx::finalize();
 }
@@ -139,10 +122,13 @@ int main(int argc, char* argv[])
         ("spread,p", value<std::size_t>(&spread)->default_value(2),
          "number of sub-spawns per level (default: 2)")
         ("delay,d", value<std::uint64_t>(&delay_ns)->default_value(0),
-        "time spent in the delay loop [ns]");
+        "time spent in the delay loop [ns]")
+        ("repetitions", value<std::size_t>()->default_value(10),
+         "number of repetitions of each benchmark (default: 10)");
     // clang-format on
 
     // Initialize and run HPX
+    hpx::util::perftests_cfg(desc_commandline);
     hpx::init_params init_args;
     init_args.desc_cmdline = desc_commandline;
 
@@ -0,0 +1,125 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the time needed to run chains of short continuations
+// attached with future::then using different launch policies:
+//
+//  - async: every continuation is run on a new HPX thread.
+//  - sync: every continuation is run on the thread that made its antecedent
+//    ready (deep chains are re-spawned by the recursion guard, blocking the
+//    current thread until the remaining chain has run).
+//  - adaptive: continuations are run inline up to the configured depth
+//    (hpx.continuation_inline_depth), deeper continuations are spilled to a
+//    new HPX thread.
+
+#include <hpx/config.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// returns the average time per continuation in nanoseconds
+template <typename Policy>
+double measure(char const* name, Policy const& policy, std::uint64_t length,
+    std::uint64_t iterations)
+{
+    std::uint64_t sum = 0;
+
+    hpx::chrono::high_resolution_timer timer;
+    for (std::uint64_t i = 0; i != iterations; ++i)
+    {
+        hpx::promise<std::uint64_t> p;
+        hpx::future<std::uint64_t> f = p.get_future();
+        for (std::uint64_t j = 0; j != length; ++j)
+        {
+            f = f.then(policy,
+                [](hpx::future<std::uint64_t>&& f) { return f.get() + 1; });
+        }
+
+        p.set_value(0);
+        sum += f.get();
+    }
+    double const elapsed = timer.elapsed();
+
+    if (sum != iterations * length)
+    {
+        std::cerr << "continuation_chain: unexpected result for " << name
+                  << "\n";
+    }
+
+    return elapsed * 1e9 / static_cast<double>(iterations * length);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const iterations = vm["iterations"].as<std::uint64_t>();
+    std::uint64_t const length = vm["length"].as<std::uint64_t>();
+    bool const csvoutput = vm["csv_output"].as<int>() ? true : false;
+
+    double const async_time =
+        measure("async", hpx::launch::async, length, iterations);
+    double const sync_time =
+        measure("sync", hpx::launch::sync, length, iterations);
+    double const adaptive_time =
+        measure("adaptive", hpx::launch::adaptive, length, iterations);
+
+    if (csvoutput)
+    {
+        std::cout << length << "," << iterations << "," << async_time << ","
+                  << sync_time << "," << adaptive_time << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << "continuation chain of length " << length
+                  << " (ns per continuation)\n"
+                  << "  async:        " << std::right << std::setw(12)
+                  << async_time << "\n"
+                  << "  sync:         " << std::right << std::setw(12)
+                  << sync_time << "\n"
+                  << "  adaptive:     " << std::right << std::setw(12)
+                  << adaptive_time << "\n"
+                  << std::flush;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("iterations"
+        , hpx::program_options::value<std::uint64_t>()->default_value(10000)
+        , "number of continuation chains to take the average from")
+
+        ("length"
+        , hpx::program_options::value<std::uint64_t>()->default_value(8)
+        , "number of continuations in each chain")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
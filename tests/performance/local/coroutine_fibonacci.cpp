@@ -0,0 +1,153 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the overhead of a deep recursive chain of co_await
+// expressions by computing fibonacci numbers naively. Awaiting
+// hpx::experimental::task<T> (which transfers control between the
+// coroutines directly) is compared to coroutines returning hpx::future<T>
+// and to spawning an HPX thread for each call using hpx::async.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_HAVE_CXX20_COROUTINES)
+#error "This benchmark requires compiler support for C++20 coroutines"
+#endif
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t fib_serial(int n)
+{
+    if (n < 2)
+        return n;
+    return fib_serial(n - 1) + fib_serial(n - 2);
+}
+
+hpx::experimental::task<std::uint64_t> fib_task(int n)
+{
+    if (n < 2)
+        co_return n;
+
+    std::uint64_t const n1 = co_await fib_task(n - 1);
+    std::uint64_t const n2 = co_await fib_task(n - 2);
+    co_return n1 + n2;
+}
+
+hpx::future<std::uint64_t> fib_future_coroutine(int n)
+{
+    if (n < 2)
+        co_return n;
+
+    std::uint64_t const n1 = co_await fib_future_coroutine(n - 1);
+    std::uint64_t const n2 = co_await fib_future_coroutine(n - 2);
+    co_return n1 + n2;
+}
+
+std::uint64_t fib_async(int n)
+{
+    if (n < 2)
+        return n;
+
+    hpx::future<std::uint64_t> n1 = hpx::async(&fib_async, n - 1);
+    std::uint64_t const n2 = fib_async(n - 2);
+    return n1.get() + n2;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// returns the average time of a single invocation in seconds
+template <typename F>
+double measure(char const* name, int n, int repetitions, F&& f)
+{
+    std::uint64_t const expected = fib_serial(n);
+
+    hpx::chrono::high_resolution_timer timer;
+    for (int r = 0; r != repetitions; ++r)
+    {
+        if (f(n) != expected)
+        {
+            std::cerr << "coroutine_fibonacci: unexpected result for " << name
+                      << "\n";
+        }
+    }
+    return timer.elapsed() / repetitions;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    int const n = vm["n-value"].as<int>();
+    int const repetitions = vm["repetitions"].as<int>();
+    bool const csvoutput = vm["csv_output"].as<int>() ? true : false;
+
+    double const serial_time =
+        measure("serial", n, repetitions, [](int i) { return fib_serial(i); });
+    double const task_time = measure("task", n, repetitions,
+        [](int i) { return fib_task(i).get_future().get(); });
+    double const future_time = measure("future", n, repetitions,
+        [](int i) { return fib_future_coroutine(i).get(); });
+    double const async_time = measure("async", n, repetitions,
+        [](int i) { return hpx::async(&fib_async, i).get(); });
+
+    if (csvoutput)
+    {
+        std::cout << n << "," << serial_time << "," << task_time << ","
+                  << future_time << "," << async_time << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << "fibonacci(" << n << ")\n"
+                  << "  serial [s]:              " << std::right
+                  << std::setw(12) << serial_time << "\n"
+                  << "  co_await task<T> [s]:    " << std::right
+                  << std::setw(12) << task_time << "\n"
+                  << "  co_await future<T> [s]:  " << std::right
+                  << std::setw(12) << future_time << "\n"
+                  << "  hpx::async [s]:          " << std::right
+                  << std::setw(12) << async_time << "\n"
+                  << std::flush;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("n-value"
+        , hpx::program_options::value<int>()->default_value(20)
+        , "n value for the fibonacci function")
+
+        ("repetitions"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of repetitions to take the average from")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
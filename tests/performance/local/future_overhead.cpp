@@ -16,9 +16,9 @@
 #include <hpx/format.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
+#include <hpx/modules/allocator_support.hpp>
 #include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/testing.hpp>
-#include <hpx/modules/timing.hpp>
 #include <hpx/runtime.hpp>
 #include <hpx/thread.hpp>
 
@@ -42,13 +42,12 @@ using hpx::async;
 using hpx::future;
 using hpx::post;
 
-using hpx::chrono::high_resolution_timer;
-
 // global vars we stick here to make printouts easy for plotting
 static std::string queuing = "default";
 static std::size_t numa_sensitive = 0;
 static std::uint64_t num_threads = 1;
 static std::string info_string = "";
+static std::size_t repetitions = 1;
 
 ///////////////////////////////////////////////////////////////////////////////
 void print_stats(char const* title, char const* wait, char const* exec,
@@ -77,6 +76,19 @@ void print_stats(char const* title, char const* wait, char const* exec,
     //hpx::util::print_cdash_timing(title, duration);
 }
 
+// Run the benchmark through the common harness (warmup runs, repetitions,
+// statistics and JSON output) and print the median time of one run.
+template <typename F>
+void report(char const* title, char const* wait, char const* exec,
+    std::uint64_t count, bool csv, F&& f)
+{
+    double const duration = hpx::util::perftests_report(
+        std::string("future overhead - ") + title + " - " + wait, exec,
+        repetitions, HPX_FORWARD(F, f));
+    print_stats(
+        title, wait, exec, static_cast<std::int64_t>(count), duration, csv);
+}
+
 char const* exec_name(hpx::execution::parallel_executor const&)
 {
     return "parallel_executor";
@@ -123,6 +135,14 @@ struct scratcher
     }
 };
 
+struct scratcher_then
+{
+    double operator()(future<double> r) const
+    {
+        return r.get() + 1.0;
+    }
+};
+
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME) && !defined(HPX_COMPUTE_DEVICE_CODE)
 HPX_PLAIN_ACTION(null_function, null_action)
 
@@ -130,38 +150,26 @@ HPX_PLAIN_ACTION(null_function, null_action)
 void measure_action_futures_wait_each(std::uint64_t count, bool csv)
 {
     hpx::id_type const here = hpx::find_here();
-    std::vector<future<double>> futures;
-    futures.reserve(count);
-
-    // start the clock
-    high_resolution_timer const walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-        futures.push_back(async<null_action>(here));
-    hpx::wait_each(scratcher(), futures);
-
-    // stop the clock
-    double const duration = walltime.elapsed();
-    print_stats("action", "WaitEach", "no-executor",
-        static_cast<std::int64_t>(count), duration, csv);
+    report("action", "WaitEach", "no-executor", count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+        for (std::uint64_t i = 0; i < count; ++i)
+            futures.push_back(async<null_action>(here));
+        hpx::wait_each(scratcher(), futures);
+    });
 }
 
 // Time async action execution using wait each on futures vector
 void measure_action_futures_wait_all(std::uint64_t count, bool csv)
 {
     hpx::id_type const here = hpx::find_here();
-    std::vector<future<double>> futures;
-    futures.reserve(count);
-
-    // start the clock
-    high_resolution_timer const walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-        futures.push_back(async<null_action>(here));
-    hpx::wait_all(futures);
-
-    // stop the clock
-    double const duration = walltime.elapsed();
-    print_stats("action", "WaitAll", "no-executor",
-        static_cast<std::int64_t>(count), duration, csv);
+    report("action", "WaitAll", "no-executor", count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+        for (std::uint64_t i = 0; i < count; ++i)
+            futures.push_back(async<null_action>(here));
+        hpx::wait_all(futures);
+    });
 }
 #endif
 
@@ -170,37 +178,81 @@ template <typename Executor>
 void measure_function_futures_wait_each(
     std::uint64_t count, bool csv, Executor& exec)
 {
-    std::vector<future<double>> futures;
-    futures.reserve(count);
-
-    // start the clock
-    high_resolution_timer const walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-        futures.push_back(async(exec, &null_function));
-    hpx::wait_each(scratcher(), futures);
-
-    // stop the clock
-    double const duration = walltime.elapsed();
-    print_stats("async", "WaitEach", exec_name(exec),
-        static_cast<std::int64_t>(count), duration, csv);
+    report("async", "WaitEach", exec_name(exec), count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+        for (std::uint64_t i = 0; i < count; ++i)
+            futures.push_back(async(exec, &null_function));
+        hpx::wait_each(scratcher(), futures);
+    });
 }
 
 template <typename Executor>
 void measure_function_futures_wait_all(
     std::uint64_t count, bool csv, Executor& exec)
 {
-    std::vector<future<double>> futures;
-    futures.reserve(count);
-
-    // start the clock
-    high_resolution_timer const walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-        futures.push_back(async(exec, &null_function));
-    hpx::wait_all(futures);
-
-    double const duration = walltime.elapsed();
-    print_stats("async", "WaitAll", exec_name(exec),
-        static_cast<std::int64_t>(count), duration, csv);
+    report("async", "WaitAll", exec_name(exec), count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+        for (std::uint64_t i = 0; i < count; ++i)
+            futures.push_back(async(exec, &null_function));
+        hpx::wait_all(futures);
+    });
+}
+
+// Time async execution with a single continuation attached to each future,
+// using the per-worker recycled shared states
+template <typename Executor>
+void measure_function_futures_then(
+    std::uint64_t count, bool csv, Executor& exec)
+{
+    report("async+then", "WaitAll", exec_name(exec), count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            futures.push_back(
+                async(exec, &null_function).then(scratcher_then()));
+        }
+        hpx::wait_all(futures);
+    });
+}
+
+// Same as above, except that the shared states of the continuations are
+// allocated from the heap (for comparison)
+template <typename Executor>
+void measure_function_futures_then_heap(
+    std::uint64_t count, bool csv, Executor& exec)
+{
+    report("async+then(heap)", "WaitAll", exec_name(exec), count, csv, [&]() {
+        std::vector<future<double>> futures;
+        futures.reserve(count);
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            futures.push_back(async(exec, &null_function)
+                    .then_alloc(std::allocator<char>{}, scratcher_then()));
+        }
+        hpx::wait_all(futures);
+    });
+}
+
+// Time the creation of a promise, attaching a synchronous continuation to its
+// future, and making it ready. This measures the overheads of the shared
+// states and of registering the continuation only.
+template <typename Allocator>
+void measure_function_promise_then(
+    std::uint64_t count, bool csv, Allocator const& alloc, char const* title)
+{
+    report(title, "Sync", "none", count, csv, [&]() {
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            hpx::promise<double> p(std::allocator_arg, alloc);
+            future<double> f =
+                p.get_future().then(hpx::launch::sync, scratcher_then());
+            p.set_value(null_function());
+            global_scratch = global_scratch + f.get();
+        }
+    });
 }
 
 template <typename Executor>
@@ -209,7 +261,6 @@ void measure_function_futures_limiting_executor(
 {
     std::uint64_t const num_threads = hpx::get_num_worker_threads();
     std::uint64_t const tasks = num_threads * 2000;
-    std::atomic<std::uint64_t> sanity_check(count);
 
     auto const sched = hpx::threads::get_self_id_data()->get_scheduler_base();
     if (std::string("core-shared_priority_queue_scheduler") ==
@@ -237,53 +288,45 @@ void measure_function_futures_limiting_executor(
     auto const chunk_size = count / (num_threads * 2);
     hpx::execution::experimental::static_chunk_size fixed(chunk_size);
 
-    // start the clock
-    high_resolution_timer const walltime;
-    {
-        hpx::execution::experimental::limiting_executor<Executor> signal_exec(
-            exec, tasks, tasks + 1000);
-        hpx::experimental::for_loop(
-            hpx::execution::par.with(fixed), 0, count, [&](std::uint64_t) {
-                hpx::post(signal_exec, [&]() {
-                    null_function();
-                    --sanity_check;
+    report("apply", "limiting-Exec", exec_name(exec), count, csv, [&]() {
+        std::atomic<std::uint64_t> sanity_check(count);
+        {
+            hpx::execution::experimental::limiting_executor<Executor>
+                signal_exec(exec, tasks, tasks + 1000);
+            hpx::experimental::for_loop(hpx::execution::par.with(fixed), 0,
+                count, [&](std::uint64_t) {
+                    hpx::post(signal_exec, [&]() {
+                        null_function();
+                        --sanity_check;
+                    });
                 });
-            });
-    }
-
-    if (sanity_check != 0)
-    {
-        throw std::runtime_error(
-            "This test is faulty " + std::to_string(sanity_check));
-    }
+        }
 
-    // stop the clock
-    double const duration = walltime.elapsed();
-    print_stats("apply", "limiting-Exec", exec_name(exec),
-        static_cast<std::int64_t>(count), duration, csv);
+        if (sanity_check != 0)
+        {
+            throw std::runtime_error(
+                "This test is faulty " + std::to_string(sanity_check));
+        }
+    });
 }
 
 template <typename Executor>
 void measure_function_futures_sliding_semaphore(
     std::uint64_t count, bool csv, Executor& exec)
 {
-    // start the clock
-    high_resolution_timer const walltime;
-    constexpr int sem_count = 5000;
-    auto sem = std::make_shared<hpx::sliding_semaphore>(sem_count);
-    for (std::uint64_t i = 0; i < count; ++i)
-    {
-        hpx::async(exec, [i, sem]() {
-            null_function();
-            sem->signal(static_cast<std::int64_t>(i));
-        });
-        sem->wait(static_cast<std::int64_t>(i));
-    }
-    sem->wait(static_cast<std::int64_t>(count + sem_count - 1));
-
-    // stop the clock
-    double const duration = walltime.elapsed();
-    print_stats("apply", "Sliding-Sem", exec_name(exec), count, duration, csv);
+    report("apply", "Sliding-Sem", exec_name(exec), count, csv, [&]() {
+        constexpr int sem_count = 5000;
+        auto sem = std::make_shared<hpx::sliding_semaphore>(sem_count);
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            hpx::async(exec, [i, sem]() {
+                null_function();
+                sem->signal(static_cast<std::int64_t>(i));
+            });
+            sem->wait(static_cast<std::int64_t>(i));
+        }
+        sem->wait(static_cast<std::int64_t>(count + sem_count - 1));
+    });
 }
 
 struct unlimited_number_of_chunks
@@ -308,84 +351,69 @@ template <typename Executor>
 void measure_function_futures_for_loop(std::uint64_t count, bool csv,
     Executor& exec, char const* executor_name = nullptr)
 {
-    // start the clock
-    high_resolution_timer const walltime;
-    hpx::experimental::for_loop(
-        hpx::execution::par.on(exec).with(
-            hpx::execution::experimental::static_chunk_size(1),
-            unlimited_number_of_chunks()),
-        0, count, [](std::uint64_t) { null_function(); });
-
-    // stop the clock
-    double const duration = walltime.elapsed();
-    print_stats("for_loop", "par",
-        executor_name ? executor_name : exec_name(exec), count, duration, csv);
+    report("for_loop", "par", executor_name ? executor_name : exec_name(exec),
+        count, csv, [&]() {
+            hpx::experimental::for_loop(
+                hpx::execution::par.on(exec).with(
+                    hpx::execution::experimental::static_chunk_size(1),
+                    unlimited_number_of_chunks()),
+                0, count, [](std::uint64_t) { null_function(); });
+        });
 }
 
 void measure_function_futures_register_work(std::uint64_t count, bool csv)
 {
-    hpx::latch l(static_cast<std::int64_t>(count));
-
-    // start the clock
-    high_resolution_timer const walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-    {
-        hpx::threads::thread_init_data data(
-            hpx::threads::make_thread_function_nullary([&l]() {
-                null_function();
-                l.count_down(1);
-            }),
-            "null_function");
-        hpx::threads::register_work(data);
-    }
-    l.wait();
-
-    // stop the clock
-    double const duration = walltime.elapsed();
-    print_stats("register_work", "latch", "none",
-        static_cast<std::int64_t>(count), duration, csv);
+    report("register_work", "latch", "none", count, csv, [&]() {
+        hpx::latch l(static_cast<std::int64_t>(count));
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            hpx::threads::thread_init_data data(
+                hpx::threads::make_thread_function_nullary([&l]() {
+                    null_function();
+                    l.count_down(1);
+                }),
+                "null_function");
+            hpx::threads::register_work(data);
+        }
+        l.wait();
+    });
 }
 
 void measure_function_futures_create_thread(std::uint64_t count, bool csv)
 {
-    hpx::latch l(static_cast<std::int64_t>(count));
-
     auto const sched = hpx::threads::get_self_id_data()->get_scheduler_base();
-    auto func = [&l]() {
-        null_function();
-        l.count_down(1);
-    };
-    auto const thread_func =
-        hpx::threads::detail::thread_function_nullary<decltype(func)>{func};
     constexpr auto desc = hpx::threads::thread_description();
     constexpr auto prio = hpx::threads::thread_priority::normal;
     constexpr auto hint = hpx::threads::thread_schedule_hint();
     constexpr auto stack_size = hpx::threads::thread_stacksize::small_;
-    hpx::error_code ec;
 
-    // start the clock
-    high_resolution_timer const walltime;
-    for (std::uint64_t i = 0; i < count; ++i)
-    {
-        auto init = hpx::threads::thread_init_data(
-            hpx::threads::thread_function_type(thread_func), desc, prio, hint,
-            stack_size, hpx::threads::thread_schedule_state::pending, false,
-            sched);
-        sched->create_thread(init, nullptr, ec);
-    }
-    l.wait();
+    report("create_thread", "latch", "none", count, csv, [&]() {
+        hpx::latch l(static_cast<std::int64_t>(count));
+
+        auto func = [&l]() {
+            null_function();
+            l.count_down(1);
+        };
+        auto const thread_func =
+            hpx::threads::detail::thread_function_nullary<decltype(func)>{
+                func};
+        hpx::error_code ec;
 
-    // stop the clock
-    double const duration = walltime.elapsed();
-    print_stats("create_thread", "latch", "none",
-        static_cast<std::int64_t>(count), duration, csv);
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            auto init = hpx::threads::thread_init_data(
+                hpx::threads::thread_function_type(thread_func), desc, prio,
+                hint, stack_size, hpx::threads::thread_schedule_state::pending,
+                false, sched);
+            sched->create_thread(init, nullptr, ec);
+        }
+        l.wait();
+    });
 }
 
 void measure_function_futures_create_thread_hierarchical_placement(
     std::uint64_t count, bool csv)
 {
-    hpx::latch l(static_cast<std::int64_t>(count));
-
     auto sched = hpx::threads::get_self_id_data()->get_scheduler_base();
 
     if (std::string("core-shared_priority_queue_scheduler") ==
@@ -405,93 +433,91 @@ void measure_function_futures_create_thread_hierarchical_placement(
                     steal_high_priority_first,
             full_mask);
     }
-    auto const func = [&l]() {
-        null_function();
-        l.count_down(1);
-    };
-    auto const thread_func =
-        hpx::threads::detail::thread_function_nullary<decltype(func)>{func};
     auto const desc = hpx::threads::thread_description();
     auto prio = hpx::threads::thread_priority::normal;
     auto stack_size = hpx::threads::thread_stacksize::small_;
     auto num_threads = hpx::get_num_worker_threads();
-    hpx::error_code ec;
 
-    // start the clock
-    high_resolution_timer const walltime;
-    for (std::size_t t = 0; t < num_threads; ++t)
-    {
-        auto const hint =
-            hpx::threads::thread_schedule_hint(static_cast<std::int16_t>(t));
-        auto spawn_func = [&thread_func, sched, hint, t, count, num_threads,
-                              stack_size, desc, prio]() {
-            std::uint64_t const count_start = t * count / num_threads;
-            std::uint64_t const count_end = (t + 1) * count / num_threads;
-            hpx::error_code ec;
-            for (std::uint64_t i = count_start; i < count_end; ++i)
-            {
-                hpx::threads::thread_init_data init(
-                    hpx::threads::thread_function_type(thread_func), desc, prio,
-                    hint, stack_size,
-                    hpx::threads::thread_schedule_state::pending, false, sched);
-                sched->create_thread(init, nullptr, ec);
-            }
+    report("create_thread_hierarchical", "latch", "none", count, csv, [&]() {
+        hpx::latch l(static_cast<std::int64_t>(count));
+
+        auto const func = [&l]() {
+            null_function();
+            l.count_down(1);
         };
-        auto const thread_spawn_func =
-            hpx::threads::detail::thread_function_nullary<decltype(spawn_func)>{
-                spawn_func};
-
-        hpx::threads::thread_init_data init(
-            hpx::threads::thread_function_type(thread_spawn_func), desc, prio,
-            hint, stack_size, hpx::threads::thread_schedule_state::pending,
-            false, sched);
-        sched->create_thread(init, nullptr, ec);
-    }
-    l.wait();
+        auto const thread_func =
+            hpx::threads::detail::thread_function_nullary<decltype(func)>{
+                func};
+        hpx::error_code ec;
 
-    // stop the clock
-    double const duration = walltime.elapsed();
-    print_stats("create_thread_hierarchical", "latch", "none",
-        static_cast<std::int64_t>(count), duration, csv);
+        for (std::size_t t = 0; t < num_threads; ++t)
+        {
+            auto const hint = hpx::threads::thread_schedule_hint(
+                static_cast<std::int16_t>(t));
+            auto spawn_func = [&thread_func, sched, hint, t, count,
+                                  num_threads, stack_size, desc, prio]() {
+                std::uint64_t const count_start = t * count / num_threads;
+                std::uint64_t const count_end = (t + 1) * count / num_threads;
+                hpx::error_code ec;
+                for (std::uint64_t i = count_start; i < count_end; ++i)
+                {
+                    hpx::threads::thread_init_data init(
+                        hpx::threads::thread_function_type(thread_func), desc,
+                        prio, hint, stack_size,
+                        hpx::threads::thread_schedule_state::pending, false,
+                        sched);
+                    sched->create_thread(init, nullptr, ec);
+                }
+            };
+            auto const thread_spawn_func =
+                hpx::threads::detail::thread_function_nullary<
+                    decltype(spawn_func)>{spawn_func};
+
+            hpx::threads::thread_init_data init(
+                hpx::threads::thread_function_type(thread_spawn_func), desc,
+                prio, hint, stack_size,
+                hpx::threads::thread_schedule_state::pending, false, sched);
+            sched->create_thread(init, nullptr, ec);
+        }
+        l.wait();
+    });
 }
 
 void measure_function_futures_apply_hierarchical_placement(
     std::uint64_t count, bool csv)
 {
-    hpx::latch l(static_cast<std::int64_t>(count));
-
-    auto const func = [&l]() {
-        null_function();
-        l.count_down(1);
-    };
     auto const num_threads = hpx::get_num_worker_threads();
 
-    // start the clock
-    high_resolution_timer const walltime;
-    for (std::size_t t = 0; t < num_threads; ++t)
-    {
-        auto const hint =
-            hpx::threads::thread_schedule_hint(static_cast<std::int16_t>(t));
-        auto spawn_func = [&func, hint, t, count, num_threads]() {
-            auto exec = hpx::execution::parallel_executor(hint);
-            std::uint64_t const count_start = t * count / num_threads;
-            std::uint64_t const count_end = (t + 1) * count / num_threads;
-
-            for (std::uint64_t i = count_start; i < count_end; ++i)
-            {
-                hpx::post(exec, func);
-            }
-        };
+    report("apply_hierarchical", "latch", "parallel_executor", count, csv,
+        [&]() {
+            hpx::latch l(static_cast<std::int64_t>(count));
 
-        auto exec = hpx::execution::parallel_executor(hint);
-        hpx::post(exec, spawn_func);
-    }
-    l.wait();
+            auto const func = [&l]() {
+                null_function();
+                l.count_down(1);
+            };
 
-    // stop the clock
-    double const duration = walltime.elapsed();
-    print_stats("apply_hierarchical", "latch", "parallel_executor",
-        static_cast<std::int64_t>(count), duration, csv);
+            for (std::size_t t = 0; t < num_threads; ++t)
+            {
+                auto const hint = hpx::threads::thread_schedule_hint(
+                    static_cast<std::int16_t>(t));
+                auto spawn_func = [&func, hint, t, count, num_threads]() {
+                    auto exec = hpx::execution::parallel_executor(hint);
+                    std::uint64_t const count_start = t * count / num_threads;
+                    std::uint64_t const count_end =
+                        (t + 1) * count / num_threads;
+
+                    for (std::uint64_t i = count_start; i < count_end; ++i)
+                    {
+                        hpx::post(exec, func);
+                    }
+                };
+
+                auto exec = hpx::execution::parallel_executor(hint);
+                hpx::post(exec, spawn_func);
+            }
+            l.wait();
+        });
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -507,7 +533,7 @@ int hpx_main(variables_map& vm)
             numa_sensitive = 0;
 
         bool const test_all = (vm.count("test-all") > 0);
-        int const repetitions = vm["repetitions"].as<int>();
+        repetitions = vm["repetitions"].as<std::size_t>();
 
         if (vm.count("info"))
             info_string = vm["info"].as<std::string>();
@@ -529,30 +555,38 @@ int hpx_main(variables_map& vm)
             hpx::execution::experimental::thread_pool_scheduler>
             sched_exec_tps;
 
-        for (int i = 0; i < repetitions; i++)
+        hpx::util::perftests_init(vm);
+
+        measure_function_futures_create_thread_hierarchical_placement(
+            count, csv);
+        if (test_all)
         {
-            measure_function_futures_create_thread_hierarchical_placement(
-                count, csv);
-            if (test_all)
-            {
-                measure_function_futures_limiting_executor(count, csv, par);
+            measure_function_futures_limiting_executor(count, csv, par);
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME) && !defined(HPX_COMPUTE_DEVICE_CODE)
-                measure_action_futures_wait_each(count, csv);
-                measure_action_futures_wait_all(count, csv);
+            measure_action_futures_wait_each(count, csv);
+            measure_action_futures_wait_all(count, csv);
 #endif
-                measure_function_futures_wait_each(count, csv, par);
-                measure_function_futures_wait_all(count, csv, par);
-                measure_function_futures_sliding_semaphore(count, csv, par);
-                measure_function_futures_for_loop(count, csv, par);
-                measure_function_futures_for_loop(count, csv, sched_exec_tps);
-                measure_function_futures_for_loop(
-                    count, csv, par_nostack, "parallel_executor_nostack");
-                measure_function_futures_register_work(count, csv);
-                measure_function_futures_create_thread(count, csv);
-                measure_function_futures_apply_hierarchical_placement(
-                    count, csv);
-            }
+            measure_function_futures_wait_each(count, csv, par);
+            measure_function_futures_wait_all(count, csv, par);
+            measure_function_futures_then(count, csv, par);
+            measure_function_futures_then_heap(count, csv, par);
+            measure_function_promise_then(count, csv,
+                hpx::util::thread_local_recycling_allocator<
+                    hpx::util::internal_allocator<>>{},
+                "promise+then");
+            measure_function_promise_then(
+                count, csv, std::allocator<char>{}, "promise+then(heap)");
+            measure_function_futures_sliding_semaphore(count, csv, par);
+            measure_function_futures_for_loop(count, csv, par);
+            measure_function_futures_for_loop(count, csv, sched_exec_tps);
+            measure_function_futures_for_loop(
+                count, csv, par_nostack, "parallel_executor_nostack");
+            measure_function_futures_register_work(count, csv);
+            measure_function_futures_create_thread(count, csv);
+            measure_function_futures_apply_hierarchical_placement(count, csv);
         }
+
+        hpx::util::perftests_print_times();
     }
 
     return hpx::finalize();
@@ -574,13 +608,15 @@ int main(int argc, char* argv[])
 
         ("csv", "output results as csv (format: count,duration)")
         ("test-all", "run all benchmarks")
-        ("repetitions", value<int>()->default_value(1),
-         "number of repetitions of the full benchmark")
+        ("repetitions", value<std::size_t>()->default_value(1),
+         "number of timed runs of each benchmark")
 
         ("info", value<std::string>()->default_value("no-info"),
          "extra info for plot output (e.g. branch name)");
     // clang-format on
 
+    hpx::util::perftests_cfg(cmdline);
+
     // Initialize and run HPX.
     hpx::init_params init_args;
     init_args.desc_cmdline = cmdline;
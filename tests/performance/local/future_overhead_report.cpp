@@ -10,14 +10,17 @@
 #include <hpx/chrono.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
+#include <hpx/modules/allocator_support.hpp>
 #include <hpx/modules/testing.hpp>
 #include <hpx/thread.hpp>
 
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 using hpx::program_options::options_description;
 using hpx::program_options::value;
@@ -69,6 +72,53 @@ struct scratcher
     }
 };
 
+struct scratcher_then
+{
+    double operator()(future<double> r) const
+    {
+        return r.get() + 1.0;
+    }
+};
+
+// spawn a task and attach a single continuation to its future, the shared
+// states of both are recycled by the worker threads
+void measure_function_futures_async_then(
+    std::uint64_t count, int const repetitions)
+{
+    std::vector<future<double>> futures;
+    futures.reserve(count);
+
+    hpx::util::perftests_report("future overhead - async+then - wait_all",
+        "no-executor", repetitions, [&]() -> void {
+            for (std::uint64_t i = 0; i < count; ++i)
+            {
+                futures.push_back(async(&null_function).then(scratcher_then()));
+            }
+            hpx::wait_all(futures);
+            futures.clear();
+        });
+    hpx::util::perftests_print_times();
+}
+
+// create a promise, attach a synchronous continuation and make it ready, this
+// measures the overheads of the shared states and of the continuation only
+template <typename Allocator>
+void measure_function_promise_then(std::uint64_t count, int const repetitions,
+    Allocator const& alloc, char const* title)
+{
+    hpx::util::perftests_report(title, "no-executor", repetitions, [&]() {
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            hpx::promise<double> p(std::allocator_arg, alloc);
+            future<double> f =
+                p.get_future().then(hpx::launch::sync, scratcher_then());
+            p.set_value(null_function());
+            global_scratch += f.get();
+        }
+    });
+    hpx::util::perftests_print_times();
+}
+
 void measure_function_futures_create_thread_hierarchical_placement(
     std::uint64_t count, int const repetitions)
 {
@@ -181,6 +231,13 @@ int hpx_main(variables_map& vm)
         {
             measure_function_futures_create_thread_hierarchical_placement(
                 count, repetitions);
+            measure_function_futures_async_then(count, repetitions);
+            measure_function_promise_then(count, repetitions,
+                hpx::util::thread_local_recycling_allocator<
+                    hpx::util::internal_allocator<>>{},
+                "future overhead - promise+then - recycled");
+            measure_function_promise_then(count, repetitions,
+                std::allocator<char>{}, "future overhead - promise+then - heap");
         }
     }
 
@@ -0,0 +1,182 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the time needed to run bulk on the
+// thread_pool_scheduler when the cost of the iterations is skewed. Work
+// stealing between the worker threads (which splits the work left in the
+// queue of a busy worker in halves) is compared to running with stealing
+// disabled, where every worker only processes the chunks initially assigned
+// to it.
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+// spin for roughly the given number of units of work
+void busy_work(std::uint64_t units)
+{
+    double volatile x = 0.0;
+    for (std::uint64_t i = 0; i != units * 100; ++i)
+    {
+        x = x + 1.0;
+    }
+}
+
+enum class distribution
+{
+    uniform,
+    triangular,
+    hotspot
+};
+
+char const* distribution_name(distribution d)
+{
+    switch (d)
+    {
+    case distribution::uniform:
+        return "uniform";
+    case distribution::triangular:
+        return "triangular";
+    case distribution::hotspot:
+        return "hotspot";
+    }
+    return "";
+}
+
+std::uint64_t iteration_cost(distribution d, int i, int n)
+{
+    switch (d)
+    {
+    case distribution::uniform:
+        return 8;
+    case distribution::triangular:
+        // the cost grows linearly with the index, the last worker gets
+        // considerably more work than the first
+        return 1 + (static_cast<std::uint64_t>(i) * 16) / n;
+    case distribution::hotspot:
+        // a small range of very expensive iterations at the beginning
+        return i < n / 16 ? 64 : 4;
+    }
+    return 0;
+}
+
+// returns the average and the maximum time of a single bulk operation
+template <typename Scheduler>
+std::pair<double, double> measure_bulk(
+    Scheduler const& sched, distribution d, int n, int repetitions)
+{
+    double total = 0.0;
+    double worst = 0.0;
+
+    for (int r = 0; r != repetitions; ++r)
+    {
+        auto f = [d, n](int i) { busy_work(iteration_cost(d, i, n)); };
+
+        hpx::chrono::high_resolution_timer timer;
+#if defined(HPX_HAVE_STDEXEC)
+        tt::sync_wait(
+            ex::start_on(sched, ex::just() | ex::bulk(ex::par, n, f)));
+#else
+        tt::sync_wait(ex::schedule(sched) | ex::bulk(n, f));
+#endif
+        double const elapsed = timer.elapsed();
+
+        total += elapsed;
+        worst = (std::max) (worst, elapsed);
+    }
+
+    return {total / repetitions, worst};
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    int const n = vm["iterations"].as<int>();
+    int const repetitions = vm["repetitions"].as<int>();
+    bool const csvoutput = vm["csv_output"].as<int>() ? true : false;
+
+    ex::thread_pool_scheduler sched{};
+
+    hpx::threads::thread_schedule_hint no_stealing_hint;
+    no_stealing_hint.sharing_mode(
+        hpx::threads::thread_sharing_hint::do_not_share_function);
+    auto no_stealing_sched = ex::with_hint(sched, no_stealing_hint);
+
+    // warm up
+    measure_bulk(sched, distribution::uniform, n, 1);
+
+    for (distribution d : {distribution::uniform, distribution::triangular,
+             distribution::hotspot})
+    {
+        auto const [steal_avg, steal_max] =
+            measure_bulk(sched, d, n, repetitions);
+        auto const [static_avg, static_max] =
+            measure_bulk(no_stealing_sched, d, n, repetitions);
+
+        if (csvoutput)
+        {
+            std::cout << distribution_name(d) << "," << n << "," << steal_avg
+                      << "," << steal_max << "," << static_avg << ","
+                      << static_max << "\n"
+                      << std::flush;
+        }
+        else
+        {
+            std::cout << distribution_name(d) << " (" << n << " iterations)\n"
+                      << "  stealing (avg/max [s]):    " << std::right
+                      << std::setw(12) << steal_avg << std::setw(12)
+                      << steal_max << "\n"
+                      << "  no stealing (avg/max [s]): " << std::right
+                      << std::setw(12) << static_avg << std::setw(12)
+                      << static_max << "\n"
+                      << std::flush;
+        }
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("iterations"
+        , hpx::program_options::value<int>()->default_value(10000)
+        , "number of iterations of each bulk operation")
+
+        ("repetitions"
+        , hpx::program_options::value<int>()->default_value(20)
+        , "number of repetitions to take the average from")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
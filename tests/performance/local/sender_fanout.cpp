@@ -0,0 +1,130 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the cost of fanning out the result of a single
+// sender to many consumers using split() and ensure_started(). The consumers
+// are attached concurrently from several HPX threads while the predecessor
+// may complete at any point in time.
+
+#include <hpx/algorithm.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+#include <hpx/latch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename MakeSender>
+double measure_fanout(std::size_t consumers, int repetitions, MakeSender&& make)
+{
+    std::atomic<std::int64_t> sum(0);
+
+    hpx::chrono::high_resolution_timer timer;
+    for (int r = 0; r != repetitions; ++r)
+    {
+        hpx::latch done(static_cast<std::ptrdiff_t>(consumers + 1));
+
+        auto s = make();
+        hpx::experimental::for_loop(
+            hpx::execution::par, std::size_t(0), consumers, [&](std::size_t) {
+                ex::start_detached(s | ex::then([&](int v) {
+                    sum.fetch_add(v, std::memory_order_relaxed);
+                    done.count_down(1);
+                }));
+            });
+
+        done.arrive_and_wait();
+    }
+    double const elapsed = timer.elapsed();
+
+    if (sum.load() !=
+        static_cast<std::int64_t>(consumers) * repetitions * 42)
+    {
+        std::cerr << "sender_fanout: unexpected result\n";
+    }
+
+    // average time per consumer in microseconds
+    return elapsed * 1e6 / (static_cast<double>(consumers) * repetitions);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const consumers = vm["consumers"].as<std::size_t>();
+    int const repetitions = vm["repetitions"].as<int>();
+    bool const csvoutput = vm["csv_output"].as<int>() ? true : false;
+
+    ex::thread_pool_scheduler sched{};
+
+    // split: the predecessor starts when the first consumer is attached
+    double const split_time = measure_fanout(consumers, repetitions, [&] {
+        return ex::split(ex::schedule(sched) | ex::then([] { return 42; }));
+    });
+
+    // ensure_started: the predecessor runs concurrently to attaching the
+    // consumers, most of them are attached after it has completed
+    double const ensure_started_time =
+        measure_fanout(consumers, repetitions, [&] {
+            return ex::ensure_started(
+                ex::schedule(sched) | ex::then([] { return 42; }));
+        });
+
+    if (csvoutput)
+    {
+        std::cout << consumers << "," << split_time << ","
+                  << ensure_started_time << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << "consumers: " << consumers << "\n"
+                  << "split (us/consumer): " << std::right << std::setw(15)
+                  << split_time << "\n"
+                  << "ensure_started (us/consumer): " << std::right
+                  << std::setw(15) << ensure_started_time << "\n"
+                  << std::flush;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("consumers"
+        , hpx::program_options::value<std::size_t>()->default_value(1000)
+        , "number of consumers attached to each shared sender")
+
+        ("repetitions"
+        , hpx::program_options::value<int>()->default_value(100)
+        , "number of repetitions to take the average from")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
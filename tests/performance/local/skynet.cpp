@@ -17,12 +17,12 @@
 // This code implements two versions of the skynet micro benchmark: a 'normal'
 // and a futurized one.
 
-#include <hpx/chrono.hpp>
 #include <hpx/future.hpp>
 #include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
-#include <iostream>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -81,35 +81,55 @@ hpx::future<std::int64_t> skynet_f(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-int hpx_main()
+int hpx_main(hpx::program_options::variables_map& vm)
 {
-    {
-        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+    std::int64_t const size = vm["size"].as<std::int64_t>();
+    std::int64_t const div = vm["div"].as<std::int64_t>();
+    std::size_t const repetitions = vm["repetitions"].as<std::size_t>();
 
-        hpx::future<std::int64_t> result = hpx::async(skynet, 0, 1000000, 10);
-        result.wait();
+    hpx::util::perftests_init(vm);
 
-        t = hpx::chrono::high_resolution_clock::now() - t;
+    // the sum of the ordinal numbers of all leaves
+    std::int64_t const expected = size * (size - 1) / 2;
 
-        std::cout << "Result 1: " << result.get() << " in "
-                  << (static_cast<double>(t) / 1e6) << " ms.\n";
-    }
+    hpx::util::perftests_report(
+        "skynet - async", "no-executor", repetitions, [&]() {
+            hpx::future<std::int64_t> result =
+                hpx::async(skynet, 0, size, div);
+            HPX_TEST_EQ(result.get(), expected);
+        });
 
-    {
-        std::uint64_t t = hpx::chrono::high_resolution_clock::now();
+    hpx::util::perftests_report(
+        "skynet - dataflow", "no-executor", repetitions, [&]() {
+            hpx::future<std::int64_t> result =
+                hpx::async(skynet_f, 0, size, div);
+            HPX_TEST_EQ(result.get(), expected);
+        });
 
-        hpx::future<std::int64_t> result = hpx::async(skynet_f, 0, 1000000, 10);
-        result.wait();
+    hpx::util::perftests_print_times();
 
-        t = hpx::chrono::high_resolution_clock::now() - t;
-
-        std::cout << "Result 2: " << result.get() << " in "
-                  << (static_cast<double>(t) / 1e6) << " ms.\n";
-    }
-    return 0;
+    return hpx::local::finalize();
 }
 
 int main(int argc, char* argv[])
 {
-    return hpx::local::init(hpx_main, argc, argv);
+    using namespace hpx::program_options;
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("size", value<std::int64_t>()->default_value(1000000),
+         "number of actors created on the final level (default: 1000000)")
+        ("div", value<std::int64_t>()->default_value(10),
+         "number of actors spawned by each actor (default: 10)")
+        ("repetitions", value<std::size_t>()->default_value(10),
+         "number of repetitions of each benchmark (default: 10)");
+    // clang-format on
+
+    hpx::util::perftests_cfg(cmdline);
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
 }
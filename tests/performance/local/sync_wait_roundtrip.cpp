@@ -0,0 +1,126 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the round-trip time of sync_wait on short sender
+// chains. Every sync_wait creates a run_loop that the calling thread drives
+// until the sender has completed:
+//
+//  - inline: the sender completes synchronously, the run_loop is finished
+//    before the calling thread starts running it.
+//  - run_loop: the sender is scheduled on the run_loop itself, the work is
+//    pushed to the run_loop queue and executed by the calling thread.
+//  - thread_pool: the sender completes on another HPX thread, the calling
+//    thread has to wait for the run_loop to be finished.
+
+#include <hpx/config.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/init.hpp>
+
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+// returns the average time of a single round-trip in nanoseconds
+template <typename MakeSender>
+double measure(char const* name, std::uint64_t iterations, MakeSender&& make)
+{
+    std::uint64_t sum = 0;
+
+    hpx::chrono::high_resolution_timer timer;
+    for (std::uint64_t i = 0; i != iterations; ++i)
+    {
+        auto result = tt::sync_wait(make());
+        sum += hpx::get<0>(*result);
+    }
+    double const elapsed = timer.elapsed();
+
+    if (sum != iterations * 42)
+    {
+        std::cerr << "sync_wait_roundtrip: unexpected result for " << name
+                  << "\n";
+    }
+
+    return elapsed * 1e9 / static_cast<double>(iterations);
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::uint64_t const iterations = vm["iterations"].as<std::uint64_t>();
+    bool const csvoutput = vm["csv_output"].as<int>() ? true : false;
+
+    double const inline_time = measure("inline", iterations,
+        [] { return ex::just(41) | ex::then([](int i) { return i + 1; }); });
+
+#if defined(HPX_HAVE_STDEXEC)
+    // sync_wait doesn't drive the run_loop a sender is scheduled on
+    double const run_loop_time = 0.0;
+#else
+    ex::run_loop loop;
+    double const run_loop_time = measure("run_loop", iterations, [&] {
+        return ex::schedule(loop.get_scheduler()) |
+            ex::then([] { return 42; });
+    });
+    loop.finish();
+    loop.run();
+#endif
+
+    ex::thread_pool_scheduler sched{};
+    double const thread_pool_time = measure("thread_pool", iterations,
+        [&] { return ex::schedule(sched) | ex::then([] { return 42; }); });
+
+    if (csvoutput)
+    {
+        std::cout << iterations << "," << inline_time << "," << run_loop_time
+                  << "," << thread_pool_time << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << "sync_wait round-trip (ns)\n"
+                  << "  inline:       " << std::right << std::setw(12)
+                  << inline_time << "\n"
+                  << "  run_loop:     " << std::right << std::setw(12)
+                  << run_loop_time << "\n"
+                  << "  thread_pool:  " << std::right << std::setw(12)
+                  << thread_pool_time << "\n"
+                  << std::flush;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("iterations"
+        , hpx::program_options::value<std::uint64_t>()->default_value(100000)
+        , "number of sync_wait round-trips to take the average from")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
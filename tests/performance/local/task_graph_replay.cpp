@@ -0,0 +1,173 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares rebuilding the dataflow graph of a one-dimensional
+// three-point stencil in every iteration (using hpx::dataflow) with recording
+// the graph once in a task_graph and replaying it in every iteration.
+
+#include <hpx/chrono.hpp>
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/executors.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+// spin for roughly the given number of units of work
+void busy_work(std::uint64_t units)
+{
+    double volatile x = 0.0;
+    for (std::uint64_t i = 0; i != units * 100; ++i)
+    {
+        x = x + 1.0;
+    }
+}
+
+double measure_dataflow(std::size_t width, std::size_t steps,
+    std::uint64_t grain, int iterations)
+{
+    hpx::chrono::high_resolution_timer timer;
+    for (int it = 0; it != iterations; ++it)
+    {
+        std::vector<hpx::shared_future<void>> previous(width);
+        for (std::size_t i = 0; i != width; ++i)
+        {
+            previous[i] = hpx::async([grain] { busy_work(grain); });
+        }
+
+        for (std::size_t s = 0; s != steps; ++s)
+        {
+            std::vector<hpx::shared_future<void>> current(width);
+            for (std::size_t i = 0; i != width; ++i)
+            {
+                current[i] = hpx::dataflow(
+                    [grain](auto&&, auto&&, auto&&) { busy_work(grain); },
+                    previous[(i + width - 1) % width], previous[i],
+                    previous[(i + 1) % width]);
+            }
+            previous = HPX_MOVE(current);
+        }
+
+        hpx::wait_all(previous);
+    }
+    return timer.elapsed() / iterations;
+}
+
+double measure_task_graph(std::size_t width, std::size_t steps,
+    std::uint64_t grain, int iterations)
+{
+    // record the graph once
+    ex::task_graph g;
+
+    std::vector<ex::task_graph::node_id> previous(width);
+    for (std::size_t i = 0; i != width; ++i)
+    {
+        previous[i] = g.add([grain] { busy_work(grain); });
+    }
+
+    for (std::size_t s = 0; s != steps; ++s)
+    {
+        std::vector<ex::task_graph::node_id> current(width);
+        for (std::size_t i = 0; i != width; ++i)
+        {
+            current[i] = g.add([grain] { busy_work(grain); },
+                {previous[(i + width - 1) % width], previous[i],
+                    previous[(i + 1) % width]});
+        }
+        previous = HPX_MOVE(current);
+    }
+
+    hpx::execution::parallel_executor exec;
+
+    hpx::chrono::high_resolution_timer timer;
+    for (int it = 0; it != iterations; ++it)
+    {
+        g.run(exec);
+    }
+    return timer.elapsed() / iterations;
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const width = vm["width"].as<std::size_t>();
+    std::size_t const steps = vm["steps"].as<std::size_t>();
+    std::uint64_t const grain = vm["grain"].as<std::uint64_t>();
+    int const iterations = vm["iterations"].as<int>();
+    bool const csvoutput = vm["csv_output"].as<int>() ? true : false;
+
+    // warm up
+    measure_dataflow(width, steps, grain, 1);
+
+    double const dataflow_time =
+        measure_dataflow(width, steps, grain, iterations);
+    double const task_graph_time =
+        measure_task_graph(width, steps, grain, iterations);
+
+    if (csvoutput)
+    {
+        std::cout << width << "," << steps << "," << grain << ","
+                  << dataflow_time << "," << task_graph_time << "\n"
+                  << std::flush;
+    }
+    else
+    {
+        std::cout << "stencil (" << width << " x " << steps
+                  << " tasks per iteration)\n"
+                  << "  dataflow, rebuilt [s]:     " << std::right
+                  << std::setw(12) << dataflow_time << "\n"
+                  << "  task_graph, replayed [s]:  " << std::right
+                  << std::setw(12) << task_graph_time << "\n"
+                  << std::flush;
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("width"
+        , hpx::program_options::value<std::size_t>()->default_value(64)
+        , "number of tasks per time step")
+
+        ("steps"
+        , hpx::program_options::value<std::size_t>()->default_value(50)
+        , "number of time steps in the graph")
+
+        ("grain"
+        , hpx::program_options::value<std::uint64_t>()->default_value(10)
+        , "amount of work per task")
+
+        ("iterations"
+        , hpx::program_options::value<int>()->default_value(20)
+        , "number of times the graph is executed")
+
+        ("csv_output"
+        , hpx::program_options::value<int>()->default_value(0)
+        , "print results in csv format")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
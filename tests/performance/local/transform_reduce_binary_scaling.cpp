@@ -47,15 +47,24 @@ float measure_inner_product(ExPolicy&& policy, std::vector<float> const& data1,
         std::begin(data2), 0.0f, ::multiplies(), ::plus());
 }
 
+// reproducible inner product, independent of the number of threads
 template <typename ExPolicy>
-std::int64_t measure_inner_product(int count, ExPolicy&& policy,
+float measure_inner_product_deterministic(ExPolicy&& policy,
     std::vector<float> const& data1, std::vector<float> const& data2)
+{
+    return hpx::experimental::transform_reduce_deterministic(policy,
+        std::begin(data1), std::end(data1), std::begin(data2), 0.0f);
+}
+
+template <typename ExPolicy, typename F>
+std::int64_t measure_inner_product(int count, ExPolicy&& policy,
+    std::vector<float> const& data1, std::vector<float> const& data2, F&& f)
 {
     std::int64_t start =
         static_cast<std::int64_t>(hpx::chrono::high_resolution_clock::now());
 
     for (int i = 0; i != count; ++i)
-        measure_inner_product(policy, data1, data2);
+        f(policy, data1, data2);
 
     return (static_cast<std::int64_t>(
                 hpx::chrono::high_resolution_clock::now()) -
@@ -92,25 +101,43 @@ int hpx_main(hpx::program_options::variables_map& vm)
         measure_inner_product(hpx::execution::par, data1, data2);
 
         // do measurements
+        auto const plain = [](auto&& policy, auto const& d1, auto const& d2) {
+            return measure_inner_product(policy, d1, d2);
+        };
+        auto const deterministic = [](auto&& policy, auto const& d1,
+                                       auto const& d2) {
+            return measure_inner_product_deterministic(policy, d1, d2);
+        };
+
         std::uint64_t tr_time_datapar = measure_inner_product(
-            test_count, hpx::execution::par_simd, data1, data2);
+            test_count, hpx::execution::par_simd, data1, data2, plain);
         std::uint64_t tr_time_par = measure_inner_product(
-            test_count, hpx::execution::par, data1, data2);
+            test_count, hpx::execution::par, data1, data2, plain);
+        std::uint64_t tr_time_det = measure_inner_product(
+            test_count, hpx::execution::par, data1, data2, deterministic);
 
         if (csvoutput)
         {
             std::cout << "," << static_cast<double>(tr_time_par) / 1e9 << ","
-                      << static_cast<double>(tr_time_datapar) / 1e9 << "\n"
+                      << static_cast<double>(tr_time_datapar) / 1e9 << ","
+                      << static_cast<double>(tr_time_det) / 1e9 << "\n"
                       << std::flush;
         }
         else
         {
+            double const overhead = static_cast<double>(tr_time_det) /
+                static_cast<double>(tr_time_par);
+
             std::cout << "transform_reduce(execution::par): " << std::right
                       << std::setw(15) << static_cast<double>(tr_time_par) / 1e9
                       << "\n"
                       << "transform_reduce(datapar): " << std::right
                       << std::setw(15)
                       << static_cast<double>(tr_time_datapar) / 1e9 << "\n"
+                      << "transform_reduce_deterministic(execution::par): "
+                      << std::right << std::setw(15)
+                      << static_cast<double>(tr_time_det) / 1e9
+                      << " (overhead: " << overhead << "x)\n"
                       << std::flush;
         }
     }
@@ -40,8 +40,9 @@ std::vector<hpx::future<void>> create_tasks(
     return tasks;
 }
 
+template <typename Wait>
 double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
-    std::size_t num_chunks, std::size_t delay)
+    std::size_t num_chunks, std::size_t delay, Wait&& wait)
 {
     std::size_t num_chunk_tasks = ((num_tasks + num_chunks) / num_chunks) - 1;
     std::size_t last_num_chunk_tasks =
@@ -66,14 +67,14 @@ double wait_tasks(std::size_t num_samples, std::size_t num_tasks,
         hpx::chrono::high_resolution_timer t;
         if (num_chunks == 1)
         {
-            hpx::wait_all(chunks[0]);
+            wait(chunks[0]);
         }
         else
         {
             for (std::size_t c = 0; c != num_chunks; ++c)
             {
                 chunk_results.push_back(
-                    hpx::async([&chunks, c]() { hpx::wait_all(chunks[c]); }));
+                    hpx::async([&chunks, &wait, c]() { wait(chunks[c]); }));
             }
             hpx::wait_all(chunk_results);
         }
@@ -106,13 +107,33 @@ int hpx_main(hpx::program_options::variables_map& vm)
     if (num_chunks == 0)
         num_chunks = 1;
 
+    auto const wait_all = [](std::vector<hpx::future<void>>& tasks) {
+        hpx::wait_all(tasks);
+    };
+    auto const when_all = [](std::vector<hpx::future<void>>& tasks) {
+        hpx::when_all(tasks).get();
+    };
+    auto const when_any = [](std::vector<hpx::future<void>>& tasks) {
+        auto result = hpx::when_any(tasks).get();
+        hpx::wait_all(result.futures);
+    };
+
     // wait for all of the tasks sequentially
-    double elapsed_seq = wait_tasks(num_samples, num_tasks, 1, delay);
+    double elapsed_seq = wait_tasks(num_samples, num_tasks, 1, delay, wait_all);
+
+    // same using the when_all and when_any combinators
+    double elapsed_when_all =
+        wait_tasks(num_samples, num_tasks, 1, delay, when_all);
+    double elapsed_when_any =
+        wait_tasks(num_samples, num_tasks, 1, delay, when_any);
 
     // wait of tasks in chunks
     double elapsed_chunks = 0;
     if (num_chunks != 1)
-        elapsed_chunks = wait_tasks(num_samples, num_tasks, num_chunks, delay);
+    {
+        elapsed_chunks =
+            wait_tasks(num_samples, num_tasks, num_chunks, delay, wait_all);
+    }
 
     if (header)
     {
@@ -132,6 +153,20 @@ int hpx_main(hpx::program_options::variables_map& vm)
     hpx::util::print_cdash_timing(
         "WaitAll", elapsed_seq / static_cast<double>(num_tasks));
 
+    hpx::util::format_to(std::cout, "{:10},{:10},{:10},{:10},{:10.12},{}\n",
+        tasks_str, std::string("1"), delay_str, elapsed_when_all,
+        elapsed_when_all / static_cast<double>(num_tasks), "when_all")
+        << std::endl;
+    hpx::util::print_cdash_timing(
+        "WhenAll", elapsed_when_all / static_cast<double>(num_tasks));
+
+    hpx::util::format_to(std::cout, "{:10},{:10},{:10},{:10},{:10.12},{}\n",
+        tasks_str, std::string("1"), delay_str, elapsed_when_any,
+        elapsed_when_any / static_cast<double>(num_tasks), "when_any")
+        << std::endl;
+    hpx::util::print_cdash_timing(
+        "WhenAny", elapsed_when_any / static_cast<double>(num_tasks));
+
     if (num_chunks != 1)
     {
         hpx::util::format_to(std::cout,
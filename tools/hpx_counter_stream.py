@@ -0,0 +1,304 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 The STE||AR-Group
+#
+# SPDX-License-Identifier: BSL-1.0
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# Decode the binary performance counter stream written by HPX when using
+# --hpx:print-counter-format=binary. The decoded samples are either printed in
+# CSV format or the most recent values are served locally in the OpenMetrics
+# text format (for instance to be scraped by Prometheus).
+#
+#   $ ./app --hpx:print-counter=... --hpx:print-counter-interval=10 \
+#         --hpx:print-counter-format=binary \
+#         --hpx:print-counter-destination=counters.fifo &
+#   $ python3 hpx_counter_stream.py counters.fifo --serve 9464
+
+import argparse
+import http.server
+import re
+import struct
+import sys
+import threading
+import time
+
+MAGIC = b'HPXCTR01'
+
+REC_DEFINE = 1
+REC_SAMPLE = 2
+REC_SCALING = 3
+REC_INVALID = 4
+
+
+class NeedMoreData(Exception):
+    pass
+
+
+class Reader:
+    def __init__(self, data, pos):
+        self.data = data
+        self.pos = pos
+
+    def byte(self):
+        if self.pos >= len(self.data):
+            raise NeedMoreData()
+        b = self.data[self.pos]
+        self.pos += 1
+        return b
+
+    def unsigned(self):
+        result = 0
+        shift = 0
+        while True:
+            b = self.byte()
+            result |= (b & 0x7f) << shift
+            if b < 0x80:
+                return result
+            shift += 7
+
+    def signed(self):
+        value = self.unsigned()
+        return (value >> 1) ^ -(value & 1)
+
+    def string(self):
+        size = self.unsigned()
+        if self.pos + size > len(self.data):
+            raise NeedMoreData()
+        s = self.data[self.pos:self.pos + size].decode('utf-8', 'replace')
+        self.pos += size
+        return s
+
+
+class Counter:
+    def __init__(self, name, unit, is_array):
+        self.name = name
+        self.unit = unit
+        self.is_array = is_array
+        self.raw = [] if is_array else 0
+        self.scaling = 1
+        self.scale_inverse = False
+        self.valid = True
+
+    def scale(self, value):
+        if self.scaling in (0, 1):
+            return value
+        if self.scale_inverse:
+            return value / self.scaling
+        return value * self.scaling
+
+    def value(self):
+        if self.is_array:
+            return [self.scale(v) for v in self.raw]
+        return self.scale(self.raw)
+
+
+class Decoder:
+    """Incrementally decodes the counter stream, calls on_sample(time, ids)
+    for every decoded sample."""
+
+    def __init__(self, on_sample):
+        self.buffer = b''
+        self.header_read = False
+        self.counters = []
+        self.time = 0
+        self.on_sample = on_sample
+
+    def feed(self, data):
+        self.buffer += data
+        if not self.header_read:
+            if len(self.buffer) < 16:
+                return
+            magic, version, _ = struct.unpack_from('=8sII', self.buffer)
+            if magic != MAGIC or version != 1:
+                raise ValueError('not an HPX counter stream')
+            self.buffer = self.buffer[16:]
+            self.header_read = True
+
+        pos = 0
+        while pos < len(self.buffer):
+            reader = Reader(self.buffer, pos)
+            try:
+                self.record(reader)
+            except NeedMoreData:
+                break
+            pos = reader.pos
+        self.buffer = self.buffer[pos:]
+
+    def record(self, r):
+        tag = r.byte()
+        if tag == REC_DEFINE:
+            ident = r.unsigned()
+            is_array = r.byte() != 0
+            name = r.string()
+            unit = r.string()
+            while len(self.counters) <= ident:
+                self.counters.append(None)
+            self.counters[ident] = Counter(name, unit, is_array)
+        elif tag == REC_SCALING:
+            ident = r.unsigned()
+            scaling = r.signed()
+            inverse = r.byte() != 0
+            counter = self.counters[ident]
+            counter.scaling, counter.scale_inverse = scaling, inverse
+        elif tag == REC_INVALID:
+            self.counters[r.unsigned()].valid = False
+        elif tag == REC_SAMPLE:
+            # decode completely before applying any of the deltas
+            time_delta = r.signed()
+            values = [r.signed() for _ in range(r.unsigned())]
+            arrays = []
+            for _ in range(r.unsigned()):
+                arrays.append([r.signed() for _ in range(r.unsigned())])
+
+            self.time += time_delta
+            scalars = [c for c in self.counters if not c.is_array]
+            for counter, delta in zip(scalars, values):
+                counter.raw += delta
+            vectors = [c for c in self.counters if c.is_array]
+            for counter, deltas in zip(vectors, arrays):
+                prev = counter.raw
+                counter.raw = [
+                    d + (prev[i] if i < len(prev) else 0)
+                    for i, d in enumerate(deltas)]
+
+            self.on_sample(self.time, self.counters)
+            for counter in self.counters:
+                counter.valid = True
+        else:
+            raise ValueError('corrupt counter stream (tag {})'.format(tag))
+
+
+###############################################################################
+COUNTER_NAME = re.compile(r'^/([^{]+)\{([^}]*)\}/([^@]*)(@.*)?$')
+
+
+def metric_name(name):
+    """Map an HPX counter name onto an OpenMetrics metric name and labels"""
+    m = COUNTER_NAME.match(name)
+    if not m:
+        metric, labels = name, {}
+    else:
+        obj, instance, counter, params = m.groups()
+        metric = obj + '_' + counter
+        labels = {'instance': instance}
+        if params:
+            labels['parameters'] = params[1:]
+    metric = 'hpx_' + re.sub(r'[^a-zA-Z0-9_:]', '_', metric).strip('_')
+    return metric, labels
+
+
+def format_labels(labels):
+    if not labels:
+        return ''
+    items = ['{}="{}"'.format(k, v.replace('\\', '\\\\').replace('"', '\\"'))
+             for k, v in sorted(labels.items())]
+    return '{' + ','.join(items) + '}'
+
+
+def openmetrics(counters):
+    lines = []
+    seen = set()
+    for counter in counters:
+        if counter is None or not counter.valid:
+            continue
+        metric, labels = metric_name(counter.name)
+        if metric not in seen:
+            seen.add(metric)
+            lines.append('# TYPE {} gauge'.format(metric))
+            if counter.unit:
+                lines.append('# HELP {} unit: {}'.format(metric, counter.unit))
+        if counter.is_array:
+            for i, v in enumerate(counter.value()):
+                label = dict(labels, index=str(i))
+                lines.append('{}{} {}'.format(metric, format_labels(label), v))
+        else:
+            lines.append('{}{} {}'.format(
+                metric, format_labels(labels), counter.value()))
+    lines.append('# EOF')
+    return '\n'.join(lines) + '\n'
+
+
+def serve(port, state):
+    class Handler(http.server.BaseHTTPRequestHandler):
+        def do_GET(self):
+            if self.path != '/metrics':
+                self.send_error(404)
+                return
+            with state['lock']:
+                body = openmetrics(state['counters']).encode('utf-8')
+            self.send_response(200)
+            self.send_header(
+                'Content-Type',
+                'application/openmetrics-text; version=1.0.0; charset=utf-8')
+            self.send_header('Content-Length', str(len(body)))
+            self.end_headers()
+            self.wfile.write(body)
+
+        def log_message(self, *args):
+            pass
+
+    server = http.server.ThreadingHTTPServer(('127.0.0.1', port), Handler)
+    thread = threading.Thread(target=server.serve_forever, daemon=True)
+    thread.start()
+    return server
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Decode the binary HPX performance counter stream')
+    parser.add_argument('input', nargs='?', default='-',
+                        help='stream file or FIFO (default: stdin)')
+    parser.add_argument('--follow', action='store_true',
+                        help='wait for more data at the end of a file')
+    parser.add_argument('--serve', type=int, metavar='PORT',
+                        help='serve the most recent values in the '
+                             'OpenMetrics format on localhost:PORT/metrics '
+                             'instead of printing them')
+    args = parser.parse_args()
+
+    state = {'lock': threading.Lock(), 'counters': []}
+
+    def print_sample(t, counters):
+        out = sys.stdout
+        for counter in counters:
+            if counter is None:
+                continue
+            value = counter.value() if counter.valid else 'invalid'
+            if counter.is_array and counter.valid:
+                value = ':'.join(str(v) for v in value)
+            out.write('{:.9f},{},{}\n'.format(t * 1e-9, counter.name, value))
+        out.flush()
+
+    def store_sample(t, counters):
+        state['counters'] = counters
+
+    decoder = Decoder(store_sample if args.serve else print_sample)
+    server = serve(args.serve, state) if args.serve else None
+
+    stream = sys.stdin.buffer if args.input == '-' else open(args.input, 'rb')
+    try:
+        while True:
+            data = stream.read1(65536) if hasattr(stream, 'read1') else \
+                stream.read(65536)
+            if not data:
+                if args.follow or server is not None:
+                    time.sleep(0.01)
+                    continue
+                break
+            with state['lock']:
+                decoder.feed(data)
+    except KeyboardInterrupt:
+        pass
+    except ValueError as e:
+        sys.stderr.write('error: {}\n'.format(e))
+        return 1
+    finally:
+        if server is not None:
+            server.shutdown()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
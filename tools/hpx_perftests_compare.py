@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 The STE||AR-Group
+#
+# SPDX-License-Identifier: BSL-1.0
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# Compare two result files written by the HPX performance tests (see
+# hpx::util::perftests_report, --bench_output or --detailed_bench) and flag
+# statistically significant regressions. For every benchmark present in both
+# files, a bootstrap confidence interval of the relative change of the median
+# time is computed. A change is significant if the whole interval lies beyond
+# the given threshold. The exit code is 1 if any benchmark got slower.
+
+import argparse
+import json
+import random
+import statistics
+import sys
+
+
+def load_results(filename):
+    with open(filename, 'r') as f:
+        data = json.load(f)
+
+    results = {}
+    for output in data.get('outputs', []):
+        key = (output['name'], output.get('executor', ''))
+        results.setdefault(key, []).extend(float(v) for v in output['series'])
+    return data.get('configuration', {}), results
+
+
+def median_change_interval(before, after, samples, alpha, rng):
+    # percentile bootstrap of the relative difference of the medians
+    scale = statistics.median(before)
+    estimates = []
+    for _ in range(samples):
+        b = statistics.median(rng.choices(before, k=len(before)))
+        a = statistics.median(rng.choices(after, k=len(after)))
+        estimates.append((a - b) / scale)
+    estimates.sort()
+
+    lower = estimates[int(alpha / 2 * (samples - 1))]
+    upper = estimates[int((1 - alpha / 2) * (samples - 1))]
+    return lower, upper
+
+
+def classify(lower, upper, threshold):
+    if lower > threshold:
+        return 'slower'
+    if upper < -threshold:
+        return 'faster'
+    if -threshold <= lower and upper <= threshold:
+        return 'same'
+    return 'unclear'
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare two HPX performance test result files')
+    parser.add_argument('before', help='reference results (JSON)')
+    parser.add_argument('after', help='new results (JSON)')
+    parser.add_argument(
+        '--threshold', type=float, default=0.02,
+        help='relative change of the median considered significant '
+        '(default: 0.02)')
+    parser.add_argument(
+        '--alpha', type=float, default=0.05,
+        help='significance level of the confidence intervals '
+        '(default: 0.05)')
+    parser.add_argument(
+        '--bootstrap-samples', type=int, default=1000,
+        help='number of bootstrap samples (default: 1000)')
+    parser.add_argument(
+        '--seed', type=int, default=42,
+        help='seed of the random number generator (default: 42)')
+    parser.add_argument(
+        '--json', metavar='FILE',
+        help='write the comparison to the given file as JSON')
+    args = parser.parse_args()
+
+    config_before, before = load_results(args.before)
+    config_after, after = load_results(args.after)
+
+    # results of runs using different thread placements are not comparable
+    if config_before != config_after:
+        print('warning: the configurations of the runs differ:',
+              file=sys.stderr)
+        for key in sorted(set(config_before) | set(config_after)):
+            if config_before.get(key) != config_after.get(key):
+                print('  {}: {} -> {}'.format(
+                    key, config_before.get(key, '-'),
+                    config_after.get(key, '-')), file=sys.stderr)
+
+    rng = random.Random(args.seed)
+    comparison = []
+    for key in sorted(set(before) & set(after)):
+        if not before[key] or not after[key]:
+            continue
+
+        lower, upper = median_change_interval(
+            before[key], after[key], args.bootstrap_samples, args.alpha, rng)
+        comparison.append({
+            'name': key[0],
+            'executor': key[1],
+            'median_before': statistics.median(before[key]),
+            'median_after': statistics.median(after[key]),
+            'change_ci': [lower, upper],
+            'result': classify(lower, upper, args.threshold),
+        })
+
+    for key in sorted(set(before) ^ set(after)):
+        print('warning: {} ({}) is present in one file only'.format(*key),
+              file=sys.stderr)
+
+    width = max([len(c['name']) + len(c['executor']) + 3
+                 for c in comparison] + [9])
+    print('{:<{w}}  {:>12}  {:>12}  {:>22}  {}'.format(
+        'benchmark', 'before [s]', 'after [s]', 'change (CI)', 'result',
+        w=width))
+    for c in comparison:
+        print('{:<{w}}  {:>12.5e}  {:>12.5e}  {:>+9.1%} .. {:>+9.1%}  {}'
+              .format('{} ({})'.format(c['name'], c['executor']),
+                      c['median_before'], c['median_after'],
+                      c['change_ci'][0], c['change_ci'][1], c['result'],
+                      w=width))
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'threshold': args.threshold, 'alpha': args.alpha,
+                       'comparison': comparison}, f, indent=2)
+
+    return 1 if any(c['result'] == 'slower' for c in comparison) else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2025 The STE||AR-Group
+#
+# SPDX-License-Identifier: BSL-1.0
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# Convert a binary task trace written by HPX (hpx.task_trace.file, requires
+# HPX_WITH_TASK_TRACE=ON) into the Chrome trace event format, which can be
+# loaded into https://ui.perfetto.dev or chrome://tracing.
+
+import argparse
+import json
+import struct
+import sys
+
+HEADER = struct.Struct('=8sIIQQ')
+RECORD = struct.Struct('=QQQHB5x')
+
+EV_CREATE = 0
+EV_START = 1
+EV_SUSPEND = 2
+EV_RESUME = 3
+EV_FINISH = 4
+EV_STEAL = 5
+EV_PARCEL_SEND = 6
+EV_PARCEL_RECEIVE = 7
+EV_NAME = 0x80
+EV_END = 0x81
+
+
+def read_trace(filename):
+    with open(filename, 'rb') as f:
+        data = f.read()
+
+    if len(data) < HEADER.size:
+        raise ValueError('{}: file too short'.format(filename))
+
+    magic, version, record_size, tsc_start, ns_start = \
+        HEADER.unpack_from(data, 0)
+    if magic != b'HPXTRC01' or version != 1 or record_size != RECORD.size:
+        raise ValueError('{}: not an HPX task trace'.format(filename))
+
+    names = {}
+    records = []
+    end = None
+
+    offset = HEADER.size
+    while offset + RECORD.size <= len(data):
+        rec = RECORD.unpack_from(data, offset)
+        offset += RECORD.size
+
+        timestamp, ident, value, worker, event = rec
+        if event == EV_NAME:
+            padded = (value + RECORD.size - 1) // RECORD.size * RECORD.size
+            names[ident] = data[offset:offset + value].decode(
+                'utf-8', 'replace')
+            offset += padded
+        elif event == EV_END:
+            end = rec
+        else:
+            records.append(rec)
+
+    return (tsc_start, ns_start), names, records, end
+
+
+def convert(filename, ticks_per_us=None):
+    (tsc_start, ns_start), names, records, end = read_trace(filename)
+
+    # calibrate the time stamps using the first and the last record written
+    # by the recorder
+    if ticks_per_us is None:
+        if end is None or end[0] == tsc_start:
+            sys.stderr.write(
+                'warning: no end record found, assuming 1 tick per ns\n')
+            ticks_per_us = 1000.0
+        else:
+            ticks_per_us = (end[0] - tsc_start) * 1000.0 / (end[1] - ns_start)
+
+    if end is not None and end[2] != 0:
+        sys.stderr.write('warning: {} events were dropped while recording\n'
+                         .format(end[2]))
+
+    def ts(timestamp):
+        return (timestamp - tsc_start) / ticks_per_us
+
+    records.sort(key=lambda r: r[0])
+
+    events = []
+    task_names = {}
+    started = set()
+    running = {}
+
+    for timestamp, ident, value, worker, event in records:
+        if event == EV_CREATE:
+            task_names[ident] = names.get(value, 'task')
+            events.append({'name': 'create', 'cat': 'task', 'ph': 's',
+                           'id': ident, 'pid': 0, 'tid': worker,
+                           'ts': ts(timestamp)})
+        elif event in (EV_START, EV_RESUME):
+            # threads without phase information are always reported as
+            # 'start', the first activation of a task is the real start
+            if event == EV_START and ident in started:
+                event = EV_RESUME
+            started.add(ident)
+
+            name = task_names.get(ident, 'task')
+            events.append({'name': name, 'cat': 'task', 'ph': 'B',
+                           'pid': 0, 'tid': worker, 'ts': ts(timestamp),
+                           'args': {'id': hex(ident),
+                                    'resumed': event == EV_RESUME}})
+            if event == EV_START and ident in task_names:
+                events.append({'name': 'create', 'cat': 'task', 'ph': 'f',
+                               'bp': 'e', 'id': ident, 'pid': 0,
+                               'tid': worker, 'ts': ts(timestamp)})
+            running[worker] = ident
+        elif event in (EV_SUSPEND, EV_FINISH):
+            if running.pop(worker, None) is None:
+                continue    # the matching begin event was not recorded
+            events.append({'name': task_names.get(ident, 'task'),
+                           'cat': 'task', 'ph': 'E', 'pid': 0,
+                           'tid': worker, 'ts': ts(timestamp),
+                           'args': {'finished': event == EV_FINISH}})
+            if event == EV_FINISH:
+                task_names.pop(ident, None)
+                started.discard(ident)
+        elif event == EV_STEAL:
+            events.append({'name': 'steal', 'cat': 'scheduler', 'ph': 'i',
+                           's': 't', 'pid': 0, 'tid': worker,
+                           'ts': ts(timestamp),
+                           'args': {'id': hex(ident), 'victim': value}})
+        elif event in (EV_PARCEL_SEND, EV_PARCEL_RECEIVE):
+            send = event == EV_PARCEL_SEND
+            events.append({'name': 'parcel', 'cat': 'parcel',
+                           'ph': 's' if send else 'f', 'bp': 'e',
+                           'id': ident, 'pid': 0, 'tid': worker,
+                           'ts': ts(timestamp)})
+            events.append({'name': 'send' if send else 'receive',
+                           'cat': 'parcel', 'ph': 'i', 's': 't', 'pid': 0,
+                           'tid': worker, 'ts': ts(timestamp),
+                           'args': {'locality': value}})
+
+    for worker in sorted({r[3] for r in records}):
+        events.append({'name': 'thread_name', 'ph': 'M', 'pid': 0,
+                       'tid': worker,
+                       'args': {'name': 'worker-thread#{}'.format(worker)}})
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Convert an HPX task trace into the Chrome trace format')
+    parser.add_argument('input', help='binary task trace written by HPX')
+    parser.add_argument('output', nargs='?', default='-',
+                        help='JSON output file (default: stdout)')
+    parser.add_argument('--ticks-per-us', type=float, default=None,
+                        help='override the time stamp calibration')
+    args = parser.parse_args()
+
+    try:
+        trace = convert(args.input, args.ticks_per_us)
+    except (OSError, ValueError) as e:
+        sys.stderr.write('error: {}\n'.format(e))
+        return 1
+
+    if args.output == '-':
+        json.dump(trace, sys.stdout)
+    else:
+        with open(args.output, 'w') as f:
+            json.dump(trace, f)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -37,11 +37,9 @@ class _OutputKey(typing.NamedTuple):
 
     @classmethod
     def outputs_by_key(cls, data):
+        # the outputs may contain additional statistics of the series
         def split_output(o):
-            return cls(**{
-                k: v for k, v in o.items() \
-                    if k != 'series' and k != 'average' \
-            }), o['series']
+            return cls(name=o['name'], executor=o['executor']), o['series']
 
         return dict(split_output(o) for o in data['outputs'])
 